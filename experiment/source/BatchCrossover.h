@@ -0,0 +1,115 @@
+#ifndef BATCH_CROSSOVER_H
+#define BATCH_CROSSOVER_H
+
+#include <algorithm>
+
+#include "base/assert.h"
+#include "base/vector.h"
+#include "tools/Random.h"
+
+#include "Mutators.h"
+#include "Utilities.h"
+#include "WorkerPool.h"
+
+/// Batched sorting network crossover: plan every crossover of a generation, then run them.
+/// - Plan pairs off the first num_orgs of a (shuffled) list of organisms -- first with second,
+///   third with fourth, and so on -- and draws every pair's cut points (or uniform crossover mask
+///   key) from the experiment's random number generator, on the calling thread.
+/// - Pairs are disjoint, so Run crosses them in parallel (see WorkerPool). Each worker has its own
+///   mutator (for its scratch network). Offspring depend only on the plan, not on the number of
+///   threads.
+/// - The plan and mutators are reused across generations: in steady state, crossover allocates
+///   nothing beyond copy-on-write unsharing of the networks it edits (see CopyOnWrite.h).
+class BatchCrossover {
+public:
+  using genome_t = SortingNetworkMutator::genome_t;
+
+  enum CROSSOVER_TYPES { SINGLE_PT=0, TWO_PT=1, UNIFORM=2 };
+
+  /// One planned crossover.
+  struct Cross {
+    genome_t * genomeA;
+    genome_t * genomeB;
+    size_t xpoint;        ///< SINGLE_PT
+    double pct1;          ///< TWO_PT (pct1 <= pct2)
+    double pct2;
+    CounterRandom masks;  ///< UNIFORM
+  };
+
+protected:
+  CROSSOVER_TYPES type;
+  emp::vector<Cross> plan;
+  emp::vector<SortingNetworkMutator> mutators;  ///< One per worker.
+
+public:
+  BatchCrossover() : type(SINGLE_PT), plan(), mutators() { ; }
+
+  /// Use _type crossovers, built with copies of mutator (configured with network size limits) on
+  /// up to num_workers workers. Reserves a plan for up to pop_size organisms.
+  void Configure(CROSSOVER_TYPES _type, const SortingNetworkMutator & mutator, size_t num_workers, size_t pop_size) {
+    type = _type;
+    mutators.assign(std::max<size_t>(1, num_workers), mutator);
+    plan.clear();
+    plan.reserve(pop_size / 2);
+  }
+
+  size_t GetNumPlanned() const { return plan.size(); }
+  const emp::vector<Cross> & GetPlan() const { return plan; }
+
+  /// Plan crossovers between the first num_orgs organisms in ids (genomes found with get_genome,
+  /// a size_t -> genome_t & function). Replaces any previous plan.
+  template<typename GET_GENOME_T>
+  void Plan(emp::Random & rnd, const emp::vector<size_t> & ids, size_t num_orgs, const GET_GENOME_T & get_genome) {
+    plan.clear();
+    num_orgs = std::min(num_orgs, ids.size());
+    for (size_t i = 0; i + 1 < num_orgs; i += 2) {
+      Cross cross;
+      cross.genomeA = &get_genome(ids[i]);
+      cross.genomeB = &get_genome(ids[i+1]);
+      cross.xpoint = 0;
+      cross.pct1 = 0.0;
+      cross.pct2 = 0.0;
+      switch (type) {
+        case CROSSOVER_TYPES::SINGLE_PT: {
+          cross.xpoint = rnd.GetUInt(emp::Min(cross.genomeA->GetSize(), cross.genomeB->GetSize()));
+          break;
+        }
+        case CROSSOVER_TYPES::TWO_PT: {
+          cross.pct1 = rnd.GetDouble();
+          cross.pct2 = rnd.GetDouble();
+          if (cross.pct2 < cross.pct1) std::swap(cross.pct1, cross.pct2);
+          break;
+        }
+        case CROSSOVER_TYPES::UNIFORM: {
+          cross.masks.Reseed(rnd);
+          break;
+        }
+      }
+      plan.emplace_back(cross);
+    }
+  }
+
+  /// Run planned crossovers (on pool's workers).
+  void Run(WorkerPool & pool) {
+    emp_assert(pool.GetNumWorkers() <= mutators.size(), pool.GetNumWorkers(), mutators.size());
+    pool.ParallelFor(plan.size(), [this](size_t id, size_t worker_id) {
+      const Cross & cross = plan[id];
+      switch (type) {
+        case CROSSOVER_TYPES::SINGLE_PT: {
+          SortingNetworkMutator::Crossover1Pt(cross.xpoint, *cross.genomeA, *cross.genomeB);
+          break;
+        }
+        case CROSSOVER_TYPES::TWO_PT: {
+          mutators[worker_id].Crossover2Pt(cross.pct1, cross.pct2, *cross.genomeA, *cross.genomeB);
+          break;
+        }
+        case CROSSOVER_TYPES::UNIFORM: {
+          SortingNetworkMutator::CrossoverUniform(cross.masks, *cross.genomeA, *cross.genomeB);
+          break;
+        }
+      }
+    });
+  }
+};
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+
+#include "base/vector.h"
+#include "tools/string_utils.h"
+
+#include "Checkpoint.h"
+#include "ExperimentLog.h"
+#include "Instrumentation.h"
+#include "TestCaseSet.h"
+
+/// Run many replicates (seeds) of an experiment in one process, one experiment instance per thread.
+/// - Each replicate is independent (own emp::Random, worlds, writers), so results match single-seed
+///   runs with the same configuration.
+/// - Parsed test case files are shared between replicates for the duration of the batch (see
+///   TestCaseFileCache).
+/// - While a replicate runs, its thread's console output goes to the replicate's log file, through
+///   the thread's own stream (see ExperimentLog.h). Stray std::cout output (e.g., from library
+///   code) is also redirected per thread (see BatchLogBuf), but shares std::cout's stream state.
+/// - In instrumented builds, each replicate has its own counters (see EXP_INSTRUMENT_SCOPE), so its
+///   timing.csv only counts its own work.
+
+/// Batch command line arguments (pulled out before emp::cl::ArgManager sees the rest).
+struct BatchArgs {
+  emp::vector<int> seeds;  ///< --seeds <first>-<last>[,<seed>...]
+  size_t threads;          ///< --threads <N> (default: hardware concurrency)
+  bool resume;             ///< --resume: resume each replicate from its checkpoint file, if it has one.
+
+  BatchArgs() : seeds(), threads(std::max(1u, std::thread::hardware_concurrency())), resume(false) { ; }
+};
+
+/// Parse seed list: comma-separated seeds and inclusive ranges (e.g., "1-100,150").
+inline emp::vector<int> ParseSeeds(const std::string & str) {
+  emp::vector<int> seeds;
+  for (const std::string & field : emp::slice(str, ',')) {
+    if (!field.size()) continue;
+    const size_t dash = field.find('-', 1);
+    if (dash == std::string::npos) {
+      seeds.emplace_back(std::stoi(field));
+      continue;
+    }
+    const int first = std::stoi(field.substr(0, dash));
+    const int last = std::stoi(field.substr(dash + 1));
+    for (int seed = first; seed <= last; ++seed) seeds.emplace_back(seed);
+  }
+  return seeds;
+}
+
+/// Pull batch arguments out of command line arguments (as ExtractResumeArg does).
+inline BatchArgs ExtractBatchArgs(int & argc, char* argv[]) {
+  BatchArgs batch;
+  int out_i = 0;
+  for (int i = 0; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    if (arg == "--seeds" && i + 1 < argc) { batch.seeds = ParseSeeds(argv[++i]); continue; }
+    if (arg == "--threads" && i + 1 < argc) { batch.threads = std::max(1, std::stoi(argv[++i])); continue; }
+    if (arg == "--resume") { batch.resume = true; continue; }
+    argv[out_i++] = argv[i];
+  }
+  argc = out_i;
+  return batch;
+}
+
+/// Output directory for one replicate (with trailing '/').
+inline std::string GetBatchSeedDir(const std::string & data_dir, int seed) {
+  return data_dir + "/seed_" + emp::to_string(seed) + "/";
+}
+
+/// Stream buffer that sends each thread's output to that thread's target (or to a default buffer).
+class BatchLogBuf : public std::streambuf {
+protected:
+  std::streambuf * fallback;
+
+  static std::streambuf *& Target() {
+    thread_local std::streambuf * target = nullptr;
+    return target;
+  }
+
+  std::streambuf * Get() const { return Target() ? Target() : fallback; }
+
+  int overflow(int c) override {
+    if (c == traits_type::eof()) return traits_type::not_eof(c);
+    return Get()->sputc(traits_type::to_char_type(c));
+  }
+  std::streamsize xsputn(const char * s, std::streamsize n) override { return Get()->sputn(s, n); }
+  int sync() override { return Get()->pubsync(); }
+
+public:
+  BatchLogBuf(std::streambuf * _fallback) : fallback(_fallback) { ; }
+
+  /// Send the calling thread's output to target (nullptr to send it to the default buffer).
+  static void SetTarget(std::streambuf * target) { Target() = target; }
+};
+
+/// Run run_seed(seed) for every seed in batch.seeds, batch.threads replicates at a time.
+/// - run_seed should call StartBatchLog first (to send the replicate's output to its log file).
+/// - After a SIGTERM (see Checkpoint.h), running replicates checkpoint and stop; no new replicates start.
+inline void RunBatch(const BatchArgs & batch, const std::function<void(int)> & run_seed) {
+  TestCaseFileCache::Scope test_case_cache;
+  std::streambuf * console = std::cout.rdbuf();
+  BatchLogBuf log_buf(console);
+  std::cout.rdbuf(&log_buf);
+  InstallCheckpointSignalHandlers();
+
+  std::atomic<size_t> next(0);
+  auto worker = [&batch, &run_seed, &next]() {
+    while (true) {
+      if (CheckpointSignal() == SIGTERM) break;
+      const size_t i = next++;
+      if (i >= batch.seeds.size()) break;
+      {
+        EXP_INSTRUMENT_SCOPE();
+        run_seed(batch.seeds[i]);
+      }
+      BatchLogBuf::SetTarget(nullptr);
+      SetExpLog(nullptr);
+    }
+  };
+  emp::vector<std::thread> threads;
+  const size_t num_threads = std::min(batch.threads, batch.seeds.size());
+  for (size_t t = 0; t < num_threads; ++t) threads.emplace_back(worker);
+  for (std::thread & thread : threads) thread.join();
+
+  std::cout.rdbuf(console);
+}
+
+/// Log the calling thread's output (until its replicate finishes) to fpath.
+inline void StartBatchLog(std::ofstream & log, const std::string & fpath) {
+  log.open(fpath);
+  BatchLogBuf::SetTarget(log.rdbuf());
+  SetExpLog(&log);
+}
+
+#endif
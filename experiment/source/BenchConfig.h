@@ -0,0 +1,34 @@
+#ifndef BENCH_CONFIG_H
+#define BENCH_CONFIG_H
+
+#include "config/config.h"
+
+EMP_BUILD_CONFIG(BenchConfig,
+  GROUP(DEFAULT_GROUP, "General settings"),
+  VALUE(SEED, int, 1, "Random number seed used by all benchmarks."),
+  VALUE(OUTPUT_FILE, std::string, "bench.json", "Where should we write benchmark results (JSON)?"),
+  VALUE(MIN_BENCH_TIME, double, 0.5, "Minimum number of seconds to spend on each micro benchmark."),
+
+  GROUP(TAGLGP_GROUP, "Settings for TagLGP instruction throughput benchmarks."),
+  VALUE(INST_PROG_LEN, size_t, 64, "How many copies of an instruction are in the program used to benchmark it?"),
+
+  GROUP(SORTING_NETWORK_GROUP, "Settings for sorting network benchmarks."),
+  VALUE(SORT_SIZE, size_t, 16, "Size of sequences being sorted."),
+  VALUE(NETWORK_SIZES, std::string, "8,16,32,64,128", "Comma-separated list of network sizes to benchmark SortingTest::Evaluate on."),
+  VALUE(SORTING_NETWORK_CONFIG, std::string, "sorting_network_configs.cfg", "Base sorting network configuration for RunStep benchmarks (read if it exists)."),
+  VALUE(NETWORK_SELECTION_MODES, std::string, "0,1,2", "Comma-separated list of SELECTION_MODEs to benchmark SortingNetworkExperiment::RunStep on (empty to skip; see SortingNetworkConfig)."),
+  VALUE(NETWORK_RUN_STEPS, size_t, 5, "How many (timed) RunSteps per sorting network selection mode?"),
+
+  GROUP(SELECTION_GROUP, "Settings for lexicase selection benchmarks."),
+  VALUE(LEXICASE_POP_SIZES, std::string, "256,1024", "Comma-separated list of population sizes."),
+  VALUE(LEXICASE_CASE_COUNTS, std::string, "32,256,1024", "Comma-separated list of test case counts."),
+
+  GROUP(PROG_SYNTH_GROUP, "Settings for full program synthesis RunStep benchmarks."),
+  VALUE(PROG_SYNTH_CONFIG, std::string, "prog_synth_configs.cfg", "Base program synthesis configuration (read if it exists)."),
+  VALUE(PROBLEMS, std::string, "number-io,small-or-large,for-loop-index,compare-string-lengths,collatz-numbers,string-lengths-backwards,last-index-of-zero,count-odds,mirror-image,vectors-summed,sum-of-squares,vector-average,median,smallest,grade", "Comma-separated list of problems to benchmark (empty to skip)."),
+  VALUE(EVALUATION_MODES, std::string, "0,1,2,3", "Comma-separated list of EVALUATION_MODEs to benchmark (see ProgSynthConfig)."),
+  VALUE(RUN_STEPS, size_t, 5, "How many (timed) RunSteps per problem/evaluation mode?"),
+  VALUE(BENCH_DATA_DIRECTORY, std::string, "./bench_output", "Where should benchmarked experiments dump their output files?")
+)
+
+#endif
@@ -10,6 +10,7 @@ EMP_BUILD_CONFIG(BitSorterConfig,
   VALUE(SORTER_POP_SIZE, size_t, 1024, "Population size for bit sorters"),
   VALUE(TEST_POP_SIZE, size_t, 1024, "Population size for test sorters"),
   VALUE(EVALUATION_MODE, size_t, 0, "How are programs evaluated? \n0: full (on all tests) \n1: cohorts "),
+  VALUE(SORTER_EVALUATION_METHOD, size_t, 2, "How is a sorter checked against its tests? \n0: one test at a time \n1: look tests up in the sorter's truth table (over all inputs; TEST_SIZE <= 20) \n2: auto (truth tables when a sorter sees enough tests to pay for building one)"),
   VALUE(TEST_MODE, size_t, 0, "How do tests change over time? \n0: co-evolution \n1: static (unchanging) \n2: random"),
 
   GROUP(SELECTION_GROUP, "Settings specific to selection (both tests and sorters)"),
@@ -31,6 +32,7 @@ EMP_BUILD_CONFIG(BitSorterConfig,
   VALUE(PER_PAIR_INS, double, 0.0005, "."),
   VALUE(PER_PAIR_DEL, double, 0.001, "."),
   VALUE(PER_PAIR_SWAP, double, 0.001, "."),
+  VALUE(MUTATION_SAMPLING_MODE, size_t, 1, "How are per-site mutations placed? \n0: One random draw per site (legacy random number stream; reproduces earlier runs)\n1: Skip ahead to the next mutated site (geometric gaps; same rates, fewer random draws)"),
 
   GROUP(TESTS_GROUP, "Settings specific to tests."),
   VALUE(TEST_SIZE, size_t, 16, "How many bits long are tests?"),
@@ -41,7 +43,10 @@ EMP_BUILD_CONFIG(BitSorterConfig,
   VALUE(PER_SEQ_RANDOMIZE, double, 0.01, "."),
 
   GROUP(DATA_COLLECTION_GROUP, "Settings specific to data collection"),
-  VALUE(SNAPSHOT_INTERVAL, size_t, 1000, "How often should we snapshot populations?")
+  VALUE(DATA_DIRECTORY, std::string, "./output", "Where to dump experiment data files"),
+  VALUE(SNAPSHOT_INTERVAL, size_t, 1000, "How often should we snapshot populations?"),
+  VALUE(CHECKPOINT_INTERVAL, size_t, 0, "How often should we checkpoint experiment state? (0 to only checkpoint on SIGTERM/SIGUSR1)"),
+  VALUE(CHECKPOINT_FILE, std::string, "checkpoint.bin", "Checkpoint file name (in DATA_DIRECTORY). Resume with --resume <file>.")
   
 )
 
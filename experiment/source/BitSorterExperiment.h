@@ -5,6 +5,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <utility>
@@ -26,6 +27,11 @@
 #include "Selection.h"
 #include "Mutators.h"
 #include "BitSorterMutators.h"
+#include "BitSorterTruthTable.h"
+#include "UniqueTestIndex.h"
+#include "ScoreMatrix.h"
+#include "Checkpoint.h"
+#include "Instrumentation.h"
 
 #include "BitSorterConfig.h"
 
@@ -33,6 +39,30 @@
 // - [ ] Setup crossover
 // - [ ] Setup data collection
 
+/// Checkpoint bit sorters as sequences of comparator index pairs.
+template<>
+struct CheckpointIO<emp::BitSorter> {
+  static void Write(std::ostream & out, const emp::BitSorter & sorter) {
+    emp::BitSorter copy(sorter); // GetComparator is not const.
+    CheckpointWrite(out, (uint64_t)copy.GetSize());
+    for (size_t i = 0; i < copy.GetSize(); ++i) {
+      const auto comparator = copy.GetComparator(i);
+      CheckpointWrite(out, (uint64_t)comparator.first);
+      CheckpointWrite(out, (uint64_t)comparator.second);
+    }
+  }
+  static void Read(std::istream & in, emp::BitSorter & sorter) {
+    uint64_t size = 0, a = 0, b = 0;
+    CheckpointRead(in, size);
+    sorter.Clear();
+    for (size_t i = 0; i < size; ++i) {
+      CheckpointRead(in, a);
+      CheckpointRead(in, b);
+      sorter.AddCompare((size_t)a, (size_t)b);
+    }
+  }
+};
+
 class BitSorterExperiment {
 public:
 
@@ -50,7 +80,9 @@ public:
   enum SELECTION_METHODS { LEXICASE=0, COHORT_LEXICASE=1, TOURNAMENT=2, DRIFT=3 };
   enum TEST_MODES { COEVOLVE=0, STATIC=1, RANDOM=2 };
   enum EVALUATION_MODES { FULL=0, COHORT=1 };
+  enum SORTER_EVALUATION_METHODS { PER_TEST=0, TRUTH_TABLE=1, AUTO=2 };
   enum SORTER_CROSSOVER_MODES { NONE=0, SINGLE_PT=1, TWO_PT=2 };
+  enum MUTATION_SAMPLING_MODES { PER_SITE_SAMPLING=0, SKIP_SAMPLING=1 };
 
 protected:
 
@@ -140,6 +172,7 @@ protected:
   size_t SORTER_POP_SIZE;
   size_t TEST_POP_SIZE;
   size_t EVALUATION_MODE;
+  size_t SORTER_EVALUATION_METHOD;
   size_t TEST_MODE;
 
   size_t SORTER_SELECTION_MODE;
@@ -158,6 +191,7 @@ protected:
   double PER_PAIR_INS;
   double PER_PAIR_DEL;
   double PER_PAIR_SWAP;
+  size_t MUTATION_SAMPLING_MODE;
 
   size_t TEST_SIZE;
 
@@ -165,7 +199,10 @@ protected:
   double PER_SEQ_INVERSION;
   double PER_SEQ_RANDOMIZE;
 
+  std::string DATA_DIRECTORY;
   size_t SNAPSHOT_INTERVAL;
+  size_t CHECKPOINT_INTERVAL;
+  std::string CHECKPOINT_FILE;
 
   //////////////////////////////////////////////////////////////////////////////
 
@@ -182,12 +219,21 @@ protected:
   size_t SORTER_EVAL_TESTCASE_CNT;
   size_t NUM_COHORTS;
 
+  bool use_truth_tables;                 ///< Evaluate sorters with truth tables (vs. one test at a time)?
+  BitSorterTruthTable sorter_truth_table;  ///< Truth table of the sorter being evaluated.
+  UniqueTestIndex<test_org_t::genome_t> test_index;  ///< Distinct tests in the test world (this generation).
+  UniqueTestResults<uint8_t> sorter_test_results;    ///< Sorter being evaluated against distinct tests.
+  ScoreMatrix<uint8_t> sorter_test_passes;  ///< Pass/fail of sorters (rows) against tests (columns); phenotypes view it.
+
   emp::Ptr<emp::Random> random;
 
   emp::Ptr<sorter_world_t> sorter_world;
   emp::Ptr<test_world_t> test_world;
 
   emp::Ptr<emp::DataFile> solution_file;
+#ifdef EXP_INSTRUMENT
+  emp::Ptr<InstrumentationFile> timing_file;   ///< Phase timing + counters (timing.csv).
+#endif
 
   Cohorts sorter_cohorts;
   Cohorts test_cohorts;
@@ -199,6 +245,9 @@ protected:
   BitSorterMutator sorter_mutator;
   BitTestMutator test_mutator;
 
+  CheckpointWriter checkpoint_writer;
+  CheckpointDataFiles data_files;   ///< Summary data files (appended to over the course of a run).
+
   struct StatsUtil {
     size_t sorterID;
     size_t testID;
@@ -220,6 +269,9 @@ protected:
   void InitTestPop_Random();    ///< Randomly initialize the test population.
 
   void SetupEvaluation();
+  void BeginSorterEvaluation(sorter_org_t & sorter);        ///< Prepare to evaluate sorter against tests.
+  bool TestSortable(sorter_org_t & sorter, size_t testID);  ///< Evaluate sorter (begun) against test in world position testID.
+  bool IsCorrect(sorter_org_t & sorter);                    ///< Does sorter sort every input?
   void SetupSelection();
   void SetupMutation();
   void SetupFitFuns();
@@ -237,12 +289,18 @@ protected:
   void SnapshotSorters();
   void SnapshotTests();
 
+  void WriteCheckpoint(std::ostream & out);  ///< Serialize experiment state (between generations).
+  void ReadCheckpoint(std::istream & in);    ///< Restore experiment state written by WriteCheckpoint.
+  bool DoCheckpoint();                       ///< Checkpoint if scheduled/requested. Return true if experiment should stop.
+
 public:
 
   BitSorterExperiment()
     : setup(false), update(0),
+      use_truth_tables(false), sorter_truth_table(),
+      test_index(), sorter_test_results(), sorter_test_passes(),
       sorter_cohorts(), test_cohorts(),
-      sorter_mutator(), test_mutator()
+      sorter_mutator(), test_mutator(), data_files()
   { ; }
 
   ~BitSorterExperiment() {
@@ -250,6 +308,9 @@ public:
       #ifndef EMSCRIPTEN
       solution_file.Delete();
       #endif
+      #ifdef EXP_INSTRUMENT
+      timing_file.Delete();
+      #endif
       sorter_world.Delete();
       test_world.Delete();
       random.Delete();
@@ -259,9 +320,14 @@ public:
   /// Configure the experiment using the given config object.
   void Setup(const BitSorterConfig & config);
 
-  /// Run the experiment start->finish
+  /// Configure the experiment, then restore its state from a checkpoint file (written by a previous
+  /// run with the same configuration).
+  void Resume(const BitSorterConfig & config, const std::string & checkpoint_fpath);
+
+  /// Run the experiment start->finish (or from the resumed update to finish)
   /// (1) Initialize population(s)
   /// (2) For each generation, RunStep()
+  /// (3) Checkpoint every CHECKPOINT_INTERVAL generations and on SIGUSR1; checkpoint and stop on SIGTERM.
   void Run();
 
   /// Progress experiment by a single time step (generation):
@@ -296,13 +362,27 @@ void BitSorterExperiment::Setup(const BitSorterConfig & config) {
   smallest_known_sol_size = MAX_NETWORK_SIZE + 1;
   solution_found = false;
 
+  // Make a data directory
+  mkdir(DATA_DIRECTORY.c_str(), ACCESSPERMS);
+  if (DATA_DIRECTORY.back() != '/') DATA_DIRECTORY += '/';
+
+  #ifdef EXP_INSTRUMENT
+  // Phase timing + counters (see Instrumentation.h).
+  timing_file = emp::NewPtr<InstrumentationFile>(DATA_DIRECTORY + "timing.csv", SNAPSHOT_INTERVAL);
+  data_files.Add(*timing_file);
+  #endif
+
   // How does the sorter world update?
   do_update_sig.AddAction([this]() {
     std::cout << "Update: " << update << ", ";
     std::cout << "best sorter (size=" << sorter_world->GetOrg(dominant_sorter_id).GetSize() << "): " << sorter_world->CalcFitnessID(dominant_sorter_id) << ", ";
-    std::cout << "solution? " << (size_t)solution_found << ", smallest solution size: " << smallest_known_sol_size << std::endl;
+    std::cout << "solution? " << (size_t)solution_found << ", smallest solution size: " << smallest_known_sol_size << ", ";
+    std::cout << "distinct tests: " << test_index.GetNumUnique() << std::endl;
 
-    if (update % SNAPSHOT_INTERVAL) do_snapshot_sig.Trigger();
+    if (update % SNAPSHOT_INTERVAL) {
+      EXP_INSTRUMENT_PHASE(SNAPSHOT);
+      do_snapshot_sig.Trigger();
+    }
 
     sorter_world->Update();
     sorter_world->ClearCache();
@@ -327,7 +407,7 @@ void BitSorterExperiment::Setup(const BitSorterConfig & config) {
         for (size_t i = 0; i < test_world->GetSize(); ++i) {
           emp_assert(test_world->IsOccupied(i));
           test_org_t & test_org = test_world->GetOrg(i);
-          test_org.GetPhenotype().Reset(test_org.GetPhenotype().test_passes.size());
+          test_org.GetPhenotype().Reset();
         }
       });
       break;
@@ -342,7 +422,7 @@ void BitSorterExperiment::Setup(const BitSorterConfig & config) {
         for (size_t i = 0; i < test_world->GetSize(); ++i) {
           emp_assert(test_world->IsOccupied(i));
           test_org_t & test_org = test_world->GetOrg(i);
-          test_org.GetPhenotype().Reset(test_org.GetPhenotype().test_passes.size());
+          test_org.GetPhenotype().Reset();
         }
       });
       break;
@@ -389,9 +469,73 @@ void BitSorterExperiment::Setup(const BitSorterConfig & config) {
 /// (1) Initialize population(s)
 /// (2) For each generation, RunStep()
 void BitSorterExperiment::Run() {
-  for (update = 0; update <= GENERATIONS; ++update) {
+  InstallCheckpointSignalHandlers();
+  for ( ; update <= GENERATIONS; ++update) {
     RunStep();
+    if (DoCheckpoint()) break;
   }
+  checkpoint_writer.Wait();
+}
+
+/// Configure the experiment and restore its state from a checkpoint.
+void BitSorterExperiment::Resume(const BitSorterConfig & config, const std::string & checkpoint_fpath) {
+  std::istringstream in(LoadCheckpointFile(checkpoint_fpath));
+  const size_t resume_update = ReadCheckpointHeader(in, "BitSorterExperiment", data_files);
+  Setup(config);
+  ReadCheckpoint(in);
+  if (!in) {
+    std::cout << "Failed to read checkpoint (" << checkpoint_fpath << "). Exiting." << std::endl;
+    exit(-1);
+  }
+  data_files.Resume();
+  update = resume_update;
+  std::cout << "Resumed from checkpoint (" << checkpoint_fpath << ") at update " << update << std::endl;
+}
+
+/// Serialize experiment state. Only valid between generations (after RunStep): phenotypes are reset
+/// every generation and cohorts are re-randomized each evaluation, so neither is saved.
+void BitSorterExperiment::WriteCheckpoint(std::ostream & out) {
+  CheckpointWrite(out, (uint64_t)smallest_known_sol_size);
+  CheckpointWrite(out, solution_found);
+  CheckpointWrite(out, (uint64_t)sorter_world->GetUpdate());
+  CheckpointWriteWorld(out, *sorter_world);
+  CheckpointWrite(out, (uint64_t)test_world->GetUpdate());
+  CheckpointWriteWorld(out, *test_world);
+  // Random number generator goes last.
+  CheckpointWrite(out, *random);
+}
+
+void BitSorterExperiment::ReadCheckpoint(std::istream & in) {
+  uint64_t val = 0;
+  CheckpointRead(in, val); smallest_known_sol_size = (size_t)val;
+  CheckpointRead(in, solution_found);
+  CheckpointRead(in, val);
+  CheckpointReadWorld(in, *sorter_world);
+  SetWorldUpdate(*sorter_world, (size_t)val);
+  CheckpointRead(in, val);
+  CheckpointReadWorld(in, *test_world);
+  SetWorldUpdate(*test_world, (size_t)val);
+  // Random number generator goes last.
+  CheckpointRead(in, *random);
+}
+
+bool BitSorterExperiment::DoCheckpoint() {
+  const int sig = TakeCheckpointSignal();
+  const bool scheduled = CHECKPOINT_INTERVAL && update && (update % CHECKPOINT_INTERVAL == 0);
+  if (!sig && !scheduled) return false;
+  const std::string checkpoint_fpath = DATA_DIRECTORY + CHECKPOINT_FILE;
+  std::cout << "Checkpointing at update " << update << " (" << checkpoint_fpath << ")" << std::endl;
+  // Serialize state now (so next generation can proceed); write it out in the background.
+  std::ostringstream out;
+  WriteCheckpointHeader(out, "BitSorterExperiment", update + 1, data_files);
+  WriteCheckpoint(out);
+  checkpoint_writer.Write(checkpoint_fpath, out.str());
+  if (sig == SIGTERM) {
+    checkpoint_writer.Wait();
+    std::cout << "SIGTERM received; stopping after checkpoint." << std::endl;
+    return true;
+  }
+  return false;
 }
 
 /// Progress experiment by a single time step (generation):
@@ -400,11 +544,23 @@ void BitSorterExperiment::Run() {
 /// - (3) Update the worlds
 void BitSorterExperiment::RunStep() {
   // std::cout << "-- Doing Evaluation --" << std::endl;
-  do_evaluation_sig.Trigger();
+  {
+    EXP_INSTRUMENT_PHASE(EVALUATION);
+    do_evaluation_sig.Trigger();
+  }
   // std::cout << "-- Doing Selection --" << std::endl;
-  do_selection_sig.Trigger();
+  {
+    EXP_INSTRUMENT_PHASE(SELECTION);
+    do_selection_sig.Trigger();
+  }
   // std::cout << "-- Doing Update --" << std::endl;
-  do_update_sig.Trigger();
+  {
+    EXP_INSTRUMENT_PHASE(UPDATE);
+    do_update_sig.Trigger();
+  }
+  #ifdef EXP_INSTRUMENT
+  timing_file->EndStep(update);
+  #endif
 }
 
 void BitSorterExperiment::InitConfigs(const BitSorterConfig & config) {
@@ -415,6 +571,7 @@ void BitSorterExperiment::InitConfigs(const BitSorterConfig & config) {
   SORTER_POP_SIZE = config.SORTER_POP_SIZE();
   TEST_POP_SIZE = config.TEST_POP_SIZE();
   EVALUATION_MODE = config.EVALUATION_MODE();
+  SORTER_EVALUATION_METHOD = config.SORTER_EVALUATION_METHOD();
   TEST_MODE = config.TEST_MODE();
 
   SORTER_SELECTION_MODE = config.SORTER_SELECTION_MODE();
@@ -433,6 +590,7 @@ void BitSorterExperiment::InitConfigs(const BitSorterConfig & config) {
   PER_PAIR_INS = config.PER_PAIR_INS();
   PER_PAIR_DEL = config.PER_PAIR_DEL();
   PER_PAIR_SWAP = config.PER_PAIR_SWAP();
+  MUTATION_SAMPLING_MODE = config.MUTATION_SAMPLING_MODE();
 
   TEST_SIZE = config.TEST_SIZE();
 
@@ -440,7 +598,10 @@ void BitSorterExperiment::InitConfigs(const BitSorterConfig & config) {
   PER_SEQ_INVERSION = config.PER_SEQ_INVERSION();
   PER_SEQ_RANDOMIZE = config.PER_SEQ_RANDOMIZE();
 
+  DATA_DIRECTORY = config.DATA_DIRECTORY();
   SNAPSHOT_INTERVAL = config.SNAPSHOT_INTERVAL();
+  CHECKPOINT_INTERVAL = config.CHECKPOINT_INTERVAL();
+  CHECKPOINT_FILE = config.CHECKPOINT_FILE();
 
   emp_assert(TEST_SIZE <= 32);
 }
@@ -448,6 +609,39 @@ void BitSorterExperiment::InitConfigs(const BitSorterConfig & config) {
 /// 
 void BitSorterExperiment::SetupEvaluation() {
   std::cout << "How do we evaluate sorting networks against tests?" << std::endl;
+  // One test at a time, or by looking tests up in each sorter's truth table?
+  const size_t tests_per_sorter = (EVALUATION_MODE == EVALUATION_MODES::COHORT) ? TEST_COHORT_SIZE : TEST_POP_SIZE;
+  switch (SORTER_EVALUATION_METHOD) {
+    case (size_t)SORTER_EVALUATION_METHODS::PER_TEST: {
+      use_truth_tables = false;
+      break;
+    }
+    case (size_t)SORTER_EVALUATION_METHODS::TRUTH_TABLE: {
+      if (TEST_SIZE > BitSorterTruthTable::MAX_INPUT_BITS) {
+        std::cout << "Truth table evaluation requires TEST_SIZE <= " << (size_t)BitSorterTruthTable::MAX_INPUT_BITS << ". Exiting." << std::endl;
+        exit(-1);
+      }
+      use_truth_tables = true;
+      break;
+    }
+    case (size_t)SORTER_EVALUATION_METHODS::AUTO: {
+      use_truth_tables = TEST_SIZE <= BitSorterTruthTable::MAX_INPUT_BITS
+                         && tests_per_sorter >= BitSorterTruthTable::GetBreakEvenTests(TEST_SIZE);
+      break;
+    }
+    default: {
+      std::cout << "Unknown SORTER_EVALUATION_METHOD (" << SORTER_EVALUATION_METHOD << "). Exiting." << std::endl;
+      exit(-1);
+    }
+  }
+  if (use_truth_tables) std::cout << "  => Evaluate sorters with truth tables (" << tests_per_sorter << " tests per sorter)." << std::endl;
+  else std::cout << "  => Evaluate sorters one test at a time (" << tests_per_sorter << " tests per sorter; duplicate tests evaluated once)." << std::endl;
+  // Group identical tests before evaluating (duplicates accumulate under coevolution).
+  do_evaluation_sig.AddAction([this]() {
+    test_index.Build(test_world->GetSize(),
+                     [this](size_t testID) -> const test_org_t::genome_t & { return test_world->GetOrg(testID).GetGenome(); },
+                     [](const test_org_t::genome_t & test) { return (uint64_t)test; });
+  });
   switch (EVALUATION_MODE) {
     case (size_t)EVALUATION_MODES::COHORT: {
       std::cout << "  => Evaluate in cohorts." << std::endl;
@@ -466,8 +660,11 @@ void BitSorterExperiment::SetupEvaluation() {
       MAX_SORTER_PASSES = TEST_COHORT_SIZE;
       std::cout << "Max number of test passes achievable by a sorting network = " << MAX_SORTER_PASSES << std::endl;
       // Setup world to reset phenotypes on organism placement.
-      sorter_world->OnPlacement([this](size_t pos) { sorter_world->GetOrg(pos).GetPhenotype().Reset(TEST_COHORT_SIZE); });
-      test_world->OnPlacement([this](size_t pos) { test_world->GetOrg(pos).GetPhenotype().Reset(SORTER_COHORT_SIZE); });
+      sorter_world->OnPlacement([this](size_t pos) { sorter_world->GetOrg(pos).GetPhenotype().Reset(); });
+      test_world->OnPlacement([this](size_t pos) { test_world->GetOrg(pos).GetPhenotype().Reset(); });
+      // Passes are stored by cohort slot: row (cohortID * SORTER_COHORT_SIZE + sorterID), column
+      // testID. Each test's passes are its column within its cohort's rows.
+      sorter_test_passes.Resize(SORTER_COHORT_SIZE * sorter_cohorts.GetCohortCnt(), TEST_COHORT_SIZE);
       // What should happen on evaluation?
       do_evaluation_sig.AddAction([this]() {
         // Randomize cohorts.
@@ -475,20 +672,28 @@ void BitSorterExperiment::SetupEvaluation() {
         test_cohorts.Randomize(*random);
         // For each cohort, evaluate all sorters against all tests in cohort.
         for (size_t cohortID = 0; cohortID < sorter_cohorts.GetCohortCnt(); ++cohortID) {
+          const size_t row_begin = cohortID * SORTER_COHORT_SIZE;
+          for (size_t testID = 0; testID < TEST_COHORT_SIZE; ++testID) {
+            test_world->GetOrg(test_cohorts.GetWorldID(cohortID, testID)).GetPhenotype().Reset(sorter_test_passes.GetColumn(testID, row_begin, SORTER_COHORT_SIZE));
+          }
           for (size_t sorterID = 0; sorterID < SORTER_COHORT_SIZE; ++sorterID) {
             // Test this sorter against all tests in associated cohort.
             sorter_org_t & sorter_org = sorter_world->GetOrg(sorter_cohorts.GetWorldID(cohortID, sorterID)); 
+            sorter_org.GetPhenotype().Reset(sorter_test_passes.GetRow(row_begin + sorterID));
+            BeginSorterEvaluation(sorter_org);
             for (size_t testID = 0; testID < TEST_COHORT_SIZE; ++testID) {
               // Evaluate this test against current sorter org.
-              test_org_t & test_org = test_world->GetOrg(test_cohorts.GetWorldID(cohortID, testID));
+              const size_t test_world_id = test_cohorts.GetWorldID(cohortID, testID);
+              test_org_t & test_org = test_world->GetOrg(test_world_id);
               // Evaluate!
-              bool can_sort = sorter_org.GetGenome().TestSortable(test_org.GetGenome());
+              bool can_sort = TestSortable(sorter_org, test_world_id);
+              sorter_test_passes(row_begin + sorterID, testID) = (uint8_t)can_sort;
               // Update sorter phenotype
-              sorter_org.GetPhenotype().RecordPassFail(testID, can_sort);
-              sorter_org.GetPhenotype().RecordScore(testID, (double)can_sort);
+              sorter_org.GetPhenotype().RecordPassFail(can_sort);
+              sorter_org.GetPhenotype().RecordScore((double)can_sort);
               // Update test phenotype
-              test_org.GetPhenotype().RecordPassFail(sorterID, can_sort);
-              test_org.GetPhenotype().RecordScore(sorterID, !can_sort); // Score here is 1 if not sorted, 0 if sorted.
+              test_org.GetPhenotype().RecordPassFail(can_sort);
+              test_org.GetPhenotype().RecordScore(!can_sort); // Score here is 1 if not sorted, 0 if sorted.
             }
           }
         } 
@@ -498,23 +703,31 @@ void BitSorterExperiment::SetupEvaluation() {
     case (size_t)EVALUATION_MODES::FULL: {
       std::cout << "  => Evaluate against full test population." << std::endl;
       // Setup world to reset phenotypes on organism placement
-      sorter_world->OnPlacement([this](size_t pos) { sorter_world->GetOrg(pos).GetPhenotype().Reset(TEST_POP_SIZE); });
-      test_world->OnPlacement([this](size_t pos) { test_world->GetOrg(pos).GetPhenotype().Reset(SORTER_POP_SIZE); });
+      sorter_world->OnPlacement([this](size_t pos) { sorter_world->GetOrg(pos).GetPhenotype().Reset(); });
+      test_world->OnPlacement([this](size_t pos) { test_world->GetOrg(pos).GetPhenotype().Reset(); });
       MAX_SORTER_PASSES = TEST_POP_SIZE;
       // What should happen on evaluation?
       do_evaluation_sig.AddAction([this]() {
+        // Passes are stored by world position: row sorterID, column testID.
+        sorter_test_passes.Resize(sorter_world->GetSize(), test_world->GetSize());
+        for (size_t testID = 0; testID < test_world->GetSize(); ++testID) {
+          test_world->GetOrg(testID).GetPhenotype().Reset(sorter_test_passes.GetColumn(testID));
+        }
         for (size_t sorterID = 0; sorterID < sorter_world->GetSize(); ++sorterID) {
           sorter_org_t & sorter_org = sorter_world->GetOrg(sorterID);
+          sorter_org.GetPhenotype().Reset(sorter_test_passes.GetRow(sorterID));
+          BeginSorterEvaluation(sorter_org);
           for (size_t testID = 0; testID < test_world->GetSize(); ++testID) {
             test_org_t & test_org = test_world->GetOrg(testID);
             // Evaluate sorter and test.
-            bool can_sort = sorter_org.GetGenome().TestSortable(test_org.GetGenome());
+            bool can_sort = TestSortable(sorter_org, testID);
+            sorter_test_passes(sorterID, testID) = (uint8_t)can_sort;
             // Update sorter phenotype
-            sorter_org.GetPhenotype().RecordPassFail(testID, can_sort);
-            sorter_org.GetPhenotype().RecordScore(testID, (double)can_sort);
+            sorter_org.GetPhenotype().RecordPassFail(can_sort);
+            sorter_org.GetPhenotype().RecordScore((double)can_sort);
             // Update test phenotype
-            test_org.GetPhenotype().RecordPassFail(sorterID, can_sort);
-            test_org.GetPhenotype().RecordScore(sorterID, !can_sort); // Score here is 1 if not sorted, 0 if sorted.
+            test_org.GetPhenotype().RecordPassFail(can_sort);
+            test_org.GetPhenotype().RecordScore(!can_sort); // Score here is 1 if not sorted, 0 if sorted.
           }
         }
       });
@@ -543,7 +756,12 @@ void BitSorterExperiment::SetupEvaluation() {
       // At this point, sorting networks have been evaluated against all tests.
       if (pass_total == MAX_SORTER_PASSES && sorter_org.GetGenome().GetSize() < smallest_known_sol_size) {
         stats_util.sorterID = sID;
-        if (sorter_org.GetGenome().IsCorrect(TEST_SIZE)) {
+        bool is_correct = false;
+        {
+          EXP_INSTRUMENT_PHASE(SCREEN);
+          is_correct = IsCorrect(sorter_org);
+        }
+        if (is_correct) {
           solution_found = true;
           smallest_known_sol_size = sorter_org.GetGenome().GetSize();
           // Add to solutions file.
@@ -554,6 +772,40 @@ void BitSorterExperiment::SetupEvaluation() {
   });
 }
 
+void BitSorterExperiment::BeginSorterEvaluation(sorter_org_t & sorter) {
+  if (!use_truth_tables) {
+    sorter_test_results.Begin(test_index.GetNumUnique());
+    return;
+  }
+  sorter_truth_table.Build(sorter.GetGenome(), TEST_SIZE);
+  EXP_INSTRUMENT_COUNT(COMPARATOR_OPS, sorter.GetGenome().GetSize() * BitSorterTruthTable::GetNumWords(TEST_SIZE));
+}
+
+/// With truth tables, every test is a lookup. Otherwise, each distinct test is evaluated once per
+/// sorter, and duplicates reuse its result (see UniqueTestIndex).
+bool BitSorterExperiment::TestSortable(sorter_org_t & sorter, size_t testID) {
+  const test_org_t::genome_t & test = test_world->GetOrg(testID).GetGenome();
+  if (use_truth_tables) {
+    EXP_INSTRUMENT_COUNT(TESTS_EVALUATED, 1);
+    const bool can_sort = sorter_truth_table.TestSortable(test);
+    emp_assert(can_sort == sorter.GetGenome().TestSortable(test), test);
+    return can_sort;
+  }
+  return (bool)sorter_test_results.Get(test_index.GetUniqueID(testID), [&sorter, &test]() {
+    EXP_INSTRUMENT_COUNT(TESTS_EVALUATED, 1);
+    EXP_INSTRUMENT_COUNT(COMPARATOR_OPS, sorter.GetGenome().GetSize());
+    return (uint8_t)sorter.GetGenome().TestSortable(test);
+  });
+}
+
+/// Checks every input with a truth table when TEST_SIZE allows (whatever the evaluation method;
+/// a table is always cheaper than checking inputs one at a time).
+bool BitSorterExperiment::IsCorrect(sorter_org_t & sorter) {
+  if (TEST_SIZE > BitSorterTruthTable::MAX_INPUT_BITS) return sorter.GetGenome().IsCorrect(TEST_SIZE);
+  sorter_truth_table.Build(sorter.GetGenome(), TEST_SIZE);
+  return sorter_truth_table.IsCorrect();
+}
+
 void BitSorterExperiment::SetupSelection() {
   SetupSorterSelection();
   if (TEST_MODE == TEST_MODES::COEVOLVE) { SetupTestSelection(); }
@@ -568,7 +820,7 @@ void BitSorterExperiment::SetupSorterSelection() {
       // For lexicase selection, one function for every test.
       for (size_t i = 0; i < TEST_POP_SIZE; ++i) {
         lexicase_sorter_fit_set.push_back([this, i](sorter_org_t & sorter) {
-          return sorter.GetPhenotype().test_scores[i];
+          return (double)sorter.GetPhenotype().test_passes[i];
         });
       }
       // Add one function for size.
@@ -593,7 +845,7 @@ void BitSorterExperiment::SetupSorterSelection() {
       // For lexicase selection, one function for every test.
       for (size_t i = 0; i < TEST_COHORT_SIZE; ++i) {
         lexicase_sorter_fit_set.push_back([this, i](sorter_org_t & sorter) {
-          return sorter.GetPhenotype().test_scores[i];
+          return (double)sorter.GetPhenotype().test_passes[i];
         });
       }
       // Add one function for size.
@@ -643,7 +895,7 @@ void BitSorterExperiment::SetupTestSelection() {
       emp_assert(EVALUATION_MODE == EVALUATION_MODES::FULL);
       for (size_t i = 0; i < SORTER_POP_SIZE; ++i) {
         lexicase_test_fit_set.push_back([i](test_org_t & test) { 
-          return 1 - test.GetPhenotype().test_passes[i]; // Max if test_pass[i] = 0
+          return 1 - (size_t)test.GetPhenotype().test_passes[i]; // Max if test_pass[i] = 0
         });
       }
       do_selection_sig.AddAction([this]() {
@@ -658,7 +910,7 @@ void BitSorterExperiment::SetupTestSelection() {
       emp_assert(EVALUATION_MODE == EVALUATION_MODES::COHORT);
       for (size_t i = 0; i < SORTER_COHORT_SIZE; ++i) {
         lexicase_test_fit_set.push_back([i](test_org_t & test) { 
-          return 1 - test.GetPhenotype().test_passes[i]; // Max if test_pass[i] = 0
+          return 1 - (size_t)test.GetPhenotype().test_passes[i]; // Max if test_pass[i] = 0
         });
       }
       do_selection_sig.AddAction([this]() {
@@ -716,6 +968,7 @@ void BitSorterExperiment::SetupSorterMutation() {
   sorter_mutator.PER_PAIR_INS = PER_PAIR_INS;
   sorter_mutator.PER_PAIR_DEL = PER_PAIR_DEL;
   sorter_mutator.PER_PAIR_SWAP = PER_PAIR_SWAP;
+  sorter_mutator.skip_sampling = MUTATION_SAMPLING_MODE == (size_t)MUTATION_SAMPLING_MODES::SKIP_SAMPLING;
 
   if (PER_SORTER_MUTATION) {
     sorter_world->SetMutFun([this](sorter_org_t & sorter_org, emp::Random & rnd) {
@@ -741,6 +994,7 @@ void BitSorterExperiment::SetupTestMutation() { // todo - if test mode == random
   test_mutator.PER_BIT_FLIP = PER_BIT_FLIP;
   test_mutator.PER_SEQ_INVERSION = PER_SEQ_INVERSION;
   test_mutator.PER_SEQ_RANDOMIZE = PER_SEQ_RANDOMIZE;
+  test_mutator.skip_sampling = MUTATION_SAMPLING_MODE == (size_t)MUTATION_SAMPLING_MODES::SKIP_SAMPLING;
   if (TEST_MODE == TEST_MODES::RANDOM) {
     test_world->SetMutFun([this](test_org_t & test, emp::Random & rnd) {
       test.SetGenome(rnd.GetUInt(0, 1 << TEST_SIZE));  // Randomize genome
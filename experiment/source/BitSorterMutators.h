@@ -8,6 +8,7 @@
 #include "SortingNetworkOrg.h"
 #include "SortingTestOrg.h"
 #include "SortingTest.h"
+#include "SiteSampler.h"
 
 #include "TagLinearGP.h"
 #include "TagLinearGP_Utilities.h"
@@ -29,6 +30,8 @@ struct BitSorterMutator {
   double PER_PAIR_DEL;
   double PER_PAIR_SWAP;
 
+  bool skip_sampling;       ///< Skip to mutated sites (SiteSampler)? Otherwise, draw once per site (legacy random number stream).
+
   BitSorterMutator() 
     : MAX_NETWORK_SIZE(64),
       MIN_NETWORK_SIZE(1),
@@ -37,62 +40,105 @@ struct BitSorterMutator {
       PER_PAIR_DUP(0.001),
       PER_PAIR_INS(0.001),
       PER_PAIR_DEL(0.001),
-      PER_PAIR_SWAP(0.001)
+      PER_PAIR_SWAP(0.001),
+      skip_sampling(false)
   { ; }
 
+  /// Mutate genome.
+  /// - Comparators are only extracted (into the scratch network, reused across calls) once the first
+  ///   mutation happens; the bit sorter is rebuilt from the scratch network only if it was mutated.
   size_t Mutate(emp::Random & rnd, genome_t & genome) {
     size_t muts = 0;
-    emp::vector<std::pair<size_t, size_t>> sorting_network; // Extract bit sorter into more convenient form for mutating?
+    emp::vector<std::pair<size_t, size_t>> & sorting_network = scratch; // Extract bit sorter into more convenient form for mutating?
+    bool rebuild = false;   // Have we started extracting the (mutated) bit sorter?
     size_t expected_size = genome.GetSize();
+
+    // Start extracting the bit sorter (with its first comp_cnt comparators).
+    auto begin_rebuild = [&genome, &sorting_network, &rebuild](size_t comp_cnt) {
+      sorting_network.clear();
+      for (size_t i = 0; i < comp_cnt; ++i) sorting_network.emplace_back(genome.GetComparator(i));
+      rebuild = true;
+    };
+
+    // Sites: comparators for deletions/insertions/duplications, comparator indices (2 per comparator) for substitutions.
+    SiteSampler del_sites, ins_sites, dup_sites, sub_sites;
+    if (skip_sampling) {
+      del_sites.Start(rnd, PER_PAIR_DEL);
+      ins_sites.Start(rnd, PER_PAIR_INS);
+      dup_sites.Start(rnd, PER_PAIR_DUP);
+      sub_sites.Start(rnd, PER_INDEX_SUB);
+    }
     for (size_t i = 0; i < genome.GetSize(); ++i) {
       // Deletions!
-      if (rnd.P(PER_PAIR_DEL) && (expected_size > MIN_NETWORK_SIZE)) {
+      const bool del = skip_sampling ? del_sites.Hit(rnd, i) : rnd.P(PER_PAIR_DEL);
+      if (del && (expected_size > MIN_NETWORK_SIZE)) {
+        if (!rebuild) begin_rebuild(i);
         ++muts;
         --expected_size;
         continue;
       }
       // Copy over.
-      const size_t whead = sorting_network.size();
-      sorting_network.emplace_back(genome.GetComparator(i));
+      const size_t whead = rebuild ? sorting_network.size() : i;
+      if (rebuild) sorting_network.emplace_back(genome.GetComparator(i));
       // Do we insert?
-      if (rnd.P(PER_PAIR_INS) && (expected_size < MAX_NETWORK_SIZE)) {
+      const bool ins = skip_sampling ? ins_sites.Hit(rnd, i) : rnd.P(PER_PAIR_INS);
+      if (ins && (expected_size < MAX_NETWORK_SIZE)) {
+        if (!rebuild) begin_rebuild(i + 1);
         ++muts;
         ++expected_size;
         // Insert randomly
         sorting_network.emplace_back(std::pair<size_t,size_t>{rnd.GetUInt(0, SORT_SEQ_SIZE), rnd.GetUInt(0, SORT_SEQ_SIZE)});
       }
       // Do we duplicate?
-      if (rnd.P(PER_PAIR_DUP) && (expected_size < MAX_NETWORK_SIZE)) {
+      const bool dup = skip_sampling ? dup_sites.Hit(rnd, i) : rnd.P(PER_PAIR_DUP);
+      if (dup && (expected_size < MAX_NETWORK_SIZE)) {
+        if (!rebuild) begin_rebuild(i + 1);
         ++muts;
         ++expected_size;
         // Duplicate!
         sorting_network.emplace_back(genome.GetComparator(i));
       }
       // Per-index substitutions?
-      if (rnd.P(PER_INDEX_SUB)) {
+      if (skip_sampling ? sub_sites.Hit(rnd, 2*i) : rnd.P(PER_INDEX_SUB)) {
+        if (!rebuild) begin_rebuild(i + 1);
         sorting_network[whead].first = rnd.GetUInt(0, SORT_SEQ_SIZE);
         ++muts;
       }
-      if (rnd.P(PER_INDEX_SUB)) {
+      if (skip_sampling ? sub_sites.Hit(rnd, 2*i + 1) : rnd.P(PER_INDEX_SUB)) {
+        if (!rebuild) begin_rebuild(i + 1);
         sorting_network[whead].second = rnd.GetUInt(0, SORT_SEQ_SIZE);
         ++muts;
       }
     }
     // How about swaps?
-    if (PER_PAIR_SWAP > 0) {
-      for (size_t i = 0; i < sorting_network.size(); ++i) {
+    const size_t network_size = rebuild ? sorting_network.size() : genome.GetSize();
+    if (PER_PAIR_SWAP > 0 && skip_sampling) {
+      SiteSampler swap_sites;
+      swap_sites.Start(rnd, PER_PAIR_SWAP);
+      for (size_t i = swap_sites.Next(); i < network_size; i = swap_sites.Take(rnd)) {
+        const size_t pos = rnd.GetUInt(network_size);
+        if (pos == i) continue;
+        if (!rebuild) begin_rebuild(network_size);
+        std::swap(sorting_network[i], sorting_network[pos]);
+        ++muts;
+      }
+    } else if (PER_PAIR_SWAP > 0) {
+      for (size_t i = 0; i < network_size; ++i) {
         if (rnd.P(PER_PAIR_SWAP)) {
           // Select two random positions
-          const size_t pos = rnd.GetUInt(sorting_network.size());
+          const size_t pos = rnd.GetUInt(network_size);
           if (pos == i) continue;
+          if (!rebuild) begin_rebuild(network_size);
           std::swap(sorting_network[i], sorting_network[pos]);
           ++muts;
         }
       }
     }
     // Update genome with mutated network!
-    genome.Clear();
-    for (std::pair<size_t,size_t> & comp : sorting_network) genome.AddCompare(comp.first, comp.second);
+    if (rebuild) {
+      genome.Clear();
+      for (std::pair<size_t,size_t> & comp : sorting_network) genome.AddCompare(comp.first, comp.second);
+    }
     return muts;
   }
 
@@ -106,6 +152,9 @@ struct BitSorterMutator {
     }
     return rando_sorter;
   }
+
+protected:
+  emp::vector<std::pair<size_t, size_t>> scratch;  ///< Reused by Mutate (one mutator per thread).
 };
 
 // Note - look at the BitSorter ToString method to build bitvectors to mutate
@@ -119,11 +168,14 @@ struct BitTestMutator {
   double PER_SEQ_INVERSION;
   double PER_SEQ_RANDOMIZE;
 
+  bool skip_sampling;   ///< Skip to mutated sites (SiteSampler)? Otherwise, draw once per site (legacy random number stream).
+
   BitTestMutator()
     : NUM_BITS(16),
       PER_BIT_FLIP(0.001),
       PER_SEQ_INVERSION(0.01),
-      PER_SEQ_RANDOMIZE(0.01)
+      PER_SEQ_RANDOMIZE(0.01),
+      skip_sampling(false)
   { ; }
 
   size_t Mutate(emp::Random & rnd, genome_t & genome) {
@@ -138,11 +190,20 @@ struct BitTestMutator {
     emp::BitVector bit_vec(emp::BitSorter::ToBitVector(genome, NUM_BITS));
     
     // Per-site bit flips
-    for (size_t i = 0; i < bit_vec.GetSize(); ++i) {
-      if (rnd.P(PER_BIT_FLIP)) {
+    if (skip_sampling) {
+      SiteSampler flip_sites;
+      flip_sites.Start(rnd, PER_BIT_FLIP);
+      for (size_t i = flip_sites.Next(); i < bit_vec.GetSize(); i = flip_sites.Take(rnd)) {
         ++muts;
         bit_vec.Set(i, !bit_vec.Get(i));
       }
+    } else {
+      for (size_t i = 0; i < bit_vec.GetSize(); ++i) {
+        if (rnd.P(PER_BIT_FLIP)) {
+          ++muts;
+          bit_vec.Set(i, !bit_vec.Get(i));
+        }
+      }
     }
 
     // TODO - test inversions!
@@ -7,38 +7,34 @@
 
 #include "hardware/BitSorter.h"
 
+#include "ScoreMatrix.h"
+
 class BitSorterOrg {
 public:
 
   struct Phenotype {
-    emp::vector<double> test_scores;
+    ScoreView<uint8_t> test_passes; ///< Pass (1) or fail (0) against each test, which is also the per-test score. (Row of the experiment's pass matrix.)
     double total_score;
-    
-    emp::vector<size_t> test_passes;
-    
+
     size_t num_passes;
     size_t num_fails;
 
-    void Reset(size_t s=0) {
-      test_scores.clear();
-      test_scores.resize(s, 0);
-      total_score = 0;
-
-      test_passes.clear();
-      test_passes.resize(s, 0);
+    Phenotype() : test_passes(), total_score(0), num_passes(0), num_fails(0) { ; }
 
+    /// Bind to this evaluation's passes (unbound by default).
+    void Reset(const ScoreView<uint8_t> & passes=ScoreView<uint8_t>()) {
+      test_passes = passes;
+      total_score = 0;
       num_passes = 0;
       num_fails = 0;
     }
 
-    void RecordPassFail(size_t testID, bool pass) {
-      test_passes[testID] = (size_t)pass;
+    void RecordPassFail(bool pass) {
       if (pass) ++num_passes;
       else ++num_fails;
     }
 
-    void RecordScore(size_t testID, double score) {
-      test_scores[testID] = score;
+    void RecordScore(double score) {
       total_score += score;
     }
   };
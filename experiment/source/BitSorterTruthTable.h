@@ -0,0 +1,127 @@
+#ifndef BIT_SORTER_TRUTH_TABLE_H
+#define BIT_SORTER_TRUTH_TABLE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+#include "hardware/BitSorter.h"
+
+/// Which of the 2^num_bits possible inputs a bit sorter sorts, with every input evaluated in one
+/// pass over the network.
+/// - Inputs are bitsliced: wire w of the network is a 2^num_bits-bit vector whose bit x is bit w of
+///   input x, stored as 64-bit words. Each comparator is then two word operations per 64 inputs
+///   (the lower wire gets the OR, the higher wire the AND -- ones move to the lower position).
+/// - An output is sorted when its ones are all at the low positions (no wire holds a 0 where the
+///   wire above it holds a 1), so the result is a 'sortable' bitmask over inputs: any test is a
+///   bit lookup, and IsCorrect is a popcount.
+/// - Building costs about GetSize() * 2^num_bits / 64 word operations (in blocks that vectorize),
+///   roughly what evaluating 2^num_bits / 256 tests one at a time costs: it pays off when a sorter
+///   is checked against at least that many tests (see GetBreakEvenTests), and always for IsCorrect.
+/// - Tables are reused: rebuilding for another sorter allocates nothing.
+class BitSorterTruthTable {
+public:
+  using test_t = uint32_t;
+
+  static constexpr size_t MAX_INPUT_BITS = 20;  ///< Largest supported table: 2^20 bits (128KB).
+  static constexpr size_t MAX_WIRES = 32;       ///< Wires in an emp::BitSorter (bits in test_t).
+
+protected:
+  static constexpr size_t BLOCK_WORDS = 4;      ///< Words processed together (vectorizes).
+
+  size_t num_bits;
+  emp::vector<uint64_t> sortable;               ///< Bit x is set if input x is sorted.
+  emp::vector<std::pair<uint8_t, uint8_t>> network;  ///< (low, high) wire of each comparator.
+
+  /// Bitsliced wire w over inputs [64*word, 64*word + 64).
+  static uint64_t InputWire(size_t w, size_t word) {
+    static constexpr uint64_t patterns[6] = { 0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL,
+                                              0xF0F0F0F0F0F0F0F0ULL, 0xFF00FF00FF00FF00ULL,
+                                              0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL };
+    if (w < 6) return patterns[w];
+    return ((word >> (w - 6)) & 1) ? ~0ULL : 0ULL;
+  }
+
+public:
+  BitSorterTruthTable() : num_bits(0), sortable(), network() { ; }
+
+  /// Number of 64-bit words in a table over num_bits-bit inputs.
+  static size_t GetNumWords(size_t num_bits) {
+    return (num_bits < 6) ? 1 : ((size_t)1 << (num_bits - 6));
+  }
+
+  /// Number of tests a sorter must be checked against for building its table (over num_bits-bit
+  /// inputs) to cost less than evaluating the tests one at a time.
+  static size_t GetBreakEvenTests(size_t num_bits) {
+    return std::max<size_t>(1, GetNumWords(num_bits) / 4);
+  }
+
+  size_t GetNumBits() const { return num_bits; }
+  size_t GetNumInputs() const { return (size_t)1 << num_bits; }
+
+  /// Build the table for sorter over all _num_bits-bit inputs (sorter isn't modified;
+  /// emp::BitSorter::GetComparator is not const).
+  void Build(emp::BitSorter & sorter, size_t _num_bits) {
+    emp_assert(_num_bits <= MAX_INPUT_BITS, _num_bits);
+    num_bits = _num_bits;
+    // Copy comparators out of their bitmasks once, and find how many wires they touch.
+    size_t num_wires = num_bits;
+    network.resize(sorter.GetSize());
+    for (size_t i = 0; i < network.size(); ++i) {
+      const std::pair<size_t, size_t> comparator = sorter.GetComparator(i);
+      const size_t lo = std::min(comparator.first, comparator.second);
+      const size_t hi = std::max(comparator.first, comparator.second);
+      emp_assert(hi < MAX_WIRES, hi);
+      network[i] = { (uint8_t)lo, (uint8_t)hi };
+      num_wires = std::max(num_wires, hi + 1);
+    }
+    // Wires past num_bits are 0 on every input.
+    const size_t num_words = GetNumWords(num_bits);
+    sortable.resize(num_words);
+    uint64_t wires[MAX_WIRES][BLOCK_WORDS];
+    for (size_t block = 0; block < num_words; block += BLOCK_WORDS) {
+      for (size_t w = 0; w < num_wires; ++w) {
+        for (size_t k = 0; k < BLOCK_WORDS; ++k) wires[w][k] = (w < num_bits) ? InputWire(w, block + k) : 0;
+      }
+      for (const auto & comparator : network) {
+        uint64_t * lo = wires[comparator.first];
+        uint64_t * hi = wires[comparator.second];
+        for (size_t k = 0; k < BLOCK_WORDS; ++k) {
+          const uint64_t lo_val = lo[k];
+          lo[k] = lo_val | hi[k];
+          hi[k] = lo_val & hi[k];
+        }
+      }
+      uint64_t sorted[BLOCK_WORDS];
+      for (size_t k = 0; k < BLOCK_WORDS; ++k) sorted[k] = ~0ULL;
+      for (size_t w = 0; w + 1 < num_wires; ++w) {
+        for (size_t k = 0; k < BLOCK_WORDS; ++k) sorted[k] &= wires[w][k] | ~wires[w+1][k];
+      }
+      const size_t block_words = (num_words - block < BLOCK_WORDS) ? num_words - block : BLOCK_WORDS;
+      for (size_t k = 0; k < block_words; ++k) sortable[block + k] = sorted[k];
+    }
+    // Drop inputs past 2^num_bits (small tables share one word).
+    if (num_bits < 6) sortable[0] &= ((uint64_t)1 << GetNumInputs()) - 1;
+  }
+
+  /// Does the sorter sort input? (Same result as emp::BitSorter::TestSortable.)
+  bool TestSortable(test_t input) const {
+    emp_assert(input < GetNumInputs(), input, num_bits);
+    return (sortable[input >> 6] >> (input & 63)) & 1;
+  }
+
+  /// Number of inputs the sorter sorts.
+  size_t CountSortable() const {
+    size_t count = 0;
+    for (uint64_t word : sortable) count += (size_t)__builtin_popcountll(word);
+    return count;
+  }
+
+  /// Does the sorter sort every input?
+  bool IsCorrect() const { return CountSortable() == GetNumInputs(); }
+};
+
+#endif
@@ -0,0 +1,471 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <array>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <unistd.h>
+
+#include "base/assert.h"
+#include "base/vector.h"
+#include "tools/BitSet.h"
+#include "tools/Random.h"
+#include "tools/string_utils.h"
+#include "data/DataFile.h"
+#include "Evolve/World.h"
+
+#include "ExperimentLog.h"
+#include "Instrumentation.h"
+
+/// Binary checkpoint utilities (shared by all experiments).
+/// - CheckpointWrite/CheckpointRead (de)serialize values in native byte order; checkpoints are
+///   meant to be read back by the same binary on the same kind of machine.
+/// - Checkpoint files start with a header (see WriteCheckpointHeader) describing the experiment,
+///   the update to resume at, and the size of each summary data file at checkpoint time (see
+///   CheckpointDataFiles).
+
+constexpr uint32_t CHECKPOINT_VERSION = 2;
+const std::string CHECKPOINT_MAGIC = "EXPCKPT";
+
+// ---- Serialization ----
+
+template<typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type
+CheckpointWrite(std::ostream & out, const T & val) {
+  out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template<typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type
+CheckpointRead(std::istream & in, T & val) {
+  in.read(reinterpret_cast<char*>(&val), sizeof(T));
+}
+
+inline void CheckpointWrite(std::ostream & out, const std::string & str) {
+  CheckpointWrite(out, (uint64_t)str.size());
+  out.write(str.data(), str.size());
+}
+
+inline void CheckpointRead(std::istream & in, std::string & str) {
+  uint64_t size = 0;
+  CheckpointRead(in, size);
+  str.resize(size);
+  if (size) in.read(&str[0], size);
+}
+
+template<size_t NUM_BITS>
+void CheckpointWrite(std::ostream & out, const emp::BitSet<NUM_BITS> & bits) {
+  for (size_t i = 0; i < NUM_BITS; ++i) CheckpointWrite(out, (uint8_t)bits.Get(i));
+}
+
+template<size_t NUM_BITS>
+void CheckpointRead(std::istream & in, emp::BitSet<NUM_BITS> & bits) {
+  for (size_t i = 0; i < NUM_BITS; ++i) {
+    uint8_t bit = 0;
+    CheckpointRead(in, bit);
+    bits.Set(i, (bool)bit);
+  }
+}
+
+template<typename T1, typename T2>
+void CheckpointWrite(std::ostream & out, const std::pair<T1, T2> & val);
+template<typename T1, typename T2>
+void CheckpointRead(std::istream & in, std::pair<T1, T2> & val);
+template<typename T, size_t N>
+void CheckpointWrite(std::ostream & out, const std::array<T, N> & val);
+template<typename T, size_t N>
+void CheckpointRead(std::istream & in, std::array<T, N> & val);
+template<typename T>
+void CheckpointWrite(std::ostream & out, const emp::vector<T> & val);
+template<typename T>
+void CheckpointRead(std::istream & in, emp::vector<T> & val);
+
+template<typename T1, typename T2>
+void CheckpointWrite(std::ostream & out, const std::pair<T1, T2> & val) {
+  CheckpointWrite(out, val.first);
+  CheckpointWrite(out, val.second);
+}
+
+template<typename T1, typename T2>
+void CheckpointRead(std::istream & in, std::pair<T1, T2> & val) {
+  CheckpointRead(in, val.first);
+  CheckpointRead(in, val.second);
+}
+
+template<typename T, size_t N>
+void CheckpointWrite(std::ostream & out, const std::array<T, N> & val) {
+  for (const T & elem : val) CheckpointWrite(out, elem);
+}
+
+template<typename T, size_t N>
+void CheckpointRead(std::istream & in, std::array<T, N> & val) {
+  for (T & elem : val) CheckpointRead(in, elem);
+}
+
+template<typename T>
+void CheckpointWrite(std::ostream & out, const emp::vector<T> & val) {
+  CheckpointWrite(out, (uint64_t)val.size());
+  for (size_t i = 0; i < val.size(); ++i) CheckpointWrite(out, val[i]);
+}
+
+template<typename T>
+void CheckpointRead(std::istream & in, emp::vector<T> & val) {
+  uint64_t size = 0;
+  CheckpointRead(in, size);
+  val.resize(size);
+  for (size_t i = 0; i < val.size(); ++i) {
+    T elem;
+    CheckpointRead(in, elem);
+    val[i] = std::move(elem);
+  }
+}
+
+/// Random number generator state is saved byte-for-byte.
+inline void CheckpointWrite(std::ostream & out, const emp::Random & rnd) {
+  static_assert(std::is_trivially_copyable<emp::Random>::value, "Random number generator state must be trivially copyable to checkpoint it.");
+  out.write(reinterpret_cast<const char*>(&rnd), sizeof(emp::Random));
+}
+
+inline void CheckpointRead(std::istream & in, emp::Random & rnd) {
+  in.read(reinterpret_cast<char*>(&rnd), sizeof(emp::Random));
+}
+
+/// Serialization hook for genome types. Specialize for genome types that CheckpointWrite/CheckpointRead
+/// do not handle (e.g., next to the organism class that uses them).
+template<typename T>
+struct CheckpointIO {
+  static void Write(std::ostream & out, const T & val) { CheckpointWrite(out, val); }
+  static void Read(std::istream & in, T & val) { CheckpointRead(in, val); }
+};
+
+// ---- Worlds ----
+
+/// Save the genomes (in population order) of every organism in a (fully occupied) world.
+template<typename ORG_T>
+void CheckpointWriteWorld(std::ostream & out, emp::World<ORG_T> & world) {
+  CheckpointWrite(out, (uint64_t)world.GetSize());
+  for (size_t i = 0; i < world.GetSize(); ++i) {
+    emp_assert(world.IsOccupied(i));
+    CheckpointIO<typename ORG_T::genome_t>::Write(out, world.GetGenomeAt(i));
+  }
+}
+
+/// Replace a world's population with genomes saved by CheckpointWriteWorld.
+/// - Organisms are (re)injected in saved order, so placement signals fire as they would for
+///   newly born organisms (e.g., resetting phenotypes).
+/// - Phenotypes are not saved: experiments only checkpoint between generations, when phenotypes
+///   have just been reset.
+/// - World must already be populated (saved genomes are read into copies of its first genome,
+///   e.g., so that programs keep their instruction library).
+template<typename ORG_T>
+void CheckpointReadWorld(std::istream & in, emp::World<ORG_T> & world) {
+  emp_assert(world.GetSize() && world.IsOccupied(0));
+  const typename ORG_T::genome_t genome_template(world.GetGenomeAt(0));
+  uint64_t size = 0;
+  CheckpointRead(in, size);
+  world.Clear();
+  for (size_t i = 0; i < size; ++i) {
+    typename ORG_T::genome_t genome(genome_template);
+    CheckpointIO<typename ORG_T::genome_t>::Read(in, genome);
+    world.Inject(genome, 1);
+  }
+}
+
+/// Set a world's update counter (used when resuming; emp::World does not expose a setter).
+template<typename ORG_T>
+void SetWorldUpdate(emp::World<ORG_T> & world, size_t update) {
+  struct UpdateAccess : public emp::World<ORG_T> {
+    static size_t emp::World<ORG_T>::* Member() { return &UpdateAccess::update; }
+  };
+  world.*(UpdateAccess::Member()) = update;
+}
+
+// ---- Solution screeners ----
+
+/// Save what a SolutionScreener has screened (see SolutionScreener::GetState), with write_record
+/// (a (std::ostream &, const record_t &) function) saving solutions not yet drained.
+template<typename SCREENER_T, typename WRITE_RECORD_T>
+void CheckpointWriteScreener(std::ostream & out, SCREENER_T & screener, const WRITE_RECORD_T & write_record) {
+  emp::vector<uint64_t> accepted;
+  emp::vector<uint64_t> rejected;
+  emp::vector<typename SCREENER_T::record_t> confirmed;
+  screener.GetState(accepted, rejected, confirmed);
+  CheckpointWrite(out, accepted);
+  CheckpointWrite(out, rejected);
+  CheckpointWrite(out, (uint64_t)confirmed.size());
+  for (const auto & rec : confirmed) write_record(out, rec);
+}
+
+/// Restore a (configured) SolutionScreener saved by CheckpointWriteScreener, with read_record (a
+/// std::istream & -> record_t function).
+template<typename SCREENER_T, typename READ_RECORD_T>
+void CheckpointReadScreener(std::istream & in, SCREENER_T & screener, const READ_RECORD_T & read_record) {
+  emp::vector<uint64_t> accepted;
+  emp::vector<uint64_t> rejected;
+  emp::vector<typename SCREENER_T::record_t> confirmed;
+  uint64_t size = 0;
+  CheckpointRead(in, accepted);
+  CheckpointRead(in, rejected);
+  CheckpointRead(in, size);
+  for (size_t i = 0; i < size && in; ++i) confirmed.emplace_back(read_record(in));
+  if (in) screener.SetState(accepted, rejected, std::move(confirmed));
+}
+
+// ---- Checkpoint header/data files ----
+
+/// Size (in bytes) of file at fpath (0 if it does not exist).
+inline uint64_t GetCheckpointFileSize(const std::string & fpath) {
+  std::ifstream file(fpath, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) return 0;
+  return (uint64_t)file.tellg();
+}
+
+/// Flush an emp::DataFile (emp::DataFile does not expose its stream).
+inline void FlushDataFile(emp::DataFile & file) {
+  struct StreamAccess : public emp::DataFile {
+    static std::ostream * emp::DataFile::* Member() { return &StreamAccess::os; }
+  };
+  (file.*(StreamAccess::Member()))->flush();
+}
+
+/// Point an emp::DataFile (opened by file name) at the end of the file at fpath.
+inline void ReopenDataFileForAppend(emp::DataFile & file, const std::string & fpath) {
+  struct StreamAccess : public emp::DataFile {
+    static std::ostream * emp::DataFile::* Member() { return &StreamAccess::os; }
+  };
+  std::ostream *& os = file.*(StreamAccess::Member());
+  delete os;
+  os = new std::ofstream(fpath, std::ios::app);
+}
+
+/// Summary data files (appended to over the course of a run) that checkpoints record the size of.
+/// - Writing a checkpoint flushes every file and records its size.
+/// - Resuming truncates every file to its recorded size (rows written after the checkpoint are
+///   regenerated by the resumed run) and sets it aside while experiment setup recreates its data
+///   files (which truncates them); Resume then puts the files back and reopens them for appending.
+/// Files are registered (with Add) as experiment setup creates them.
+class CheckpointDataFiles {
+protected:
+  struct File {
+    std::string fpath;
+    std::function<void()> flush;
+    std::function<void()> reopen;   ///< Reopen fpath for appending.
+  };
+
+  emp::vector<File> files;
+  emp::vector<std::string> set_aside;   ///< Files set aside by Read (until Resume).
+
+  static std::string GetSetAsidePath(const std::string & fpath) { return fpath + ".resume"; }
+
+public:
+  CheckpointDataFiles() : files(), set_aside() { ; }
+
+  void Add(const std::string & fpath, const std::function<void()> & flush, const std::function<void()> & reopen) {
+    files.emplace_back(File{fpath, flush, reopen});
+  }
+
+  /// Register a data file opened by file name (at fpath).
+  void Add(emp::DataFile & file, const std::string & fpath) {
+    Add(fpath, [&file]() { FlushDataFile(file); }, [&file, fpath]() { ReopenDataFileForAppend(file, fpath); });
+  }
+
+  /// Register a data file with GetFilename, Flush, and ReopenForAppend (e.g., ColumnarWriter,
+  /// InstrumentationFile).
+  template<typename FILE_T>
+  void Add(FILE_T & file) {
+    Add(file.GetFilename(), [&file]() { file.Flush(); }, [&file]() { file.ReopenForAppend(); });
+  }
+
+  size_t GetSize() const { return files.size(); }
+
+  void Flush() const {
+    for (const File & file : files) file.flush();
+  }
+
+  /// Flush every file, then write its path and size.
+  void Write(std::ostream & out) const {
+    Flush();
+    CheckpointWrite(out, (uint64_t)files.size());
+    for (const File & file : files) {
+      CheckpointWrite(out, file.fpath);
+      CheckpointWrite(out, GetCheckpointFileSize(file.fpath));
+    }
+  }
+
+  /// Read paths and sizes; truncate each file to its size and set it aside.
+  void Read(std::istream & in) {
+    uint64_t num_files = 0;
+    CheckpointRead(in, num_files);
+    for (size_t i = 0; i < num_files && in; ++i) {
+      std::string fpath;
+      uint64_t size = 0;
+      CheckpointRead(in, fpath);
+      CheckpointRead(in, size);
+      const uint64_t cur_size = GetCheckpointFileSize(fpath);
+      if (cur_size < size) {
+        ExpLog() << "Data file (" << fpath << ") is shorter than at checkpoint (" << cur_size << " < " << size << " bytes). Exiting." << std::endl;
+        exit(-1);
+      }
+      if (!size) continue; // Nothing to keep; setup recreates the file.
+      const std::string aside_fpath = GetSetAsidePath(fpath);
+      if (truncate(fpath.c_str(), (off_t)size) != 0 || std::rename(fpath.c_str(), aside_fpath.c_str()) != 0) {
+        ExpLog() << "Failed to truncate data file (" << fpath << ") to checkpoint. Exiting." << std::endl;
+        exit(-1);
+      }
+      set_aside.emplace_back(fpath);
+    }
+  }
+
+  /// Put files set aside by Read back, and reopen them for appending (call after setup has
+  /// recreated the data files).
+  void Resume() {
+    for (const std::string & fpath : set_aside) {
+      if (std::rename(GetSetAsidePath(fpath).c_str(), fpath.c_str()) != 0) {
+        ExpLog() << "Failed to restore data file (" << fpath << "). Exiting." << std::endl;
+        exit(-1);
+      }
+      for (const File & file : files) {
+        if (file.fpath == fpath) file.reopen();
+      }
+    }
+    set_aside.clear();
+  }
+};
+
+inline void WriteCheckpointHeader(std::ostream & out, const std::string & exp_name, size_t update,
+                                  const CheckpointDataFiles & data_files) {
+  out.write(CHECKPOINT_MAGIC.data(), CHECKPOINT_MAGIC.size());
+  CheckpointWrite(out, CHECKPOINT_VERSION);
+  CheckpointWrite(out, exp_name);
+  CheckpointWrite(out, (uint64_t)update);
+  data_files.Write(out);
+}
+
+/// Read checkpoint header (truncating and setting aside data files; see CheckpointDataFiles).
+/// Return the update to resume at.
+inline size_t ReadCheckpointHeader(std::istream & in, const std::string & exp_name, CheckpointDataFiles & data_files) {
+  std::string magic(CHECKPOINT_MAGIC.size(), ' ');
+  in.read(&magic[0], magic.size());
+  uint32_t version = 0;
+  CheckpointRead(in, version);
+  std::string name;
+  CheckpointRead(in, name);
+  if (!in || magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION || name != exp_name) {
+    ExpLog() << "Invalid checkpoint (expected a version " << CHECKPOINT_VERSION << " " << exp_name << " checkpoint). Exiting." << std::endl;
+    exit(-1);
+  }
+  uint64_t update = 0;
+  CheckpointRead(in, update);
+  data_files.Read(in);
+  return (size_t)update;
+}
+
+/// Read an entire checkpoint file into memory.
+inline std::string LoadCheckpointFile(const std::string & fpath) {
+  std::ifstream file(fpath, std::ios::binary);
+  if (!file.is_open()) {
+    ExpLog() << "Failed to open checkpoint file (" << fpath << "). Exiting." << std::endl;
+    exit(-1);
+  }
+  std::ostringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+
+// ---- Asynchronous writes ----
+
+/// Writes checkpoints to disk on a background thread so that the generation loop only pays for
+/// serializing state into memory. Files are written to a temporary path then renamed, so an
+/// existing checkpoint is never left half-written.
+class CheckpointWriter {
+protected:
+  std::thread writer;
+
+public:
+  CheckpointWriter() : writer() { ; }
+  CheckpointWriter(const CheckpointWriter &) = delete;
+  CheckpointWriter & operator=(const CheckpointWriter &) = delete;
+  ~CheckpointWriter() { Wait(); }
+
+  /// Block until any in-progress write is done.
+  void Wait() { if (writer.joinable()) writer.join(); }
+
+  /// Write data to fpath in the background (after any in-progress write finishes).
+  void Write(const std::string & fpath, std::string && data) {
+    Wait();
+    std::ostream * log = &ExpLog(); // Report failures on the caller's stream, not the writer thread's.
+    writer = std::thread(InstrumentThread([fpath, log](const std::string & buffer) {
+      const std::string tmp_fpath = fpath + ".tmp";
+      std::ofstream out(tmp_fpath, std::ios::binary);
+      out.write(buffer.data(), buffer.size());
+      out.close();
+      if (!out || std::rename(tmp_fpath.c_str(), fpath.c_str()) != 0) {
+        *log << "Failed to write checkpoint (" << fpath << ")." << std::endl;
+      }
+    }), std::move(data));
+  }
+};
+
+// ---- Signals ----
+
+/// Most recent checkpoint signal received (0 if none).
+/// - SIGUSR1: checkpoint at the end of the current generation, then keep going.
+/// - SIGTERM: checkpoint at the end of the current generation, then stop.
+inline volatile std::sig_atomic_t & CheckpointSignal() {
+  static volatile std::sig_atomic_t sig = 0;
+  return sig;
+}
+
+/// Number of checkpoint signals received.
+inline volatile std::sig_atomic_t & CheckpointSignalCount() {
+  static volatile std::sig_atomic_t count = 0;
+  return count;
+}
+
+extern "C" inline void CheckpointSignalHandler(int sig) {
+  CheckpointSignal() = sig;
+  CheckpointSignalCount() = CheckpointSignalCount() + 1;
+}
+
+inline void InstallCheckpointSignalHandlers() {
+  std::signal(SIGTERM, CheckpointSignalHandler);
+  std::signal(SIGUSR1, CheckpointSignalHandler);
+}
+
+/// Return the most recent checkpoint signal if the calling thread hasn't taken it yet (0 otherwise).
+/// - Signals are taken per thread so that every experiment in a batch run (one per thread; see
+///   BatchRunner.h) checkpoints.
+inline int TakeCheckpointSignal() {
+  thread_local std::sig_atomic_t taken = 0;
+  const std::sig_atomic_t count = CheckpointSignalCount();
+  if (count == taken) return 0;
+  taken = count;
+  return CheckpointSignal();
+}
+
+/// Pull '--resume <checkpoint file>' out of command line arguments (before they are handed off
+/// to emp::cl::ArgManager). Return checkpoint file name ("" if not resuming).
+inline std::string ExtractResumeArg(int & argc, char* argv[]) {
+  std::string resume_fpath;
+  int out_i = 0;
+  for (int i = 0; i < argc; ++i) {
+    if (std::string(argv[i]) == "--resume" && i + 1 < argc) {
+      resume_fpath = argv[++i];
+      continue;
+    }
+    argv[out_i++] = argv[i];
+  }
+  argc = out_i;
+  return resume_fpath;
+}
+
+#endif
@@ -0,0 +1,675 @@
+#ifndef COLUMNAR_FILE_H
+#define COLUMNAR_FILE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+// ============================================================================
+// Columnar binary data files (.col)
+// - Optional alternative to CSV output for population snapshots and solution files.
+// - Rows are buffered into blocks; each block stores each column contiguously, encoded with
+//   whichever of that column type's encodings is smallest for the block.
+// - Programs are stored as instruction ID/argument tag arrays (not text); instruction names and
+//   tag width are stored once, in the file metadata.
+// - Blocks are appended as they fill up, so files can be read (and resumed) block-by-block.
+// - Use ColumnarReader (or native/columnar_export.cc) to read files/export them to CSV.
+//
+// File layout (integers are LEB128 varints unless noted):
+//   magic (8 bytes: "EXPCOLF\0"), version
+//   column count, then per column: name, type (1 byte)
+//   metadata count, then per entry: key, value
+//   blocks (until end of file), each: row count, then per column: encoding (1 byte), byte count, bytes
+//   (strings are stored as length + bytes)
+// ============================================================================
+
+constexpr char COLUMNAR_MAGIC[8] = {'E', 'X', 'P', 'C', 'O', 'L', 'F', '\0'};
+constexpr uint64_t COLUMNAR_VERSION = 1;
+
+enum class ColumnType : uint8_t { UINT=0, INT=1, DOUBLE=2, STRING=3, UINT_LIST=4, PROGRAM=5 };
+enum class ColumnEncoding : uint8_t { PLAIN=0, VARINT=1, VARINT_DELTA=2, RLE=3, DICT=4, BITS=5 };
+
+/// Single program instruction: instruction ID + argument tags (packed into integers, bit i = tag bit i).
+struct ColumnarInst {
+  uint64_t id;
+  emp::vector<uint64_t> arg_tags;
+};
+using ColumnarProgram = emp::vector<ColumnarInst>;
+
+/// Convert a tag-based program (e.g., TagLGP programs) into its columnar representation.
+template<typename PROGRAM_T>
+ColumnarProgram MakeColumnarProgram(const PROGRAM_T & prog) {
+  ColumnarProgram cprog(prog.GetSize());
+  for (size_t i = 0; i < prog.GetSize(); ++i) {
+    cprog[i].id = prog[i].id;
+    for (const auto & tag : prog[i].arg_tags) {
+      emp_assert(tag.GetSize() <= 64);
+      uint64_t packed = 0;
+      for (size_t b = 0; b < tag.GetSize(); ++b) if (tag.Get(b)) packed |= ((uint64_t)1 << b);
+      cprog[i].arg_tags.emplace_back(packed);
+    }
+  }
+  return cprog;
+}
+
+/// Convert a list of integers/bools into a list-of-integers column value.
+template<typename T>
+emp::vector<uint64_t> MakeColumnarList(const emp::vector<T> & vals) {
+  emp::vector<uint64_t> list(vals.size());
+  for (size_t i = 0; i < vals.size(); ++i) list[i] = (uint64_t)vals[i];
+  return list;
+}
+
+// ---- Encoding utilities ----
+
+inline void ColumnarPutVarint(std::string & buf, uint64_t val) {
+  while (val >= 0x80) { buf.push_back((char)(val | 0x80)); val >>= 7; }
+  buf.push_back((char)val);
+}
+
+/// Read varint from buf at pos (advancing pos). Sets pos past the end of buf on malformed input.
+inline uint64_t ColumnarGetVarint(const std::string & buf, size_t & pos) {
+  uint64_t val = 0;
+  for (size_t shift = 0; shift < 64; shift += 7) {
+    if (pos >= buf.size()) break;
+    const uint8_t byte = (uint8_t)buf[pos++];
+    val |= (uint64_t)(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return val;
+  }
+  pos = buf.size() + 1;
+  return 0;
+}
+
+inline void ColumnarPutString(std::string & buf, const std::string & str) {
+  ColumnarPutVarint(buf, str.size());
+  buf += str;
+}
+
+inline std::string ColumnarGetString(const std::string & buf, size_t & pos) {
+  const uint64_t len = ColumnarGetVarint(buf, pos);
+  if (pos > buf.size() || len > buf.size() - pos) { pos = buf.size() + 1; return ""; }
+  std::string str(buf, pos, len);
+  pos += len;
+  return str;
+}
+
+inline uint64_t ColumnarZigZag(int64_t val) { return ((uint64_t)val << 1) ^ (uint64_t)(val >> 63); }
+inline int64_t ColumnarUnZigZag(uint64_t val) { return (int64_t)(val >> 1) ^ -(int64_t)(val & 1); }
+
+inline uint64_t ColumnarDoubleBits(double val) { uint64_t bits; std::memcpy(&bits, &val, sizeof(bits)); return bits; }
+inline double ColumnarBitsDouble(uint64_t bits) { double val; std::memcpy(&val, &bits, sizeof(val)); return val; }
+
+/// Encode a sequence of integers with the given encoding (PLAIN, VARINT, VARINT_DELTA, or RLE).
+inline std::string ColumnarEncodeUInts(const emp::vector<uint64_t> & vals, ColumnEncoding enc) {
+  std::string buf;
+  switch (enc) {
+    case ColumnEncoding::PLAIN: {
+      buf.resize(vals.size() * sizeof(uint64_t));
+      if (vals.size()) std::memcpy(&buf[0], vals.data(), buf.size());
+      break;
+    }
+    case ColumnEncoding::VARINT: {
+      for (uint64_t val : vals) ColumnarPutVarint(buf, val);
+      break;
+    }
+    case ColumnEncoding::VARINT_DELTA: {
+      uint64_t prev = 0;
+      for (uint64_t val : vals) { ColumnarPutVarint(buf, ColumnarZigZag((int64_t)(val - prev))); prev = val; }
+      break;
+    }
+    case ColumnEncoding::RLE: {
+      for (size_t i = 0; i < vals.size(); ) {
+        size_t run = 1;
+        while (i + run < vals.size() && vals[i + run] == vals[i]) ++run;
+        ColumnarPutVarint(buf, vals[i]);
+        ColumnarPutVarint(buf, run);
+        i += run;
+      }
+      break;
+    }
+    default: emp_assert(false, "Bad integer encoding"); break;
+  }
+  return buf;
+}
+
+/// Encode integers using whichever integer encoding is smallest.
+inline std::string ColumnarEncodeUIntsBest(const emp::vector<uint64_t> & vals, ColumnEncoding & enc_out) {
+  std::string best;
+  bool first = true;
+  for (ColumnEncoding enc : {ColumnEncoding::PLAIN, ColumnEncoding::VARINT, ColumnEncoding::VARINT_DELTA, ColumnEncoding::RLE}) {
+    std::string buf(ColumnarEncodeUInts(vals, enc));
+    if (first || buf.size() < best.size()) { best = std::move(buf); enc_out = enc; first = false; }
+  }
+  return best;
+}
+
+/// Decode count integers. Return false on malformed input.
+inline bool ColumnarDecodeUInts(const std::string & buf, ColumnEncoding enc, size_t count, emp::vector<uint64_t> & vals) {
+  vals.clear();
+  vals.reserve(count);
+  size_t pos = 0;
+  switch (enc) {
+    case ColumnEncoding::PLAIN: {
+      if (buf.size() != count * sizeof(uint64_t)) return false;
+      vals.resize(count);
+      if (count) std::memcpy(vals.data(), buf.data(), buf.size());
+      return true;
+    }
+    case ColumnEncoding::VARINT: {
+      while (vals.size() < count && pos < buf.size()) vals.emplace_back(ColumnarGetVarint(buf, pos));
+      break;
+    }
+    case ColumnEncoding::VARINT_DELTA: {
+      uint64_t prev = 0;
+      while (vals.size() < count && pos < buf.size()) {
+        prev += (uint64_t)ColumnarUnZigZag(ColumnarGetVarint(buf, pos));
+        vals.emplace_back(prev);
+      }
+      break;
+    }
+    case ColumnEncoding::RLE: {
+      while (vals.size() < count && pos < buf.size()) {
+        const uint64_t val = ColumnarGetVarint(buf, pos);
+        const uint64_t run = ColumnarGetVarint(buf, pos);
+        if (run > count - vals.size()) return false;
+        vals.resize(vals.size() + run, val);
+      }
+      break;
+    }
+    default: return false;
+  }
+  return vals.size() == count && pos == buf.size();
+}
+
+// ---- Column data ----
+
+/// Values for one column (of a single block). Only the container matching type is used.
+struct ColumnData {
+  ColumnType type;
+  emp::vector<uint64_t> uints;                ///< UINT, INT (zigzag), DOUBLE (bits)
+  emp::vector<std::string> strings;           ///< STRING
+  emp::vector<emp::vector<uint64_t>> lists;   ///< UINT_LIST
+  emp::vector<ColumnarProgram> programs;      ///< PROGRAM
+
+  ColumnData(ColumnType _type=ColumnType::UINT) : type(_type) { ; }
+
+  size_t GetSize() const {
+    switch (type) {
+      case ColumnType::STRING: return strings.size();
+      case ColumnType::UINT_LIST: return lists.size();
+      case ColumnType::PROGRAM: return programs.size();
+      default: return uints.size();
+    }
+  }
+
+  void Clear() { uints.clear(); strings.clear(); lists.clear(); programs.clear(); }
+
+  uint64_t GetUInt(size_t row) const { return uints[row]; }
+  int64_t GetInt(size_t row) const { return ColumnarUnZigZag(uints[row]); }
+  double GetDouble(size_t row) const { return ColumnarBitsDouble(uints[row]); }
+  const std::string & GetString(size_t row) const { return strings[row]; }
+  const emp::vector<uint64_t> & GetList(size_t row) const { return lists[row]; }
+  const ColumnarProgram & GetProgram(size_t row) const { return programs[row]; }
+
+  /// Encode column values (picking the smallest encoding); return encoded bytes.
+  std::string Encode(ColumnEncoding & enc) const {
+    switch (type) {
+      case ColumnType::STRING: {
+        std::string plain, dict;
+        // Dictionary encoding: unique strings (in order of appearance), then per-row indices.
+        emp::vector<std::string> entries;
+        emp::vector<uint64_t> ids;
+        std::unordered_map<std::string, uint64_t> lookup;
+        for (const std::string & str : strings) {
+          ColumnarPutString(plain, str);
+          auto it = lookup.find(str);
+          if (it == lookup.end()) { it = lookup.emplace(str, entries.size()).first; entries.emplace_back(str); }
+          ids.emplace_back(it->second);
+        }
+        ColumnarPutVarint(dict, entries.size());
+        for (const std::string & str : entries) ColumnarPutString(dict, str);
+        dict += ColumnarEncodeUInts(ids, ColumnEncoding::VARINT);
+        if (dict.size() < plain.size()) { enc = ColumnEncoding::DICT; return dict; }
+        enc = ColumnEncoding::PLAIN;
+        return plain;
+      }
+      case ColumnType::UINT_LIST: {
+        // Lengths, then values (bit-packed if every value is 0/1).
+        std::string buf;
+        bool bits = true;
+        for (const auto & list : lists) {
+          ColumnarPutVarint(buf, list.size());
+          for (uint64_t val : list) bits = bits && val <= 1;
+        }
+        if (bits) {
+          uint8_t byte = 0;
+          size_t nbits = 0;
+          for (const auto & list : lists) {
+            for (uint64_t val : list) {
+              byte |= (uint8_t)(val << (nbits % 8));
+              if (++nbits % 8 == 0) { buf.push_back((char)byte); byte = 0; }
+            }
+          }
+          if (nbits % 8) buf.push_back((char)byte);
+          enc = ColumnEncoding::BITS;
+        } else {
+          for (const auto & list : lists) for (uint64_t val : list) ColumnarPutVarint(buf, val);
+          enc = ColumnEncoding::VARINT;
+        }
+        return buf;
+      }
+      case ColumnType::PROGRAM: {
+        std::string buf;
+        for (const ColumnarProgram & prog : programs) {
+          ColumnarPutVarint(buf, prog.size());
+          for (const ColumnarInst & inst : prog) {
+            ColumnarPutVarint(buf, inst.id);
+            ColumnarPutVarint(buf, inst.arg_tags.size());
+            for (uint64_t tag : inst.arg_tags) ColumnarPutVarint(buf, tag);
+          }
+        }
+        enc = ColumnEncoding::VARINT;
+        return buf;
+      }
+      default: return ColumnarEncodeUIntsBest(uints, enc);
+    }
+  }
+
+  /// Decode count values from buf (replacing current values). Return false on malformed input.
+  bool Decode(const std::string & buf, ColumnEncoding enc, size_t count) {
+    Clear();
+    size_t pos = 0;
+    switch (type) {
+      case ColumnType::STRING: {
+        if (enc == ColumnEncoding::DICT) {
+          emp::vector<std::string> entries;
+          const uint64_t num_entries = ColumnarGetVarint(buf, pos);
+          for (uint64_t i = 0; i < num_entries && pos <= buf.size(); ++i) entries.emplace_back(ColumnarGetString(buf, pos));
+          if (pos > buf.size()) return false;
+          emp::vector<uint64_t> ids;
+          if (!ColumnarDecodeUInts(buf.substr(pos), ColumnEncoding::VARINT, count, ids)) return false;
+          for (uint64_t id : ids) {
+            if (id >= entries.size()) return false;
+            strings.emplace_back(entries[id]);
+          }
+          return true;
+        }
+        if (enc != ColumnEncoding::PLAIN) return false;
+        while (strings.size() < count && pos < buf.size()) strings.emplace_back(ColumnarGetString(buf, pos));
+        return strings.size() == count && pos == buf.size();
+      }
+      case ColumnType::UINT_LIST: {
+        lists.resize(count);
+        for (auto & list : lists) {
+          const uint64_t len = ColumnarGetVarint(buf, pos);
+          if (pos > buf.size() || len > buf.size() * 8) return false;
+          list.resize(len);
+        }
+        if (enc == ColumnEncoding::BITS) {
+          size_t nbits = 0;
+          for (auto & list : lists) {
+            for (uint64_t & val : list) {
+              if (pos + nbits / 8 >= buf.size()) return false;
+              val = ((uint8_t)buf[pos + nbits / 8] >> (nbits % 8)) & 1;
+              ++nbits;
+            }
+          }
+          return pos + (nbits + 7) / 8 == buf.size();
+        }
+        if (enc != ColumnEncoding::VARINT) return false;
+        for (auto & list : lists) for (uint64_t & val : list) val = ColumnarGetVarint(buf, pos);
+        return pos == buf.size();
+      }
+      case ColumnType::PROGRAM: {
+        if (enc != ColumnEncoding::VARINT) return false;
+        programs.resize(count);
+        for (ColumnarProgram & prog : programs) {
+          const uint64_t len = ColumnarGetVarint(buf, pos);
+          if (pos > buf.size() || len > buf.size()) return false;
+          prog.resize(len);
+          for (ColumnarInst & inst : prog) {
+            inst.id = ColumnarGetVarint(buf, pos);
+            const uint64_t num_args = ColumnarGetVarint(buf, pos);
+            if (pos > buf.size() || num_args > buf.size()) return false;
+            inst.arg_tags.resize(num_args);
+            for (uint64_t & tag : inst.arg_tags) tag = ColumnarGetVarint(buf, pos);
+          }
+        }
+        return pos == buf.size();
+      }
+      default: return ColumnarDecodeUInts(buf, enc, count, uints);
+    }
+  }
+};
+
+// ---- Writer ----
+
+/// Writes a columnar data file. Mirrors emp::DataFile usage: add columns (each with a function
+/// that gets the column's value for the current row), then call Update to record a row.
+/// - AddFun overloads accept the same std::function getters used with emp::DataFile.
+/// - Rows are written in blocks of block_rows (use 1 for files that should be up to date on
+///   disk after every Update, e.g., solution files). Remaining rows are written on Flush/destruction.
+class ColumnarWriter {
+public:
+  using uint_fun_t = std::function<uint64_t(void)>;
+  using int_fun_t = std::function<int64_t(void)>;
+  using double_fun_t = std::function<double(void)>;
+  using string_fun_t = std::function<std::string(void)>;
+  using list_fun_t = std::function<emp::vector<uint64_t>(void)>;
+  using program_fun_t = std::function<ColumnarProgram(void)>;
+
+protected:
+  struct Column {
+    std::string name;
+    ColumnData data;
+    std::function<void(ColumnData &)> record;
+  };
+
+  std::string filename;
+  std::ofstream out;
+  size_t block_rows;
+  size_t rows;
+  bool header_written;
+
+  emp::vector<Column> columns;
+  emp::vector<std::pair<std::string, std::string>> meta;
+
+  void AddColumn(const std::string & name, ColumnType type, const std::function<void(ColumnData &)> & record) {
+    emp_assert(!header_written, "Columns must be added before any rows are recorded.");
+    columns.emplace_back(Column{name, ColumnData(type), record});
+  }
+
+public:
+  ColumnarWriter(const std::string & _filename, size_t _block_rows=4096)
+    : filename(_filename), out(_filename, std::ios::binary), block_rows(_block_rows), rows(0),
+      header_written(false), columns(), meta()
+  {
+    emp_assert(block_rows > 0);
+    if (!out.is_open()) std::cout << "Failed to open columnar file (" << filename << ")." << std::endl;
+  }
+
+  ColumnarWriter(const ColumnarWriter &) = delete;
+  ColumnarWriter & operator=(const ColumnarWriter &) = delete;
+
+  ~ColumnarWriter() { Flush(); }
+
+  const std::string & GetFilename() const { return filename; }
+  size_t GetNumColumns() const { return columns.size(); }
+
+  /// Continue an existing file (with the same columns) from its end, e.g., when resuming from a
+  /// checkpoint. Unwritten rows are discarded, and the header is not written again.
+  void ReopenForAppend() {
+    for (Column & col : columns) col.data.Clear();
+    rows = 0;
+    out.close();
+    out.open(filename, std::ios::binary | std::ios::app);
+    if (!out.is_open()) std::cout << "Failed to open columnar file (" << filename << ")." << std::endl;
+    header_written = true;
+  }
+
+  void AddUInt(const uint_fun_t & fun, const std::string & name) {
+    AddColumn(name, ColumnType::UINT, [fun](ColumnData & data) { data.uints.emplace_back(fun()); });
+  }
+  void AddInt(const int_fun_t & fun, const std::string & name) {
+    AddColumn(name, ColumnType::INT, [fun](ColumnData & data) { data.uints.emplace_back(ColumnarZigZag(fun())); });
+  }
+  void AddDouble(const double_fun_t & fun, const std::string & name) {
+    AddColumn(name, ColumnType::DOUBLE, [fun](ColumnData & data) { data.uints.emplace_back(ColumnarDoubleBits(fun())); });
+  }
+  void AddString(const string_fun_t & fun, const std::string & name) {
+    AddColumn(name, ColumnType::STRING, [fun](ColumnData & data) { data.strings.emplace_back(fun()); });
+  }
+  /// List-of-integers column. format (stored in metadata) controls how exported lists are printed:
+  /// - "list": "[a,b,c]"; "pairs": "[(a,b),(c,d)]"; "groups:N": "[[a,b],[c,d]]" (N values per group)
+  void AddUIntList(const list_fun_t & fun, const std::string & name, const std::string & format="list") {
+    AddColumn(name, ColumnType::UINT_LIST, [fun](ColumnData & data) { data.lists.emplace_back(fun()); });
+    AddMeta(name + ".format", format);
+  }
+  /// Program column; instruction names and tag width (stored in metadata) are needed to export programs as text.
+  void AddProgram(const program_fun_t & fun, const std::string & name,
+                  const emp::vector<std::string> & inst_names, size_t tag_width) {
+    AddColumn(name, ColumnType::PROGRAM, [fun](ColumnData & data) { data.programs.emplace_back(fun()); });
+    std::string names;
+    for (size_t i = 0; i < inst_names.size(); ++i) names += (i ? "\n" : "") + inst_names[i];
+    AddMeta(name + ".inst_names", names);
+    AddMeta(name + ".tag_width", std::to_string(tag_width));
+  }
+
+  // emp::DataFile-style AddFun (description is ignored).
+  void AddFun(const std::function<size_t(void)> & fun, const std::string & name, const std::string & desc="") { AddUInt(fun, name); }
+  void AddFun(const std::function<int(void)> & fun, const std::string & name, const std::string & desc="") { AddInt(fun, name); }
+  void AddFun(const std::function<double(void)> & fun, const std::string & name, const std::string & desc="") { AddDouble(fun, name); }
+  void AddFun(const std::function<std::string(void)> & fun, const std::string & name, const std::string & desc="") { AddString(fun, name); }
+
+  void AddMeta(const std::string & key, const std::string & value) {
+    emp_assert(!header_written, "Metadata must be added before any rows are recorded.");
+    meta.emplace_back(key, value);
+  }
+
+  /// Write file header (column names/types + metadata). Called automatically by the first Update.
+  void PrintHeaderKeys() {
+    if (header_written) return;
+    std::string buf(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+    ColumnarPutVarint(buf, COLUMNAR_VERSION);
+    ColumnarPutVarint(buf, columns.size());
+    for (const Column & col : columns) {
+      ColumnarPutString(buf, col.name);
+      buf.push_back((char)col.data.type);
+    }
+    ColumnarPutVarint(buf, meta.size());
+    for (const auto & entry : meta) {
+      ColumnarPutString(buf, entry.first);
+      ColumnarPutString(buf, entry.second);
+    }
+    out.write(buf.data(), buf.size());
+    out.flush();
+    header_written = true;
+  }
+
+  /// Record a row (calling every column's getter).
+  void Update() {
+    if (!header_written) PrintHeaderKeys();
+    for (Column & col : columns) col.record(col.data);
+    if (++rows >= block_rows) Flush();
+  }
+
+  /// Write any buffered rows as a block.
+  void Flush() {
+    if (!rows) return;
+    std::string buf;
+    ColumnarPutVarint(buf, rows);
+    for (Column & col : columns) {
+      ColumnEncoding enc = ColumnEncoding::PLAIN;
+      const std::string data(col.data.Encode(enc));
+      buf.push_back((char)enc);
+      ColumnarPutVarint(buf, data.size());
+      buf += data;
+      col.data.Clear();
+    }
+    out.write(buf.data(), buf.size());
+    out.flush();
+    rows = 0;
+  }
+};
+
+// ---- Reader ----
+
+/// Reads a columnar data file block-by-block.
+class ColumnarReader {
+protected:
+  std::ifstream in;
+  emp::vector<std::string> names;
+  emp::vector<ColumnData> block;
+  emp::vector<std::pair<std::string, std::string>> meta;
+  size_t block_rows;
+
+  // Per-program-column export info (indexed by column ID).
+  emp::vector<emp::vector<std::string>> inst_names;
+  emp::vector<size_t> tag_widths;
+
+  bool ReadVarint(uint64_t & val) {
+    val = 0;
+    for (size_t shift = 0; shift < 64; shift += 7) {
+      const int byte = in.get();
+      if (byte == EOF) return false;
+      val |= (uint64_t)(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+    return false;
+  }
+
+  bool ReadString(std::string & str) {
+    uint64_t len = 0;
+    if (!ReadVarint(len) || len > ((uint64_t)1 << 32)) return false;
+    str.resize(len);
+    if (len) in.read(&str[0], len);
+    return (bool)in;
+  }
+
+  void PrintList(std::ostream & os, const emp::vector<uint64_t> & list, const std::string & format) const {
+    os << "\"[";
+    if (format == "pairs") {
+      for (size_t i = 0; i + 1 < list.size(); i += 2) os << (i ? "," : "") << "(" << list[i] << "," << list[i+1] << ")";
+    } else if (format.compare(0, 7, "groups:") == 0) {
+      const size_t group = std::max<size_t>(1, std::stoul(format.substr(7)));
+      for (size_t i = 0; i < list.size(); ++i) {
+        if (i % group == 0) os << (i ? "," : "") << "[";
+        else os << ",";
+        os << list[i];
+        if (i % group == group - 1 || i + 1 == list.size()) os << "]";
+      }
+    } else {
+      for (size_t i = 0; i < list.size(); ++i) os << (i ? "," : "") << list[i];
+    }
+    os << "]\"";
+  }
+
+public:
+  ColumnarReader() : in(), names(), block(), meta(), block_rows(0), inst_names(), tag_widths() { ; }
+
+  /// Open file and read its header. Return false if it can't be opened or isn't a columnar data file.
+  bool Open(const std::string & fpath) {
+    in.close();
+    in.clear();
+    names.clear(); block.clear(); meta.clear(); block_rows = 0;
+    in.open(fpath, std::ios::binary);
+    if (!in.is_open()) return false;
+    char magic[sizeof(COLUMNAR_MAGIC)];
+    in.read(magic, sizeof(magic));
+    uint64_t version = 0, num_cols = 0, num_meta = 0;
+    if (!in || std::memcmp(magic, COLUMNAR_MAGIC, sizeof(magic)) != 0) return false;
+    if (!ReadVarint(version) || version != COLUMNAR_VERSION) return false;
+    if (!ReadVarint(num_cols)) return false;
+    for (uint64_t i = 0; i < num_cols; ++i) {
+      std::string name;
+      if (!ReadString(name)) return false;
+      const int type = in.get();
+      if (type < 0 || type > (int)ColumnType::PROGRAM) return false;
+      names.emplace_back(name);
+      block.emplace_back((ColumnType)type);
+    }
+    if (!ReadVarint(num_meta)) return false;
+    for (uint64_t i = 0; i < num_meta; ++i) {
+      std::string key, value;
+      if (!ReadString(key) || !ReadString(value)) return false;
+      meta.emplace_back(key, value);
+    }
+    // Program export info.
+    inst_names.assign(names.size(), {});
+    tag_widths.assign(names.size(), 0);
+    for (size_t col = 0; col < names.size(); ++col) {
+      if (block[col].type != ColumnType::PROGRAM) continue;
+      const std::string all_names(GetMeta(names[col] + ".inst_names"));
+      for (size_t start = 0; start <= all_names.size(); ) {
+        size_t end = all_names.find('\n', start);
+        if (end == std::string::npos) end = all_names.size();
+        inst_names[col].emplace_back(all_names.substr(start, end - start));
+        start = end + 1;
+      }
+      tag_widths[col] = std::min<size_t>(64, std::stoul("0" + GetMeta(names[col] + ".tag_width")));
+    }
+    return true;
+  }
+
+  size_t GetNumColumns() const { return names.size(); }
+  const std::string & GetName(size_t col) const { return names[col]; }
+  ColumnType GetType(size_t col) const { return block[col].type; }
+
+  /// Column ID with given name (GetNumColumns() if there is no such column).
+  size_t GetColumnID(const std::string & name) const {
+    for (size_t col = 0; col < names.size(); ++col) if (names[col] == name) return col;
+    return names.size();
+  }
+
+  const emp::vector<std::pair<std::string, std::string>> & GetMeta() const { return meta; }
+  std::string GetMeta(const std::string & key, const std::string & default_val="") const {
+    for (const auto & entry : meta) if (entry.first == key) return entry.second;
+    return default_val;
+  }
+
+  /// Read the next block of rows. Return false at end of file (or on a malformed block).
+  bool NextBlock() {
+    uint64_t rows = 0;
+    block_rows = 0;
+    if (!ReadVarint(rows)) return false;
+    for (size_t col = 0; col < block.size(); ++col) {
+      const int enc = in.get();
+      uint64_t size = 0;
+      std::string buf;
+      if (enc < 0 || !ReadVarint(size) || size > ((uint64_t)1 << 40)) return false;
+      buf.resize(size);
+      if (size) in.read(&buf[0], size);
+      if (!in || !block[col].Decode(buf, (ColumnEncoding)enc, rows)) {
+        std::cout << "Malformed block (column " << names[col] << ")." << std::endl;
+        return false;
+      }
+    }
+    block_rows = rows;
+    return true;
+  }
+
+  /// Number of rows in the current block.
+  size_t GetNumRows() const { return block_rows; }
+  const ColumnData & GetColumn(size_t col) const { return block[col]; }
+
+  /// Print a value (from the current block) the way the equivalent CSV output would.
+  void PrintCSVField(std::ostream & os, size_t col, size_t row) const {
+    const ColumnData & data = block[col];
+    switch (data.type) {
+      case ColumnType::UINT: os << data.GetUInt(row); break;
+      case ColumnType::INT: os << data.GetInt(row); break;
+      case ColumnType::DOUBLE: os << data.GetDouble(row); break;
+      case ColumnType::STRING: os << data.GetString(row); break;
+      case ColumnType::UINT_LIST: PrintList(os, data.GetList(row), GetMeta(names[col] + ".format", "list")); break;
+      case ColumnType::PROGRAM: {
+        // "[InstName(1111,1111,1111),InstName(1111,1111,1111),...]" (tags printed high bit first)
+        const ColumnarProgram & prog = data.GetProgram(row);
+        os << "\"[";
+        for (size_t i = 0; i < prog.size(); ++i) {
+          if (i) os << ",";
+          if (prog[i].id < inst_names[col].size()) os << inst_names[col][prog[i].id];
+          else os << prog[i].id;
+          os << "(";
+          for (size_t t = 0; t < prog[i].arg_tags.size(); ++t) {
+            if (t) os << ",";
+            for (size_t b = tag_widths[col]; b > 0; --b) os << ((prog[i].arg_tags[t] >> (b - 1)) & 1);
+          }
+          os << ")";
+        }
+        os << "]\"";
+        break;
+      }
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,398 @@
+#ifndef COMPACT_SYSTEMATICS_H
+#define COMPACT_SYSTEMATICS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+
+#include "base/assert.h"
+#include "base/Ptr.h"
+#include "base/vector.h"
+#include "Evolve/Systematics.h"
+
+#include "Checkpoint.h"
+
+/// Compact taxon storage for emp::Systematics (SYSTEMATICS_MODE=1).
+/// - Taxa are identified by a 64-bit genome hash (when both genomes are stored in full, equality
+///   also compares genomes, so full mode tracks exactly the same taxa as keying on the genome).
+/// - New taxa store their full genome. Each SystematicsCompactor::Compact pass re-encodes them as a
+///   diff against their parent taxon's genome, keeping a full genome (keyframe) at least every
+///   'keyframe_interval' links of a lineage so that decoding a genome stays cheap.
+/// - The memory cap is hard: past it, genomes of the oldest extinct ancestors are dropped (the taxa
+///   stay in the tree; HasGenome() is false), and if that is not enough, genomes of living taxa too
+///   (hash-only taxa). Extinct taxa without living descendants are already removed by
+///   emp::Systematics (store_all=false). Taxa themselves are never dropped, so a tree that alone
+///   exceeds the cap keeps no genomes.
+/// Genome types plug in by specializing CompactGenomeTraits:
+///   using elem_t;                                             // Genome sequence element.
+///   static const emp::vector<elem_t> & GetSeq(const GENOME_T &);
+///   static void SetSeq(GENOME_T &, emp::vector<elem_t> &&);   // Other genome fields are copied from a keyframe.
+///   static void Hash(uint64_t & hash, const elem_t &);        // Mix element into hash (see CompactGenomeHash).
+///   static size_t GetBytes(const elem_t &);                   // Approximate memory used by element.
+template<typename GENOME_T> struct CompactGenomeTraits;
+
+/// FNV-1a style mixing for CompactGenomeTraits::Hash.
+inline void CompactGenomeHash(uint64_t & hash, uint64_t val) {
+  hash ^= val;
+  hash *= 1099511628211ull;
+  hash ^= hash >> 29;
+}
+
+template<typename GENOME_T>
+class CompactGenome {
+public:
+  using genome_t = GENOME_T;
+  using traits_t = CompactGenomeTraits<GENOME_T>;
+  using elem_t = typename traits_t::elem_t;
+  using seq_t = emp::vector<elem_t>;
+
+  /// Stored genome: either a keyframe (full genome) or a diff against a base genome. Nodes are
+  /// shared between the taxon that owns them and any diffs based on them.
+  struct Node {
+    std::shared_ptr<const genome_t> full;     ///< Full genome (keyframes only).
+    std::shared_ptr<const Node> base;         ///< Genome this diff applies to (diffs only).
+    size_t prefix;                            ///< Elements kept from the front of base.
+    size_t suffix;                            ///< Elements kept from the back of base.
+    seq_t middle;                             ///< Elements between prefix and suffix.
+    size_t chain;                             ///< Number of diffs between this node and its keyframe.
+    size_t bytes;                             ///< Approximate memory used by this node.
+    mutable bool settled;                     ///< Already considered by a compaction pass?
+    mutable bool dropped;                     ///< Owner's genome dropped (diffs based on it must be rebased).
+
+    Node() : full(), base(), prefix(0), suffix(0), middle(), chain(0), bytes(0), settled(false), dropped(false) { ; }
+  };
+  using node_ptr_t = std::shared_ptr<const Node>;
+
+protected:
+  uint64_t hash;
+  mutable node_ptr_t node;  ///< Null once dropped. Mutable: emp::Systematics only hands out const info.
+
+public:
+  CompactGenome(const genome_t & genome)
+    : hash(CalcHash(genome)), node(MakeKeyframe(std::make_shared<const genome_t>(genome))) { ; }
+  /// Restore stored genome (e.g., from a checkpoint); node is null if the genome was dropped.
+  CompactGenome(uint64_t _hash, const node_ptr_t & _node) : hash(_hash), node(_node) { ; }
+
+  bool operator==(const CompactGenome & in) const {
+    if (hash != in.hash) return false;
+    if (!node || !in.node || !node->full || !in.node->full) return true;
+    return *node->full == *in.node->full;
+  }
+  bool operator!=(const CompactGenome & in) const { return !(*this == in); }
+
+  uint64_t GetHash() const { return hash; }
+  bool HasGenome() const { return (bool)node; }
+
+  /// Decode genome (requires HasGenome()).
+  genome_t GetGenome() const {
+    emp_assert(node);
+    return Decode(*node);
+  }
+
+  /// Call fun with this taxon's genome (without copying keyframes).
+  void WithGenome(const std::function<void(const genome_t &)> & fun) const {
+    emp_assert(node);
+    if (node->full) fun(*node->full);
+    else fun(Decode(*node));
+  }
+
+  const node_ptr_t & GetNode() const { return node; }
+  void SetNode(const node_ptr_t & _node) const { node = _node; }
+
+  static uint64_t CalcHash(const genome_t & genome) {
+    const seq_t & seq = traits_t::GetSeq(genome);
+    uint64_t h = 14695981039346656037ull;
+    CompactGenomeHash(h, (uint64_t)seq.size());
+    for (const elem_t & elem : seq) traits_t::Hash(h, elem);
+    return h;
+  }
+
+  static size_t CalcBytes(const seq_t & seq) {
+    size_t bytes = 0;
+    for (const elem_t & elem : seq) bytes += traits_t::GetBytes(elem);
+    return bytes;
+  }
+
+  static node_ptr_t MakeKeyframe(const std::shared_ptr<const genome_t> & genome) {
+    std::shared_ptr<Node> n = std::make_shared<Node>();
+    n->full = genome;
+    n->bytes = sizeof(Node) + sizeof(genome_t) + CalcBytes(traits_t::GetSeq(*genome));
+    return n;
+  }
+
+  /// Diff seq against base (whose decoded sequence is base_seq): shared prefix + shared suffix,
+  /// and the elements in between. Mutations are local edits, so the middle is usually short.
+  static node_ptr_t MakeDiff(const node_ptr_t & base, const seq_t & base_seq, const seq_t & seq) {
+    std::shared_ptr<Node> n = std::make_shared<Node>();
+    const size_t max_shared = std::min(base_seq.size(), seq.size());
+    while (n->prefix < max_shared && base_seq[n->prefix] == seq[n->prefix]) ++n->prefix;
+    while (n->suffix < max_shared - n->prefix
+           && base_seq[base_seq.size() - 1 - n->suffix] == seq[seq.size() - 1 - n->suffix]) ++n->suffix;
+    n->middle.assign(seq.begin() + n->prefix, seq.end() - n->suffix);
+    n->base = base;
+    n->chain = base->chain + 1;
+    n->bytes = sizeof(Node) + CalcBytes(n->middle);
+    return n;
+  }
+
+  static genome_t Decode(const Node & n) {
+    emp::vector<const Node *> diffs;
+    const Node * cur = &n;
+    while (!cur->full) {
+      diffs.emplace_back(cur);
+      cur = cur->base.get();
+    }
+    genome_t genome(*cur->full);
+    if (diffs.empty()) return genome;
+    seq_t seq(traits_t::GetSeq(genome));
+    for (size_t i = diffs.size(); i-- > 0; ) {
+      const Node & diff = *diffs[i];
+      seq_t next;
+      next.reserve(diff.prefix + diff.middle.size() + diff.suffix);
+      next.insert(next.end(), seq.begin(), seq.begin() + diff.prefix);
+      next.insert(next.end(), diff.middle.begin(), diff.middle.end());
+      next.insert(next.end(), seq.end() - diff.suffix, seq.end());
+      seq = std::move(next);
+    }
+    traits_t::SetSeq(genome, std::move(seq));
+    return genome;
+  }
+};
+
+template<typename GENOME_T>
+std::ostream & operator<<(std::ostream & out, const CompactGenome<GENOME_T> & info) {
+  return out << info.GetHash();
+}
+
+/// Periodically compacts (and caps the memory used by) an emp::Systematics<ORG_T, CompactGenome<GENOME_T>>.
+/// - Compact runs a full pass (e.g., before the systematics file is written). With a cap, Enforce
+///   (cheap; call every update) runs one early if new taxa may have pushed memory past the cap.
+/// - Over the cap, genomes are dropped down to 7/8 of it, leaving room for new taxa before the next drop.
+template<typename ORG_T, typename GENOME_T>
+class SystematicsCompactor {
+public:
+  using info_t = CompactGenome<GENOME_T>;
+  using systematics_t = emp::Systematics<ORG_T, info_t>;
+  using taxon_t = typename systematics_t::taxon_t;
+  using node_ptr_t = typename info_t::node_ptr_t;
+
+  static constexpr size_t TAXON_OVERHEAD = 64; ///< Per-taxon container overhead (bytes; estimate).
+
+  struct Stats {
+    size_t taxa;
+    size_t keyframes;
+    size_t diffs;
+    size_t dropped;       ///< Taxa whose genome has been dropped.
+    size_t dropped_active;  ///< Living taxa whose genome has been dropped (hash-only).
+    size_t genome_bytes;  ///< Memory used by stored genomes.
+    size_t total_bytes;   ///< Memory used by stored genomes + taxa.
+  };
+
+protected:
+  size_t keyframe_interval;
+  size_t max_bytes;
+  Stats stats;
+  size_t last_taxon_id;  ///< Largest taxon ID as of the last Compact (taxa are numbered in order of creation).
+
+  emp::vector<emp::Ptr<taxon_t>> taxa;  ///< Every taxon in the tree, parents before children (rebuilt each pass).
+
+  /// Collect taxa, ordered by depth (root-most first).
+  void CollectTaxa(systematics_t & sys) {
+    taxa.clear();
+    for (emp::Ptr<taxon_t> t : sys.GetActive()) taxa.emplace_back(t);
+    for (emp::Ptr<taxon_t> t : sys.GetAncestors()) taxa.emplace_back(t);
+    std::unordered_map<taxon_t *, size_t> depth;
+    emp::vector<taxon_t *> path;
+    for (emp::Ptr<taxon_t> t : taxa) {
+      path.clear();
+      taxon_t * cur = t.Raw();
+      while (cur != nullptr && depth.find(cur) == depth.end()) {
+        path.emplace_back(cur);
+        cur = cur->GetParent().Raw();
+      }
+      size_t d = (cur == nullptr) ? 0 : depth[cur] + 1;
+      for (size_t i = path.size(); i-- > 0; ) depth[path[i]] = d++;
+    }
+    std::stable_sort(taxa.begin(), taxa.end(), [&depth](emp::Ptr<taxon_t> a, emp::Ptr<taxon_t> b) {
+      return depth[a.Raw()] < depth[b.Raw()];
+    });
+  }
+
+  void CalcStats() {
+    stats = {taxa.size(), 0, 0, 0, 0, 0, 0};
+    for (emp::Ptr<taxon_t> t : taxa) {
+      const node_ptr_t & node = t->GetInfo().GetNode();
+      if (!node) {
+        ++stats.dropped;
+        if (t->GetNumOrgs()) ++stats.dropped_active;
+        continue;
+      }
+      if (node->full) ++stats.keyframes;
+      else ++stats.diffs;
+      stats.genome_bytes += node->bytes;
+    }
+    stats.total_bytes = stats.genome_bytes + taxa.size() * (sizeof(taxon_t) + TAXON_OVERHEAD);
+  }
+
+  /// Re-encode taxa not yet considered by a pass as diffs against their parent's genome.
+  void Encode() {
+    if (keyframe_interval < 2) return;
+    // Genomes of taxa encoded this pass (children are usually encoded against them).
+    std::unordered_map<const typename info_t::Node *, std::shared_ptr<const GENOME_T>> encoded;
+    for (emp::Ptr<taxon_t> t : taxa) {
+      const info_t & info = t->GetInfo();
+      const node_ptr_t node = info.GetNode();
+      if (!node || node->settled) continue;
+      node->settled = true;
+      emp::Ptr<taxon_t> parent = t->GetParent();
+      if (parent == nullptr || !node->full) continue;
+      const node_ptr_t & base = parent->GetInfo().GetNode();
+      if (!base || base->chain + 1 >= keyframe_interval) continue;
+      std::shared_ptr<const GENOME_T> base_genome;
+      auto it = encoded.find(base.get());
+      if (it != encoded.end()) base_genome = it->second;
+      else if (base->full) base_genome = base->full;
+      else base_genome = std::make_shared<const GENOME_T>(info_t::Decode(*base));
+      node_ptr_t diff = info_t::MakeDiff(base, CompactGenomeTraits<GENOME_T>::GetSeq(*base_genome), CompactGenomeTraits<GENOME_T>::GetSeq(*node->full));
+      if (diff->bytes >= node->bytes) continue;
+      diff->settled = true;
+      encoded[diff.get()] = node->full;
+      info.SetNode(diff);
+    }
+  }
+
+  /// Drop genomes of the oldest extinct ancestors (or, with active, of the oldest taxa, living or
+  /// not) until under target bytes; then turn diffs based on dropped genomes back into keyframes.
+  /// Returns whether anything was dropped.
+  bool Drop(size_t target, bool active) {
+    size_t total = stats.total_bytes;
+    bool dropped = false;
+    for (emp::Ptr<taxon_t> t : taxa) {
+      if (total <= target) break;
+      if (!active && t->GetNumOrgs()) continue;
+      const info_t & info = t->GetInfo();
+      const node_ptr_t & node = info.GetNode();
+      if (!node) continue;
+      node->dropped = true;
+      total -= std::min(total, node->bytes);
+      info.SetNode(nullptr);
+      dropped = true;
+    }
+    if (!dropped) return false;
+    for (emp::Ptr<taxon_t> t : taxa) {
+      const info_t & info = t->GetInfo();
+      const node_ptr_t node = info.GetNode();
+      if (!node || node->full) continue;
+      bool rebase = false;
+      for (const typename info_t::Node * cur = node.get(); !cur->full && !rebase; cur = cur->base.get()) {
+        rebase = cur->base->dropped;
+      }
+      if (!rebase) continue;
+      node_ptr_t keyframe = info_t::MakeKeyframe(std::make_shared<const GENOME_T>(info_t::Decode(*node)));
+      keyframe->settled = true;
+      info.SetNode(keyframe);
+    }
+    return true;
+  }
+
+public:
+  SystematicsCompactor(size_t _keyframe_interval=16, size_t _max_bytes=0)
+    : keyframe_interval(_keyframe_interval), max_bytes(_max_bytes), stats({0, 0, 0, 0, 0, 0, 0}),
+      last_taxon_id(0), taxa() { ; }
+
+  /// keyframe_interval: max diffs between a taxon and a keyframe; max_bytes: hard memory cap (0 for none).
+  void Configure(size_t _keyframe_interval, size_t _max_bytes) {
+    keyframe_interval = _keyframe_interval;
+    max_bytes = _max_bytes;
+  }
+
+  /// Stats as of the last Compact.
+  const Stats & GetStats() const { return stats; }
+
+  void Compact(systematics_t & sys) {
+    CollectTaxa(sys);
+    Encode();
+    CalcStats();
+    if (max_bytes && stats.total_bytes > max_bytes) {
+      const size_t target = max_bytes - max_bytes / 8;
+      while (stats.total_bytes > target && Drop(target, false)) CalcStats();
+      // Still over: fall back to hash-only taxa, oldest first.
+      while (stats.total_bytes > target && Drop(target, true)) CalcStats();
+    }
+    for (emp::Ptr<taxon_t> t : taxa) last_taxon_id = std::max(last_taxon_id, t->GetID());
+    taxa.clear();
+  }
+
+  /// Compact if new taxa (which store full genomes until compacted) may have pushed memory past the
+  /// cap since the last Compact. Only looks at living taxa: every taxon created since then is
+  /// counted, at the mean size of living keyframes.
+  void Enforce(systematics_t & sys) {
+    if (!max_bytes) return;
+    size_t max_id = 0;
+    size_t keyframes = 0;
+    size_t keyframe_bytes = 0;
+    for (emp::Ptr<taxon_t> t : sys.GetActive()) {
+      max_id = std::max(max_id, t->GetID());
+      const node_ptr_t & node = t->GetInfo().GetNode();
+      if (node && node->full) {
+        ++keyframes;
+        keyframe_bytes += node->bytes;
+      }
+    }
+    const size_t new_taxa = (max_id > last_taxon_id) ? max_id - last_taxon_id : 0;
+    const size_t taxon_bytes = (keyframes ? keyframe_bytes / keyframes : 0) + sizeof(taxon_t) + TAXON_OVERHEAD;
+    if (stats.total_bytes + new_taxa * taxon_bytes > max_bytes) Compact(sys);
+  }
+
+  /// Stats and last_taxon_id (what Enforce compares against), so that a resumed run compacts when
+  /// the original would have.
+  void WriteCheckpoint(std::ostream & out) const {
+    CheckpointWrite(out, (uint64_t)stats.taxa);
+    CheckpointWrite(out, (uint64_t)stats.keyframes);
+    CheckpointWrite(out, (uint64_t)stats.diffs);
+    CheckpointWrite(out, (uint64_t)stats.dropped);
+    CheckpointWrite(out, (uint64_t)stats.dropped_active);
+    CheckpointWrite(out, (uint64_t)stats.genome_bytes);
+    CheckpointWrite(out, (uint64_t)stats.total_bytes);
+    CheckpointWrite(out, (uint64_t)last_taxon_id);
+  }
+
+  void ReadCheckpoint(std::istream & in) {
+    uint64_t vals[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (uint64_t & val : vals) CheckpointRead(in, val);
+    if (!in) return;
+    stats = {(size_t)vals[0], (size_t)vals[1], (size_t)vals[2], (size_t)vals[3],
+             (size_t)vals[4], (size_t)vals[5], (size_t)vals[6]};
+    last_taxon_id = (size_t)vals[7];
+  }
+};
+
+/// Phylogeny metrics for compact systematics files: calculated only when the file is written
+/// (instead of through emp::Systematics' data nodes, which recalculate every update).
+template<typename FILE_T, typename SYSTEMATICS_T>
+void AddCompactSystematicsMetrics(FILE_T & file, emp::Ptr<SYSTEMATICS_T> sys, const std::function<size_t()> & get_update) {
+  file.template AddFun<double>([sys, get_update]() {
+    double total = 0.0;
+    for (auto t : sys->GetActive()) total += sys->GetEvolutionaryDistinctiveness(t, (double)get_update());
+    return sys->GetActive().size() ? total / (double)sys->GetActive().size() : 0.0;
+  }, "mean_evolutionary_distinctiveness", "Mean evolutionary distinctiveness of active taxa");
+  file.template AddFun<double>([sys]() { return sys->GetMeanPairwiseDistance(); }, "mean_pairwise_distance", "Mean pairwise distance between active taxa");
+  file.template AddFun<double>([sys]() { return sys->GetVariancePairwiseDistance(); }, "variance_pairwise_distance", "Variance of pairwise distances between active taxa");
+  file.template AddFun<double>([sys]() { return sys->GetPhylogeneticDiversity(); }, "current_phylogenetic_diversity", "Current phylogenetic diversity");
+}
+
+/// Compaction stats columns (as of the last Compact).
+template<typename FILE_T, typename COMPACTOR_T>
+void AddCompactSystematicsStats(FILE_T & file, const COMPACTOR_T & compactor) {
+  file.template AddFun<size_t>([&compactor]() { return compactor.GetStats().keyframes; }, "stored_keyframes", "Taxa storing full genomes");
+  file.template AddFun<size_t>([&compactor]() { return compactor.GetStats().diffs; }, "stored_diffs", "Taxa storing genome diffs");
+  file.template AddFun<size_t>([&compactor]() { return compactor.GetStats().dropped; }, "dropped_genomes", "Taxa whose genome was dropped (memory cap)");
+  file.template AddFun<size_t>([&compactor]() { return compactor.GetStats().dropped_active; }, "dropped_active_genomes", "Living taxa whose genome was dropped (memory cap)");
+  file.template AddFun<size_t>([&compactor]() { return compactor.GetStats().total_bytes; }, "systematics_bytes", "Approximate systematics memory use");
+}
+
+#endif
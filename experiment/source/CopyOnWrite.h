@@ -0,0 +1,72 @@
+#ifndef COPY_ON_WRITE_H
+#define COPY_ON_WRITE_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+/// Copy-on-write storage for genome contents (comparators, test sets, instruction sequences).
+/// - Copies share one reference-counted T, so copying a genome (world births, systematics,
+///   snapshots) is a pointer copy. Unmutated offspring never copy their parent's contents.
+/// - Get() reads the shared contents. Edit() first copies the contents if another genome shares
+///   them. Replace() is for callers about to overwrite the contents (shared contents are dropped
+///   rather than copied).
+/// - Reference counts are atomic, so copies can be read on other threads (e.g., SnapshotWriter,
+///   SolutionScreener). A given CopyOnWrite object still needs one writer at a time.
+/// - A default-constructed (or moved-from) CopyOnWrite holds an empty T without allocating.
+template<typename T>
+class CopyOnWrite {
+protected:
+  std::shared_ptr<T> ptr;   ///< nullptr for an empty T.
+
+  static const T & Empty() {
+    static const T empty;
+    return empty;
+  }
+
+  /// Is this the only reference to the contents? (Acquire pairs with the release in other
+  /// owners' reference count decrements, so their reads happen before our writes.)
+  bool IsUnique() const {
+    if (ptr.use_count() != 1) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+
+public:
+  CopyOnWrite() : ptr() { ; }
+  CopyOnWrite(const T & val) : ptr(std::make_shared<T>(val)) { ; }
+  CopyOnWrite(T && val) : ptr(std::make_shared<T>(std::move(val))) { ; }
+
+  CopyOnWrite(const CopyOnWrite &) = default;
+  CopyOnWrite(CopyOnWrite &&) = default;
+  CopyOnWrite & operator=(const CopyOnWrite &) = default;
+  CopyOnWrite & operator=(CopyOnWrite &&) = default;
+
+  const T & Get() const { return ptr ? *ptr : Empty(); }
+
+  /// Writable contents (copied first if shared).
+  T & Edit() {
+    if (!ptr) ptr = std::make_shared<T>();
+    else if (!IsUnique()) ptr = std::make_shared<T>(*ptr);
+    return *ptr;
+  }
+
+  /// Writable T for the caller to overwrite: the current contents if they are not shared,
+  /// otherwise a new, empty T.
+  T & Replace() {
+    if (!ptr || !IsUnique()) ptr = std::make_shared<T>();
+    return *ptr;
+  }
+
+  /// Are the contents shared with another copy?
+  bool IsShared() const { return ptr && ptr.use_count() > 1; }
+
+  /// Do we share contents with in? (Shared contents are equal without comparing them.)
+  bool SharesWith(const CopyOnWrite & in) const { return ptr && ptr == in.ptr; }
+
+  bool operator==(const CopyOnWrite & in) const { return SharesWith(in) || Get() == in.Get(); }
+  bool operator!=(const CopyOnWrite & in) const { return !(*this == in); }
+  bool operator<(const CopyOnWrite & in) const { return !SharesWith(in) && Get() < in.Get(); }
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef EXPERIMENT_LOG_H
+#define EXPERIMENT_LOG_H
+
+#include <iostream>
+
+/// Console output for experiments. Each thread writes to its own stream (std::cout unless set with
+/// SetExpLog), so replicates running side by side in one process (see BatchRunner.h) never share
+/// stream state: formatting flags, width, precision, and error bits.
+inline std::ostream *& ExpLogTarget() {
+  thread_local std::ostream * target = nullptr;
+  return target;
+}
+
+/// Stream for the calling thread's console output.
+inline std::ostream & ExpLog() {
+  std::ostream * target = ExpLogTarget();
+  return (target != nullptr) ? *target : std::cout;
+}
+
+/// Send the calling thread's console output to target (nullptr for std::cout).
+inline void SetExpLog(std::ostream * target) { ExpLogTarget() = target; }
+
+#endif
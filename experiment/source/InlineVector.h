@@ -0,0 +1,111 @@
+#ifndef INLINE_VECTOR_H
+#define INLINE_VECTOR_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "base/assert.h"
+
+/// Vector with fixed, inline capacity (no heap allocations): a trivially copyable stand-in for
+/// emp::vector where the maximum size is known at compile time (see EXP_COMPACT_GENOMES).
+/// - Supports the subset of the std::vector interface that genomes use; iterators are pointers.
+/// - Growing past CAPACITY is an error (asserted); callers check their size limits against CAPACITY
+///   up front.
+template<typename T, size_t CAPACITY>
+class InlineVector {
+public:
+  using value_type = T;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+protected:
+  uint32_t count;
+  std::array<T, CAPACITY> elems;
+
+public:
+  InlineVector() : count(0), elems() { ; }
+  InlineVector(size_t n, const T & val=T()) : count(0), elems() { resize(n, val); }
+  InlineVector(std::initializer_list<T> vals) : count(0), elems() { assign(vals.begin(), vals.end()); }
+  InlineVector(const std::vector<T> & vals) : count(0), elems() { assign(vals.begin(), vals.end()); }
+
+  size_t size() const { return count; }
+  bool empty() const { return !count; }
+  static constexpr size_t capacity() { return CAPACITY; }
+  static constexpr size_t max_size() { return CAPACITY; }
+
+  T * data() { return elems.data(); }
+  const T * data() const { return elems.data(); }
+  iterator begin() { return elems.data(); }
+  iterator end() { return elems.data() + count; }
+  const_iterator begin() const { return elems.data(); }
+  const_iterator end() const { return elems.data() + count; }
+
+  T & operator[](size_t id) { emp_assert(id < count, id, count); return elems[id]; }
+  const T & operator[](size_t id) const { emp_assert(id < count, id, count); return elems[id]; }
+  T & back() { emp_assert(count); return elems[count-1]; }
+  const T & back() const { emp_assert(count); return elems[count-1]; }
+
+  void clear() { count = 0; }
+  void reserve(size_t n) { emp_assert(n <= CAPACITY, n, CAPACITY); }
+
+  void resize(size_t n, const T & val=T()) {
+    emp_assert(n <= CAPACITY, n, CAPACITY);
+    if (n > count) std::fill(elems.begin() + count, elems.begin() + n, val);
+    count = (uint32_t)n;
+  }
+
+  template<typename... ARGS>
+  T & emplace_back(ARGS &&... args) {
+    emp_assert(count < CAPACITY, count, CAPACITY);
+    elems[count] = T(std::forward<ARGS>(args)...);
+    return elems[count++];
+  }
+  void push_back(const T & val) { emplace_back(val); }
+  void pop_back() { emp_assert(count); --count; }
+
+  template<typename IT>
+  void assign(IT first, IT last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  /// Insert n copies of val before pos.
+  iterator insert(iterator pos, size_t n, const T & val) {
+    emp_assert(count + n <= CAPACITY, count, n, CAPACITY);
+    std::copy_backward(pos, end(), end() + n);
+    std::fill(pos, pos + n, val);
+    count += (uint32_t)n;
+    return pos;
+  }
+
+  /// Insert [first, last) (which must not point into this vector) before pos.
+  template<typename IT>
+  iterator insert(iterator pos, IT first, IT last) {
+    const size_t n = (size_t)std::distance(first, last);
+    emp_assert(count + n <= CAPACITY, count, n, CAPACITY);
+    std::copy_backward(pos, end(), end() + n);
+    std::copy(first, last, pos);
+    count += (uint32_t)n;
+    return pos;
+  }
+
+  iterator erase(iterator first, iterator last) {
+    std::copy(last, end(), first);
+    count -= (uint32_t)(last - first);
+    return first;
+  }
+  iterator erase(iterator pos) { return erase(pos, pos + 1); }
+
+  bool operator==(const InlineVector & in) const { return count == in.count && std::equal(begin(), end(), in.begin()); }
+  bool operator!=(const InlineVector & in) const { return !(in == *this); }
+  bool operator<(const InlineVector & in) const {
+    return std::lexicographical_compare(begin(), end(), in.begin(), in.end());
+  }
+};
+
+#endif
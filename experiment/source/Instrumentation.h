@@ -0,0 +1,356 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+/// Phase timing + event counters for experiment RunSteps.
+/// - Only compiled in when EXP_INSTRUMENT is defined (make instrumented-<experiment>). Otherwise,
+///   EXP_INSTRUMENT_PHASE/EXP_INSTRUMENT_COUNT/EXP_INSTRUMENT_SCOPE expand to nothing and only
+///   InstrumentThread (a no-op) is defined; experiments guard everything else (e.g., timing file
+///   setup) with #ifdef EXP_INSTRUMENT.
+/// - EXP_INSTRUMENT_PHASE(PHASE) times the rest of the enclosing scope (wall + process CPU time).
+/// - EXP_INSTRUMENT_COUNT(COUNTER, N) adds N to the calling thread's counter. Counters are
+///   thread-local (no locking, no shared cache lines on the hot path); the InstrumentationFile
+///   sums every thread's counters when it writes a row.
+/// - Counters belong to a scope. EXP_INSTRUMENT_SCOPE() gives the rest of the enclosing C++ scope
+///   its own counters (e.g., one per batch replicate, so that replicates running side by side
+///   don't see each other's counts); threads started with InstrumentThread count into the scope
+///   of the thread that started them. Everything else counts into a process-wide scope.
+/// - Allocations are counted by replacing the global operator new, so instrumented builds must be
+///   single translation unit builds (as every native target in this project is).
+
+#ifdef EXP_INSTRUMENT
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+
+class Instrumentation {
+public:
+  /// RunStep phases. Snapshots happen during update; solution screens happen during evaluation.
+  enum PHASE { EVALUATION=0, SELECTION, UPDATE, SNAPSHOT, SCREEN, NUM_PHASES };
+  enum COUNTER { INSTRUCTIONS=0, TESTS_EVALUATED, COMPARATOR_OPS, CACHE_HITS, CACHE_MISSES, ALLOCATIONS, NUM_COUNTERS };
+
+  static constexpr size_t MAX_THREADS = 256; ///< Counter blocks; threads past this many share a block.
+
+  class Scope;
+
+  /// One thread's counters. A leased block is only written by the thread holding it (relaxed
+  /// load + store, so no locked instructions); a shared block (a scope's overflow block, used
+  /// once every block is leased) is written with fetch_add. Any thread may read.
+  struct alignas(64) Block {
+    std::array<std::atomic<uint64_t>, NUM_COUNTERS> counts;
+    std::array<std::atomic<uint64_t>, NUM_PHASES> wall_ns;
+    std::array<std::atomic<uint64_t>, NUM_PHASES> cpu_ns;
+    std::atomic<Scope *> owner;   ///< Scope holding the lease on this block (nullptr if free).
+    bool shared;
+
+    Block(bool _shared=false) : counts(), wall_ns(), cpu_ns(), owner(nullptr), shared(_shared) { Zero(); }
+
+    void Add(std::atomic<uint64_t> & val, uint64_t n) {
+      if (shared) val.fetch_add(n, std::memory_order_relaxed);
+      else val.store(val.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void Zero() {
+      for (auto & val : counts) val.store(0, std::memory_order_relaxed);
+      for (size_t i = 0; i < NUM_PHASES; ++i) {
+        wall_ns[i].store(0, std::memory_order_relaxed);
+        cpu_ns[i].store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  /// Totals across all threads (of a scope).
+  struct Totals {
+    std::array<uint64_t, NUM_COUNTERS> counts;
+    std::array<uint64_t, NUM_PHASES> wall_ns;
+    std::array<uint64_t, NUM_PHASES> cpu_ns;
+
+    void Add(const Block & block) {
+      for (size_t i = 0; i < NUM_COUNTERS; ++i) counts[i] += block.counts[i].load(std::memory_order_relaxed);
+      for (size_t i = 0; i < NUM_PHASES; ++i) {
+        wall_ns[i] += block.wall_ns[i].load(std::memory_order_relaxed);
+        cpu_ns[i] += block.cpu_ns[i].load(std::memory_order_relaxed);
+      }
+    }
+  };
+
+protected:
+  // Blocks are statically allocated so that registering a thread never allocates (operator new
+  // is itself instrumented).
+  static Block * GetBlocks() {
+    static Block blocks[MAX_THREADS];
+    return blocks;
+  }
+
+public:
+  /// A set of counters (see EXP_INSTRUMENT_SCOPE). Each thread counting into a scope leases a
+  /// block; the block's counts move to the scope's 'retired' block when the thread leaves the scope
+  /// (or exits), and the block goes back to the free list.
+  /// - A scope must outlive every thread counting into it (e.g., an experiment's worker threads must
+  ///   be joined before its replicate's scope ends).
+  class Scope {
+  protected:
+    Block retired;          ///< Counts of threads that have left this scope.
+    Block overflow;         ///< Shared by this scope's threads when every block is leased.
+    std::mutex mtx;         ///< Makes retiring a block and summing totals atomic to each other.
+
+  public:
+    Scope() : retired(true), overflow(true), mtx() { ; }
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+    /// Lease a free block (or the shared overflow block, if there are none).
+    Block * Claim() {
+      Block * blocks = GetBlocks();
+      for (size_t b = 0; b < MAX_THREADS; ++b) {
+        Scope * expected = nullptr;
+        if (blocks[b].owner.compare_exchange_strong(expected, this, std::memory_order_acquire)) return &blocks[b];
+      }
+      return &overflow;
+    }
+
+    /// End a lease from Claim.
+    void Release(Block * block) {
+      if (block == &overflow) return;
+      std::lock_guard<std::mutex> lock(mtx);
+      for (size_t i = 0; i < NUM_COUNTERS; ++i) retired.Add(retired.counts[i], block->counts[i].load(std::memory_order_relaxed));
+      for (size_t i = 0; i < NUM_PHASES; ++i) {
+        retired.Add(retired.wall_ns[i], block->wall_ns[i].load(std::memory_order_relaxed));
+        retired.Add(retired.cpu_ns[i], block->cpu_ns[i].load(std::memory_order_relaxed));
+      }
+      block->Zero();
+      block->owner.store(nullptr, std::memory_order_release);
+    }
+
+    Block & GetOverflow() { return overflow; }
+
+    Totals GetTotals() {
+      Totals totals = {};
+      std::lock_guard<std::mutex> lock(mtx);
+      totals.Add(retired);
+      totals.Add(overflow);
+      Block * blocks = GetBlocks();
+      for (size_t b = 0; b < MAX_THREADS; ++b) {
+        if (blocks[b].owner.load(std::memory_order_acquire) == this) totals.Add(blocks[b]);
+      }
+      return totals;
+    }
+  };
+
+protected:
+  /// The calling thread's block lease (released when the thread exits).
+  struct Lease {
+    Scope * scope;
+    Block * block;
+    bool exited;    ///< Thread-local destructors have run; counts (e.g., late frees) go to overflow.
+
+    ~Lease() { Release(); exited = true; }
+
+    void Release() {
+      if (block) scope->Release(block);
+      scope = nullptr;
+      block = nullptr;
+    }
+
+    void Enter(Scope & _scope) {
+      Release();
+      scope = &_scope;
+      block = exited ? &_scope.GetOverflow() : _scope.Claim();
+    }
+  };
+
+  static Lease & GetLease() {
+    thread_local Lease lease = { nullptr, nullptr, false };
+    return lease;
+  }
+
+  static Scope *& CurrentScope() {
+    thread_local Scope * scope = nullptr;
+    return scope;
+  }
+
+public:
+  /// Scope used by threads outside any EXP_INSTRUMENT_SCOPE.
+  static Scope & GetGlobalScope() {
+    static Scope scope;
+    return scope;
+  }
+
+  /// Scope the calling thread counts into.
+  static Scope & GetScope() { return CurrentScope() ? *CurrentScope() : GetGlobalScope(); }
+
+  /// Count into scope (on the calling thread) for the lifetime of this object.
+  class ScopeGuard {
+  protected:
+    Scope * prev;
+
+  public:
+    ScopeGuard(Scope & scope) : prev(CurrentScope()) { CurrentScope() = &scope; }
+    ScopeGuard(const ScopeGuard &) = delete;
+    ScopeGuard & operator=(const ScopeGuard &) = delete;
+    ~ScopeGuard() {
+      GetLease().Release();
+      CurrentScope() = prev;
+    }
+  };
+
+  static Block & Local() {
+    Lease & lease = GetLease();
+    Scope & scope = GetScope();
+    if (lease.scope != &scope) lease.Enter(scope);
+    return *lease.block;
+  }
+
+  static void Count(COUNTER counter, uint64_t n) {
+    Block & block = Local();
+    block.Add(block.counts[counter], n);
+  }
+
+  static uint64_t GetCPUTimeNS() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+  }
+
+  static uint64_t GetWallTimeNS() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  static const char * GetPhaseName(size_t phase) {
+    static const char * names[] = {"evaluation", "selection", "update", "snapshot", "screen"};
+    return names[phase];
+  }
+
+  static const char * GetCounterName(size_t counter) {
+    static const char * names[] = {"instructions", "tests_evaluated", "comparator_ops", "cache_hits", "cache_misses", "allocations"};
+    return names[counter];
+  }
+};
+
+/// Adds the lifetime of this object to a phase's wall/CPU time.
+/// - CPU time is process time, so it includes any worker threads running during the phase
+///   (and the background snapshot/checkpoint writers) -- and, in a batch, any other replicates
+///   running at the same time.
+class InstrumentPhaseTimer {
+protected:
+  Instrumentation::PHASE phase;
+  uint64_t wall_start;
+  uint64_t cpu_start;
+
+public:
+  InstrumentPhaseTimer(Instrumentation::PHASE _phase)
+    : phase(_phase), wall_start(Instrumentation::GetWallTimeNS()), cpu_start(Instrumentation::GetCPUTimeNS()) { ; }
+
+  ~InstrumentPhaseTimer() {
+    Instrumentation::Block & block = Instrumentation::Local();
+    block.Add(block.wall_ns[phase], Instrumentation::GetWallTimeNS() - wall_start);
+    block.Add(block.cpu_ns[phase], Instrumentation::GetCPUTimeNS() - cpu_start);
+  }
+};
+
+/// Writes instrumentation totals (of the scope that opens it) to a CSV file (e.g., timing.csv)
+/// every 'interval' generations.
+/// - Phase times (milliseconds) and counters are per-generation averages over the interval.
+/// - cache_hit_rate is hits / (hits + misses) over the interval.
+class InstrumentationFile {
+protected:
+  std::string filename;
+  std::ofstream out;
+  Instrumentation::Scope & scope;      ///< Counters of the thread that opened the file.
+  size_t interval;
+  size_t generations;                  ///< Generations since last row.
+  Instrumentation::Totals last;        ///< Totals as of last row.
+
+public:
+  InstrumentationFile(const std::string & fpath, size_t _interval)
+    : filename(fpath), out(fpath), scope(Instrumentation::GetScope()), interval(_interval), generations(0), last(scope.GetTotals())
+  {
+    out << "update,generations";
+    for (size_t i = 0; i < Instrumentation::NUM_PHASES; ++i) {
+      out << "," << Instrumentation::GetPhaseName(i) << "_wall_ms," << Instrumentation::GetPhaseName(i) << "_cpu_ms";
+    }
+    for (size_t i = 0; i < Instrumentation::NUM_COUNTERS; ++i) out << "," << Instrumentation::GetCounterName(i);
+    out << ",cache_hit_rate" << std::endl;
+  }
+
+  const std::string & GetFilename() const { return filename; }
+  void Flush() { out.flush(); }
+
+  /// Continue an existing file from its end (without writing the header again), e.g., when resuming
+  /// from a checkpoint.
+  void ReopenForAppend() {
+    out.close();
+    out.open(filename, std::ios::app);
+  }
+
+  /// Call at the end of every generation.
+  void EndStep(size_t update) {
+    ++generations;
+    if (!interval || update % interval) return;
+    const Instrumentation::Totals totals = scope.GetTotals();
+    const double gens = (double)generations;
+    out << update << "," << generations;
+    for (size_t i = 0; i < Instrumentation::NUM_PHASES; ++i) {
+      out << "," << (double)(totals.wall_ns[i] - last.wall_ns[i]) / (1000000.0 * gens)
+          << "," << (double)(totals.cpu_ns[i] - last.cpu_ns[i]) / (1000000.0 * gens);
+    }
+    for (size_t i = 0; i < Instrumentation::NUM_COUNTERS; ++i) {
+      out << "," << (double)(totals.counts[i] - last.counts[i]) / gens;
+    }
+    const uint64_t hits = totals.counts[Instrumentation::CACHE_HITS] - last.counts[Instrumentation::CACHE_HITS];
+    const uint64_t misses = totals.counts[Instrumentation::CACHE_MISSES] - last.counts[Instrumentation::CACHE_MISSES];
+    out << "," << ((hits + misses) ? (double)hits / (double)(hits + misses) : 0.0) << std::endl;
+    last = totals;
+    generations = 0;
+  }
+};
+
+#define EXP_INSTRUMENT_CONCAT_IMPL(A, B) A ## B
+#define EXP_INSTRUMENT_CONCAT(A, B) EXP_INSTRUMENT_CONCAT_IMPL(A, B)
+#define EXP_INSTRUMENT_PHASE(PHASE) InstrumentPhaseTimer EXP_INSTRUMENT_CONCAT(instrument_phase_timer_, __LINE__)(Instrumentation::PHASE)
+#define EXP_INSTRUMENT_COUNT(COUNTER, N) Instrumentation::Count(Instrumentation::COUNTER, (uint64_t)(N))
+#define EXP_INSTRUMENT_SCOPE() \
+  Instrumentation::Scope EXP_INSTRUMENT_CONCAT(instrument_scope_, __LINE__); \
+  Instrumentation::ScopeGuard EXP_INSTRUMENT_CONCAT(instrument_scope_guard_, __LINE__)(EXP_INSTRUMENT_CONCAT(instrument_scope_, __LINE__))
+
+/// Wrap a thread function (for std::thread) so that the new thread counts into the calling
+/// thread's scope.
+template<typename FUN_T>
+auto InstrumentThread(FUN_T fun) {
+  Instrumentation::Scope & scope = Instrumentation::GetScope();
+  return [&scope, fun](auto &&... args) mutable {
+    Instrumentation::ScopeGuard guard(scope);
+    return fun(std::forward<decltype(args)>(args)...);
+  };
+}
+
+// Count allocations.
+void * operator new(std::size_t size) {
+  Instrumentation::Count(Instrumentation::ALLOCATIONS, 1);
+  if (void * ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void * ptr) noexcept { std::free(ptr); }
+void operator delete(void * ptr, std::size_t) noexcept { std::free(ptr); }
+
+#else
+
+#define EXP_INSTRUMENT_PHASE(PHASE)
+#define EXP_INSTRUMENT_COUNT(COUNTER, N)
+#define EXP_INSTRUMENT_SCOPE()
+
+template<typename FUN_T>
+FUN_T InstrumentThread(FUN_T fun) { return fun; }
+
+#endif
+
+#endif
@@ -8,6 +8,8 @@
 #include "SortingNetworkOrg.h"
 #include "SortingTestOrg.h"
 #include "SortingTest.h"
+#include "SiteSampler.h"
+#include "Utilities.h"
 
 #include "TagLinearGP.h"
 #include "TagLinearGP_Utilities.h"
@@ -16,6 +18,9 @@
 // To make cleaner, could break each out into their own function.
 struct SortingNetworkMutator {
   using genome_t = SortingNetworkOrg::genome_t;
+  using network_t = genome_t::network_t;
+  using op_t = genome_t::op_t;
+  using index_t = genome_t::index_t;
 
   size_t MAX_NETWORK_SIZE;  ///< Maximum size network can grow
   size_t MIN_NETWORK_SIZE;  ///< Minimum size network can shrink
@@ -27,6 +32,8 @@ struct SortingNetworkMutator {
   double PER_PAIR_DEL;
   double PER_PAIR_SWAP;
 
+  bool skip_sampling;       ///< Skip to mutated sites (SiteSampler)? Otherwise, draw once per site (legacy random number stream).
+
   SortingNetworkMutator() 
     : MAX_NETWORK_SIZE(64),
       MIN_NETWORK_SIZE(1),
@@ -35,71 +42,121 @@ struct SortingNetworkMutator {
       PER_PAIR_DUP(0.001),
       PER_PAIR_INS(0.001),
       PER_PAIR_DEL(0.001),
-      PER_PAIR_SWAP(0.001)
+      PER_PAIR_SWAP(0.001),
+      skip_sampling(false)
   { ; }
 
+  /// Mutate genome in place.
+  /// - Substitutions are applied directly to genome. Once a deletion/insertion/duplication happens,
+  ///   the rest of the mutated network is built in the scratch network (reused across calls) and
+  ///   stored back into genome at the end.
+  /// - Genomes without mutations are left untouched (and keep sharing their network with their
+  ///   parent; see CopyOnWrite.h).
   size_t Mutate(emp::Random & rnd, genome_t & genome) {
-    using gene_t = emp::array<size_t, 2>;
-
-    genome_t new_genome;
+    // Read through a const network; edit() copies a shared network on the first in-place write.
+    const network_t * network = &static_cast<const genome_t &>(genome).GetNetwork();
+    auto edit = [&genome, &network]() -> network_t & {
+      network_t & ops = genome.GetNetwork();
+      network = &ops;
+      return ops;
+    };
+    network_t & out = scratch.GetNetwork();
+    bool rebuild = false;   // Are we copying (the rest of) the network into out?
     size_t mut_cnt = 0;
 
     size_t expected_size = genome.GetSize();
 
+    // Switch from mutating in place to building out (which has the first gene_cnt genes of network).
+    auto begin_rebuild = [&network, &out, &rebuild](size_t gene_cnt) {
+      out.clear();
+      out.insert(out.end(), network->begin(), network->begin() + gene_cnt);
+      rebuild = true;
+    };
+
+    // Sites: genes for deletions/insertions/duplications, gene indices (2 per gene) for substitutions.
+    SiteSampler del_sites, ins_sites, dup_sites, sub_sites;
+    if (skip_sampling) {
+      del_sites.Start(rnd, PER_PAIR_DEL);
+      ins_sites.Start(rnd, PER_PAIR_INS);
+      dup_sites.Start(rnd, PER_PAIR_DUP);
+      sub_sites.Start(rnd, PER_INDEX_SUB);
+    }
+
     // For gene (compare-exchange operation) in genome:
     // - copy gene to new genome, applying mutations
-    for (size_t geneID = 0; geneID < genome.GetSize(); ++geneID) {
+    for (size_t geneID = 0; geneID < network->size(); ++geneID) {
 
       // Do we delete?
-      if (rnd.P(PER_PAIR_DEL) && (expected_size > MIN_NETWORK_SIZE)) { 
+      const bool del = skip_sampling ? del_sites.Hit(rnd, geneID) : rnd.P(PER_PAIR_DEL);
+      if (del && (expected_size > MIN_NETWORK_SIZE)) { 
+        if (!rebuild) begin_rebuild(geneID);
         --expected_size;
         ++mut_cnt; 
         continue; 
       }
-      const size_t rhead = new_genome.GetSize(); // Where in the new genome are we copying to?
-      new_genome.GetNetwork().emplace_back(gene_t{genome[geneID][0], genome[geneID][1]});
-      // gene_t & gene_copy = new_genome.GetNetwork()[rhead];
+      const size_t rhead = rebuild ? out.size() : geneID; // Where in the new genome are we copying to?
+      if (rebuild) out.emplace_back((*network)[geneID]);
 
       // Do we insert?
-      if (rnd.P(PER_PAIR_INS) && (expected_size < MAX_NETWORK_SIZE)) {
-        new_genome.GetNetwork().emplace_back(gene_t{rnd.GetUInt(0, SORT_SEQ_SIZE), rnd.GetUInt(0, SORT_SEQ_SIZE)});
+      const bool ins = skip_sampling ? ins_sites.Hit(rnd, geneID) : rnd.P(PER_PAIR_INS);
+      if (ins && (expected_size < MAX_NETWORK_SIZE)) {
+        if (!rebuild) begin_rebuild(geneID + 1);
+        out.emplace_back(op_t{(index_t)rnd.GetUInt(0, SORT_SEQ_SIZE), (index_t)rnd.GetUInt(0, SORT_SEQ_SIZE)});
         ++expected_size;
         ++mut_cnt;
       }
 
       // Do we duplicate?
-      if (rnd.P(PER_PAIR_DUP) && (expected_size < MAX_NETWORK_SIZE)) {
-        new_genome.GetNetwork().emplace_back(gene_t{genome[geneID][0], genome[geneID][1]});
+      const bool dup = skip_sampling ? dup_sites.Hit(rnd, geneID) : rnd.P(PER_PAIR_DUP);
+      if (dup && (expected_size < MAX_NETWORK_SIZE)) {
+        if (!rebuild) begin_rebuild(geneID + 1);
+        out.emplace_back((*network)[geneID]);
         ++expected_size;
         ++mut_cnt;
       }
       
       // Do index changes?
-      if (rnd.P(PER_INDEX_SUB)) {
-        new_genome.GetNetwork()[rhead][0] = rnd.GetUInt(0, SORT_SEQ_SIZE);
+      if (skip_sampling ? sub_sites.Hit(rnd, 2*geneID) : rnd.P(PER_INDEX_SUB)) {
+        const index_t val = (index_t)rnd.GetUInt(0, SORT_SEQ_SIZE);
+        (rebuild ? out : edit())[rhead][0] = val;
         ++mut_cnt;
       }
 
-      if (rnd.P(PER_INDEX_SUB)) {
-        new_genome.GetNetwork()[rhead][1] = rnd.GetUInt(0, SORT_SEQ_SIZE);
+      if (skip_sampling ? sub_sites.Hit(rnd, 2*geneID + 1) : rnd.P(PER_INDEX_SUB)) {
+        const index_t val = (index_t)rnd.GetUInt(0, SORT_SEQ_SIZE);
+        (rebuild ? out : edit())[rhead][1] = val;
         ++mut_cnt;
       }
     }
 
     // Do swaps?
-    if (PER_PAIR_SWAP > 0.0) {
-      for (size_t geneID = 0; geneID < new_genome.GetSize(); ++geneID) {
+    const size_t new_size = rebuild ? out.size() : network->size();
+    auto swap_genes = [&out, &rebuild, &edit](size_t i, size_t j) {
+      network_t & ops = rebuild ? out : edit();
+      std::swap(ops[i], ops[j]);
+    };
+    if (PER_PAIR_SWAP > 0.0 && skip_sampling) {
+      SiteSampler swap_sites;
+      swap_sites.Start(rnd, PER_PAIR_SWAP);
+      for (size_t geneID = swap_sites.Next(); geneID < new_size; geneID = swap_sites.Take(rnd)) {
+        const size_t pos = rnd.GetUInt(new_size);
+        if (pos == geneID) continue;
+        swap_genes(geneID, pos);
+        ++mut_cnt;
+      }
+    } else if (PER_PAIR_SWAP > 0.0) {
+      for (size_t geneID = 0; geneID < new_size; ++geneID) {
         if (rnd.P(PER_PAIR_SWAP)) {
           // Select two random positions
-          const size_t pos = rnd.GetUInt(new_genome.GetSize());
+          const size_t pos = rnd.GetUInt(new_size);
           if (pos == geneID) continue;
-          std::swap(new_genome.GetNetwork()[geneID], new_genome.GetNetwork()[pos]);
+          swap_genes(geneID, pos);
           ++mut_cnt;
         }
       }
     }
 
-    genome = new_genome;
+    if (rebuild) StoreScratch(genome);
     return mut_cnt;
   }
 
@@ -107,35 +164,36 @@ struct SortingNetworkMutator {
   /// If (Valid(AB)) A = AB; If(Valid(BA)) B = BA;
   void Crossover1Pt(emp::Random & rnd, genome_t & genomeA, genome_t & genomeB) {
     const size_t min_size = emp::Min(genomeA.GetSize(), genomeB.GetSize());
-    const size_t max_size = emp::Max(genomeA.GetSize(), genomeB.GetSize());
-    const size_t xpoint = rnd.GetUInt(min_size);
-    genome_t genomeAB;
-    genome_t genomeBA;
-
-    for (size_t r = 0; r < xpoint; ++r) {
-      genomeAB.GetNetwork().emplace_back(genomeA[r]);
-      genomeBA.GetNetwork().emplace_back(genomeB[r]);
-    }
+    Crossover1Pt(rnd.GetUInt(min_size), genomeA, genomeB);
+  }
 
-    for (size_t r = xpoint; r < max_size; ++r) {
-      if (r < genomeA.GetSize()) { genomeBA.GetNetwork().emplace_back(genomeA[r]); } 
-      if (r < genomeB.GetSize()) { genomeAB.GetNetwork().emplace_back(genomeB[r]); }
+  /// Single point crossover at xpoint (< the smaller genome's size).
+  /// (Swaps the first xpoint genes of A and B, then swaps A and B; no copies of the tails.)
+  static void Crossover1Pt(size_t xpoint, genome_t & genomeA, genome_t & genomeB) {
+    emp_assert(!xpoint || xpoint < emp::Min(genomeA.GetSize(), genomeB.GetSize()), xpoint);
+    if (xpoint) {
+      network_t & netA = genomeA.GetNetwork();
+      network_t & netB = genomeB.GetNetwork();
+      std::swap_ranges(netA.begin(), netA.begin() + xpoint, netB.begin());
     }
-
-    genomeA = genomeAB;
-    genomeB = genomeBA;
+    std::swap(genomeA, genomeB);
   }
 
   /// Given genome A and B, crossover.
   /// If (Valid(ABA)) A = ABA; If(Valid(BAB)) B = BAB;
   void Crossover2Pt(emp::Random & rnd, genome_t & genomeA, genome_t & genomeB) {
-    // std::cout << "Genome A: "; genomeA.Print(); std::cout << std::endl;
-    // std::cout << "Genome B: "; genomeB.Print(); std::cout << std::endl;
-
     double pct1 = rnd.GetDouble();
     double pct2 = rnd.GetDouble();
     if (pct2 < pct1) std::swap(pct1, pct2); // pct1 < pct2
+    Crossover2Pt(pct1, pct2, genomeA, genomeB);
+  }
 
+  /// Two point crossover, cutting each genome at fractions pct1 <= pct2 of its size.
+  /// (Replaces the middle segments in place; A's middle segment is kept in the scratch network
+  /// when both offspring are built. Only the networks being replaced are edited, so a genome whose
+  /// offspring is invalid keeps sharing its network.)
+  void Crossover2Pt(double pct1, double pct2, genome_t & genomeA, genome_t & genomeB) {
+    emp_assert(pct1 <= pct2, pct1, pct2);
     size_t pos1A = (size_t)genomeA.GetSize() * pct1;
     size_t pos1B = (size_t)genomeB.GetSize() * pct1;
 
@@ -145,61 +203,84 @@ struct SortingNetworkMutator {
     size_t ABA_size = pos1A + (pos2B - pos1B) + (genomeA.GetSize() - pos2A);
     size_t BAB_size = pos1B + (pos2A - pos1A) + (genomeB.GetSize() - pos2B);
 
-    // std::cout << "pct1=" << pct1 << std::endl;
-    // std::cout << "pct2=" << pct2 << std::endl;
-
-    // std::cout << "pA = [" << pos1A << "," << pos2A << "]" << std::endl;
-    // std::cout << "pB = [" << pos1B << "," << pos2B << "]" << std::endl;
-
-    // std::cout << "ABA size = " << ABA_size << std::endl;
-    // std::cout << "BAB size = " << BAB_size << std::endl;
-
     // ABA: |---A---|---B---|---A---|
     // BAB: |---B---|---A---|---B---|
     const bool build_aba = ABA_size <= MAX_NETWORK_SIZE && ABA_size >= MIN_NETWORK_SIZE;
     const bool build_bab = BAB_size <= MAX_NETWORK_SIZE && BAB_size >= MIN_NETWORK_SIZE;
-    genome_t genomeABA;
-    genome_t genomeBAB;
+
+    // Reads go through const networks (edits to one genome never touch the other's storage, even if
+    // they share it).
+    const network_t & srcA = static_cast<const genome_t &>(genomeA).GetNetwork();
+    const network_t & srcB = static_cast<const genome_t &>(genomeB).GetNetwork();
+    network_t & midA = scratch.GetNetwork();
+    if (build_aba && build_bab) midA.assign(srcA.begin() + pos1A, srcA.begin() + pos2A);
 
     if (build_aba) {
-      // std::cout << "Buildinb ABA" << std::endl;    
-      // Build ABA
-      for (size_t r = 0; r < pos1A; ++r) { 
-        // std::cout << "  Copying A[" << r << "]: " << genomeA[r][0] << "=>" << genomeA[r][1] << std::endl; 
-        genomeABA.GetNetwork().emplace_back(genomeA[r]); 
-      }
-      for (size_t r = pos1B; r < pos2B; ++r) { 
-        // std::cout << "  Copying B[" << r << "]: " << genomeB[r][0] << "=>" << genomeB[r][1] << std::endl;
-        genomeABA.GetNetwork().emplace_back(genomeB[r]); 
-      }
-      for (size_t r = pos2A; r < genomeA.GetSize(); ++r) {
-        // std::cout << "  Copying A[" << r << "]: " << genomeA[r][0] << "=>" << genomeA[r][1] << std::endl; 
-        genomeABA.GetNetwork().emplace_back(genomeA[r]); 
-      }
-      emp_assert(genomeABA.GetSize() <= MAX_NETWORK_SIZE && genomeABA.GetSize() >= MIN_NETWORK_SIZE, ABA_size, genomeABA.GetSize(), pos1A, pos1B, pos2A, pos2B);
+      ReplaceSegment(genomeA.GetNetwork(), pos1A, pos2A, srcB.begin() + pos1B, srcB.begin() + pos2B);
+      emp_assert(genomeA.GetSize() <= MAX_NETWORK_SIZE && genomeA.GetSize() >= MIN_NETWORK_SIZE, ABA_size, genomeA.GetSize(), pos1A, pos1B, pos2A, pos2B);
     }
 
     if (build_bab) {
-      // std::cout << "Building BAB" << std::endl;
-      // Build BAB
-      for (size_t r = 0; r < pos1B; ++r) { 
-        // std::cout << "  Copying B[" << r << "]: " << genomeB[r][0] << "=>" << genomeB[r][1] << std::endl;
-        genomeBAB.GetNetwork().emplace_back(genomeB[r]); 
-      }
-      for (size_t r = pos1A; r < pos2A; ++r) { 
-        // std::cout << "  Copying A[" << r << "]: " << genomeA[r][0] << "=>" << genomeA[r][1] << std::endl; 
-        genomeBAB.GetNetwork().emplace_back(genomeA[r]); 
-      }
-      for (size_t r = pos2B; r < genomeB.GetSize(); ++r) {
-        // std::cout << "  Copying B[" << r << "]: " << genomeB[r][0] << "=>" << genomeB[r][1] << std::endl;
-        genomeBAB.GetNetwork().emplace_back(genomeB[r]); 
+      if (build_aba) ReplaceSegment(genomeB.GetNetwork(), pos1B, pos2B, midA.begin(), midA.end());
+      else ReplaceSegment(genomeB.GetNetwork(), pos1B, pos2B, srcA.begin() + pos1A, srcA.begin() + pos2A);
+      emp_assert(genomeB.GetSize() <= MAX_NETWORK_SIZE && genomeB.GetSize() >= MIN_NETWORK_SIZE, BAB_size, genomeB.GetSize(), pos1A, pos1B, pos2A, pos2B);
+    }
+
+  }
+
+  /// Given genome A and B, crossover.
+  /// Each of the first min(|A|, |B|) genes is swapped between A and B with probability 0.5.
+  void CrossoverUniform(emp::Random & rnd, genome_t & genomeA, genome_t & genomeB) {
+    CounterRandom masks;
+    masks.Reseed(rnd);
+    CrossoverUniform(masks, genomeA, genomeB);
+  }
+
+  /// Uniform crossover, swapping gene i if bit i%64 of masks.GetUInt64(i/64) is set.
+  /// (Sizes never change, so there's nothing to validate. Swaps are branchless masked XORs on the
+  /// genes' indices, which compilers can vectorize, particularly on compact genomes.)
+  static void CrossoverUniform(const CounterRandom & masks, genome_t & genomeA, genome_t & genomeB) {
+    const size_t min_size = emp::Min(genomeA.GetSize(), genomeB.GetSize());
+    if (!min_size) return;
+    network_t & netA = genomeA.GetNetwork();
+    network_t & netB = genomeB.GetNetwork();
+    op_t * opsA = netA.data();
+    op_t * opsB = netB.data();
+    for (size_t block = 0; block * 64 < min_size; ++block) {
+      const uint64_t mask = masks.GetUInt64(block);
+      const size_t begin = block * 64;
+      const size_t end = emp::Min(begin + 64, min_size);
+      for (size_t i = begin; i < end; ++i) {
+        const index_t swap = (index_t)0 - (index_t)((mask >> (i - begin)) & 1);  // All ones to swap.
+        const index_t diff0 = (opsA[i][0] ^ opsB[i][0]) & swap;
+        const index_t diff1 = (opsA[i][1] ^ opsB[i][1]) & swap;
+        opsA[i][0] ^= diff0; opsB[i][0] ^= diff0;
+        opsA[i][1] ^= diff1; opsB[i][1] ^= diff1;
       }
-      emp_assert(genomeBAB.GetSize() <= MAX_NETWORK_SIZE && genomeBAB.GetSize() >= MIN_NETWORK_SIZE, BAB_size, genomeBAB.GetSize(), pos1A, pos1B, pos2A, pos2B);
     }
+  }
 
-    if (build_aba) genomeA = genomeABA;
-    if (build_bab) genomeB = genomeBAB;
+protected:
+  genome_t scratch;   ///< Reused by Mutate/Crossover2Pt (one mutator per thread).
+
+  /// Move the scratch network into genome, keeping the larger buffer as scratch (so neither
+  /// allocates unless genome's network has never been this large). A shared network is replaced,
+  /// not copied.
+  void StoreScratch(genome_t & genome) {
+    network_t & network = genome.ReplaceNetwork();
+    network_t & out = scratch.GetNetwork();
+    if (out.size() <= network.capacity()) network.assign(out.begin(), out.end());
+    else std::swap(network, out);
+  }
 
+  /// Replace network[begin, end) with [src_begin, src_end) (shifting the rest of network as needed).
+  template<typename IT>
+  static void ReplaceSegment(network_t & network, size_t begin, size_t end, IT src_begin, IT src_end) {
+    const size_t old_len = end - begin;
+    const size_t new_len = (size_t)(src_end - src_begin);
+    if (new_len < old_len) network.erase(network.begin() + begin + new_len, network.begin() + end);
+    else if (new_len > old_len) network.insert(network.begin() + end, new_len - old_len, op_t());
+    std::copy(src_begin, src_end, network.begin() + begin);
   }
 
 };
@@ -217,44 +298,75 @@ struct SortingTestMutator {
   double PER_SEQ_INVERSION;
   double PER_SEQ_RANDOMIZE;
 
+  bool skip_sampling;   ///< Skip to mutated sites (SiteSampler)? Otherwise, draw once per site (legacy random number stream).
+
   SortingTestMutator() 
     : bit_mode(true),
       MAX_VALUE(1),
       MIN_VALUE(0),
       PER_SITE_SUB(0.001),
       PER_SEQ_INVERSION(0.01),
-      PER_SEQ_RANDOMIZE(0.0)
+      PER_SEQ_RANDOMIZE(0.0),
+      skip_sampling(false)
   { ; }
 
+  /// Mutate genome in place. The test set is only edited (copied first if it's shared; see
+  /// CopyOnWrite.h) once a mutation hits.
   size_t Mutate(emp::Random & rnd, genome_t & genome) {
     size_t mut_cnt = 0;
+
+    // Sites: tests for randomizations/inversions; sites across all tests (in order) for substitutions.
+    SiteSampler randomize_tests, inversion_tests, sub_sites;
+    if (skip_sampling) {
+      randomize_tests.Start(rnd, PER_SEQ_RANDOMIZE);
+      inversion_tests.Start(rnd, PER_SEQ_INVERSION);
+      sub_sites.Start(rnd, PER_SITE_SUB);
+    }
+    size_t site_offset = 0;
     
     // For each sorting test in test set.
-    for (size_t testID = 0; testID < genome.test_set.size(); ++testID) {
-      SortingTest & test = genome.test_set[testID];
+    const size_t num_tests = genome.test_set.Get().size();
+    for (size_t testID = 0; testID < num_tests; ++testID) {
+      auto edit = [&genome, testID]() -> SortingTest & { return genome.test_set.Edit()[testID]; };
+      const size_t test_size = genome.test_set.Get()[testID].GetSize();
+      const size_t site_begin = site_offset;
+      site_offset += test_size;
       
-      if (rnd.P(PER_SEQ_RANDOMIZE)) {
-        test.RandomizeTest(rnd);
+      if (skip_sampling ? randomize_tests.Hit(rnd, testID) : rnd.P(PER_SEQ_RANDOMIZE)) {
+        edit().RandomizeTest(rnd);
         ++mut_cnt;
         continue;
       }
       
       // For each site in test
-      for (size_t i = 0; i < test.GetSize(); ++i) {
-        if (rnd.P(PER_SITE_SUB)) {
+      if (skip_sampling) {
+        sub_sites.SkipTo(rnd, site_begin);
+        for (size_t site = sub_sites.Next(); site < site_offset; site = sub_sites.Take(rnd)) {
+          const size_t i = site - site_begin;
+          SortingTest & test = edit();
           if (bit_mode) test[i] = (int)!((bool)test[i]);
           else test[i] = rnd.GetInt(MIN_VALUE, MAX_VALUE+1);
           ++mut_cnt;
         }
+      } else {
+        for (size_t i = 0; i < test_size; ++i) {
+          if (rnd.P(PER_SITE_SUB)) {
+            SortingTest & test = edit();
+            if (bit_mode) test[i] = (int)!((bool)test[i]);
+            else test[i] = rnd.GetInt(MIN_VALUE, MAX_VALUE+1);
+            ++mut_cnt;
+          }
+        }
       }
       // Inversions?
-      if (rnd.P(PER_SEQ_INVERSION)) {
-        int p0 = (int)rnd.GetUInt(0, test.GetSize());
-        int p1 = (int)rnd.GetUInt(0, test.GetSize());
+      if (skip_sampling ? inversion_tests.Hit(rnd, testID) : rnd.P(PER_SEQ_INVERSION)) {
+        int p0 = (int)rnd.GetUInt(0, test_size);
+        int p1 = (int)rnd.GetUInt(0, test_size);
         if (p1 < p0) std::swap(p0, p1);
         emp_assert(p0 <= p1);
+        SortingTest & test = edit();
         while (p0 < p1) {
-          std::swap(test[p0], test[p1]);
+          test.SwapSites(p0, p1);
           ++p0; --p1;
         }
       }
@@ -286,6 +398,16 @@ struct TagLGPMutator {
   double PER_MOD_DUP;
   double PER_MOD_DEL;
 
+  bool skip_sampling;   ///< Skip to mutated sites (SiteSampler)? Otherwise, draw once per site (legacy random number stream).
+
+  TagLGPMutator()
+    : MAX_PROGRAM_LEN(128), MIN_PROGRAM_LEN(1),
+      PER_BIT_FLIP(0.001), PER_INST_SUB(0.005), PER_INST_INS(0.005), PER_INST_DEL(0.005),
+      PER_PROG_SLIP(0.05), PER_MOD_DUP(0.05), PER_MOD_DEL(0.05),
+      skip_sampling(false),
+      modules(), num_modules(0), module_membership(), dels(), danglers()
+  { ; }
+
   enum ModuleMutType { DUP=0, DEL, NONE };
 
   struct ModuleInfo {
@@ -309,35 +431,35 @@ struct TagLGPMutator {
     // Whole module duplications/deletions
     if (PER_MOD_DEL != 0.0 || PER_MOD_DUP != 0.0) {
       
-      // Scan for modules
+      // Scan for modules (into scratch buffers, reused across calls)
       size_t mod_mut_cnt = 0;
-      emp::vector<ModuleInfo> modules;  // Modules we're going to dup or delete.
-      emp::vector<size_t> module_membership(program.GetSize(), 0);
-      emp::vector<bool> dels(program.GetSize(), false);
-      emp::vector<size_t> danglers;
+      num_modules = 0;  // Modules we're going to dup or delete: modules[0, num_modules).
+      module_membership.assign(program.GetSize(), 0);
+      dels.assign(program.GetSize(), false);
+      danglers.clear();
       
       for (size_t i = 0; i < program.GetSize(); ++i) {
         // inst_t & inst = program[i];
         if (ilib.HasProperty(program[i].id, inst_prop_t::MODULE)) {
-          if (modules.size()) { modules.back().end = i; }
-          const size_t mod_id = modules.size();
-          modules.emplace_back(i, -1);
-          modules.back().positions.emplace_back(i); // Add start position to module
+          if (num_modules) { modules[num_modules-1].end = i; }
+          const size_t mod_id = num_modules;
+          AddModule(i).positions.emplace_back(i); // Add start position to module
           module_membership[i] = mod_id;
         } else {
           // Not a new module definition
-          if (modules.size()) { modules.back().positions.emplace_back(i); module_membership[i] = modules.size()-1; }
+          if (num_modules) { modules[num_modules-1].positions.emplace_back(i); module_membership[i] = num_modules-1; }
           else { danglers.emplace_back(i); }
         }
       }
 
       // Take care of danglers.
-      if (modules.size()) {
-        if (modules[0].begin == 0) { modules.back().end = program.GetSize(); }  // Case where last module does not wrap.
-        else { modules.back().end = modules[0].begin-1; }                       // Last module wraps around.
+      if (num_modules) {
+        ModuleInfo & last = modules[num_modules-1];
+        if (modules[0].begin == 0) { last.end = program.GetSize(); }  // Case where last module does not wrap.
+        else { last.end = modules[0].begin-1; }                       // Last module wraps around.
         for (size_t i = 0; i < danglers.size(); ++i) {
-          modules.back().positions.emplace_back(danglers[i]); 
-          module_membership[i] = modules.size()-1;
+          last.positions.emplace_back(danglers[i]); 
+          module_membership[i] = num_modules-1;
         }
       }
 
@@ -354,7 +476,7 @@ struct TagLGPMutator {
       // }
 
       // Are we mutating any of the modules?
-      for (size_t i = 0; i < modules.size(); ++i) {
+      for (size_t i = 0; i < num_modules; ++i) {
         bool mod_dup = rnd.P(PER_MOD_DUP);
         bool mod_del = rnd.P(PER_MOD_DEL);
         if (mod_dup && mod_del) { mod_dup = false; mod_dup = false; } // If we would both dup and delete module, do nothing instead.
@@ -435,6 +557,17 @@ struct TagLGPMutator {
       }
     }
 
+    // Sites: instructions (by read position) for deletions/insertions/substitutions; argument tag
+    // bits (in order, across copied instructions) for bit flips.
+    SiteSampler del_sites, ins_sites, sub_sites, flip_sites;
+    if (skip_sampling) {
+      del_sites.Start(rnd, PER_INST_DEL);
+      ins_sites.Start(rnd, PER_INST_INS);
+      sub_sites.Start(rnd, PER_INST_SUB);
+      flip_sites.Start(rnd, PER_BIT_FLIP);
+    }
+    size_t bit_offset = 0;
+
     program_t new_program(program.GetInstLibPtr());
     for (rhead = 0; rhead < (int)program.GetSize(); ++rhead) {
       // Check for slip.
@@ -454,7 +587,8 @@ struct TagLGPMutator {
       }
       
       // Instruction deletion
-      if (rnd.P(PER_INST_DEL) && ((expected_size-1)>=(int)MIN_PROGRAM_LEN)) {
+      const bool del = skip_sampling ? del_sites.Hit(rnd, (size_t)rhead) : rnd.P(PER_INST_DEL);
+      if (del && ((expected_size-1)>=(int)MIN_PROGRAM_LEN)) {
         --expected_size;
         ++mut_cnt;
         continue;
@@ -465,21 +599,31 @@ struct TagLGPMutator {
       new_program.PushInst(program[rhead]);
 
       // Instruction insertion
-      if (rnd.P(PER_INST_INS) && ((expected_size+1)<=(int)MAX_PROGRAM_LEN)) {
+      const bool ins = skip_sampling ? ins_sites.Hit(rnd, (size_t)rhead) : rnd.P(PER_INST_INS);
+      if (ins && ((expected_size+1)<=(int)MAX_PROGRAM_LEN)) {
         ++expected_size;
         ++mut_cnt;
         new_program.PushInst(TagLGP::GenRandTagGPInst(rnd, ilib));
       }
 
       // Instruction substitution
-      if (rnd.P(PER_INST_SUB)) {
+      if (skip_sampling ? sub_sites.Hit(rnd, (size_t)rhead) : rnd.P(PER_INST_SUB)) {
         ++mut_cnt;
-        new_program[whead].id = rnd.GetUInt(ilib.GetSize());
+        new_program.EditInst(whead).id = rnd.GetUInt(ilib.GetSize());
       }
 
       // Instruction argument bit flips
       for (size_t arg = 0; arg < new_program[whead].arg_tags.size(); ++arg) {
-        tag_t & tag = new_program[whead].arg_tags[arg];
+        tag_t & tag = new_program.EditInst(whead).arg_tags[arg];
+        if (skip_sampling) {
+          const size_t bit_begin = bit_offset;
+          bit_offset += tag.GetSize();
+          for (size_t bit = flip_sites.Next(); bit < bit_offset; bit = flip_sites.Take(rnd)) {
+            ++mut_cnt;
+            tag.Toggle(bit - bit_begin);
+          }
+          continue;
+        }
         for (size_t k = 0; k < tag.GetSize(); ++k) {
           if (rnd.P(PER_BIT_FLIP)) {
             ++mut_cnt;
@@ -489,11 +633,28 @@ struct TagLGPMutator {
       }
     }
 
-    program = new_program;
+    if (mut_cnt) program = new_program;   // Unmutated programs keep sharing their parent's instructions.
     return mut_cnt;
   }
 
-
+protected:
+  // Module scan scratch, reused across calls to Mutate (one mutator per thread).
+  emp::vector<ModuleInfo> modules;        ///< Modules found this call: modules[0, num_modules).
+  size_t num_modules;
+  emp::vector<size_t> module_membership;
+  emp::vector<bool> dels;
+  emp::vector<size_t> danglers;
+
+  /// Start the next module (reusing a previous call's ModuleInfo, and its positions buffer, if there is one).
+  ModuleInfo & AddModule(int begin) {
+    if (num_modules == modules.size()) modules.emplace_back(begin, -1);
+    ModuleInfo & mod = modules[num_modules++];
+    mod.begin = begin;
+    mod.end = -1;
+    mod.mut = ModuleMutType::NONE;
+    mod.positions.clear();
+    return mod;
+  }
 
 };
 
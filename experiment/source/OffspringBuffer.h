@@ -0,0 +1,113 @@
+#ifndef OFFSPRING_BUFFER_H
+#define OFFSPRING_BUFFER_H
+
+#include <cstdint>
+#include <limits>
+
+#include "base/Ptr.h"
+#include "base/vector.h"
+#include "Evolve/World.h"
+#include "tools/Random.h"
+
+#include "Utilities.h"
+#include "WorkerPool.h"
+
+/// Separates offspring mutation from births in a synchronous emp::World (use instead of the world's
+/// auto-mutate):
+/// - Collect: births (from any selection scheme) are diverted into the buffer instead of the next
+///   population. While collecting, the world's birth position function records the offspring's
+///   genome and parent, then returns an invalid position (so DoBirth discards the organism).
+/// - Mutate: buffered genomes are mutated in parallel (see WorkerPool). Offspring i is mutated with
+///   its own emp::Random, seeded from (seed, update, i), so results depend neither on the number of
+///   threads nor on the order offspring are mutated.
+/// - Place: offspring are born into the next population, in collection order, through DoBirth (so
+///   systematics and birth signals see mutated genomes).
+/// Buffered genomes are reused across generations. They keep sharing placed offspring's contents
+/// until the next collection overwrites them (offspring share their parent's contents at mutation
+/// time anyway, so this costs no copies; see CopyOnWrite.h).
+template<typename ORG>
+class OffspringBuffer {
+public:
+  using world_t = emp::World<ORG>;
+  using genome_t = typename ORG::genome_t;
+
+protected:
+  emp::Ptr<world_t> world;
+  bool placing;                     ///< Are births being placed (rather than collected)?
+  size_t num_offspring;             ///< Offspring collected (the first num_offspring buffer entries).
+  size_t num_placed;                ///< Offspring placed so far (their next population position).
+  emp::vector<genome_t> genomes;
+  emp::vector<size_t> parent_ids;
+  emp::vector<size_t> mut_cnts;
+
+  void Collect(const genome_t & genome, size_t parent_id) {
+    if (num_offspring < genomes.size()) {
+      genomes[num_offspring] = genome;
+      parent_ids[num_offspring] = parent_id;
+    } else {
+      genomes.emplace_back(genome);
+      parent_ids.emplace_back(parent_id);
+    }
+    ++num_offspring;
+  }
+
+public:
+  OffspringBuffer() : world(nullptr), placing(false), num_offspring(0), num_placed(0), genomes(), parent_ids(), mut_cnts() { ; }
+
+  OffspringBuffer(const OffspringBuffer &) = delete;
+  OffspringBuffer & operator=(const OffspringBuffer &) = delete;
+
+  /// Divert _world's births into this buffer (call after configuring _world's population structure,
+  /// which must be synchronous; replaces its birth position function).
+  void Attach(world_t & _world) {
+    world = &_world;
+    placing = false;
+    num_offspring = 0;
+    world->SetAddBirthFun([this](emp::Ptr<ORG> new_org, emp::WorldPosition parent_pos) {
+      if (placing) return emp::WorldPosition(num_placed++, 1);  // Append to the next population.
+      Collect(new_org->GetGenome(), parent_pos.GetIndex());
+      return emp::WorldPosition();
+    });
+  }
+
+  size_t GetSize() const { return num_offspring; }
+  const genome_t & GetGenome(size_t id) const { emp_assert(id < num_offspring); return genomes[id]; }
+  size_t GetParentID(size_t id) const { emp_assert(id < num_offspring); return parent_ids[id]; }
+  size_t GetMutCnt(size_t id) const { emp_assert(id < mut_cnts.size()); return mut_cnts[id]; }
+
+  /// Seed for offspring id's random number generator (a positive int, as emp::Random expects).
+  static int GetOffspringSeed(int seed, size_t update, size_t id) {
+    const uint64_t key = CounterRandom::Mix((uint64_t)(uint32_t)seed + 0x9E3779B97F4A7C15ULL * (update + 1));
+    const uint64_t mixed = CounterRandom::Mix(key + 0x9E3779B97F4A7C15ULL * (id + 1));
+    return 1 + (int)(mixed % (uint64_t)(std::numeric_limits<int>::max() - 1));
+  }
+
+  /// Mutate collected offspring on pool's workers with mutate(rnd, genome, worker_id), which returns
+  /// the number of mutations.
+  template<typename MUTATE_T>
+  void Mutate(WorkerPool & pool, int seed, size_t update, const MUTATE_T & mutate) {
+    if (mut_cnts.size() < num_offspring) mut_cnts.resize(num_offspring);
+    pool.ParallelFor(num_offspring, [this, seed, update, &mutate](size_t id, size_t worker_id) {
+      emp::Random rnd(GetOffspringSeed(seed, update, id));
+      mut_cnts[id] = mutate(rnd, genomes[id], worker_id);
+    });
+  }
+
+  /// Place collected offspring into the (empty) next population, in collection order, then call
+  /// on_birth(org, mut_cnt) for each. Empties the buffer.
+  template<typename ON_BIRTH_T>
+  void Place(const ON_BIRTH_T & on_birth) {
+    emp_assert(world);
+    emp_assert(mut_cnts.size() >= num_offspring, "Mutate before placing.");
+    placing = true;
+    num_placed = 0;
+    for (size_t id = 0; id < num_offspring; ++id) {
+      world->DoBirth(genomes[id], parent_ids[id]);
+      on_birth(world->GetNextOrg(id), mut_cnts[id]);
+    }
+    placing = false;
+    num_offspring = 0;
+  }
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef POPULATION_STATS_H
+#define POPULATION_STATS_H
+
+#include <algorithm>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+/// Summary of one per-organism value over a population.
+struct SummaryStats {
+  size_t count;
+  double min;
+  double max;
+  double mean;
+  double variance;   ///< Population variance.
+  size_t argmax;     ///< Position of the (first) maximum value.
+
+  SummaryStats() : count(0), min(0), max(0), mean(0), variance(0), argmax(0) { ; }
+
+  /// Mean / max (as emp::DataNode's inferiority).
+  double GetInferiority() const { return max ? mean / max : 0.0; }
+};
+
+/// Per-organism values (e.g., fitness, pass counts, genome sizes), gathered into flat columns once
+/// per generation (right after evaluation) and summarized in a single pass per column.
+/// - Data files and population-level bookkeeping read summaries from here instead of recomputing
+///   values through fitness functions or data nodes.
+/// - The summary loop has no branches on the data (min/max are selects; sums use a shifted sum of
+///   squares), so compilers can vectorize it.
+class PopulationStats {
+protected:
+  emp::vector<emp::vector<double>> columns;
+  emp::vector<SummaryStats> stats;
+
+public:
+  PopulationStats(size_t num_columns=0) : columns(num_columns), stats(num_columns) { ; }
+
+  size_t GetNumColumns() const { return columns.size(); }
+  size_t GetSize() const { return columns.size() ? columns[0].size() : 0; }
+
+  /// Set number of organisms (values are overwritten by the next gather).
+  void Resize(size_t num_orgs) {
+    for (emp::vector<double> & column : columns) column.resize(num_orgs);
+  }
+
+  double * GetColumn(size_t col) { emp_assert(col < columns.size()); return columns[col].data(); }
+  const emp::vector<double> & GetValues(size_t col) const { emp_assert(col < columns.size()); return columns[col]; }
+
+  /// Recalculate all summaries (call after gathering values).
+  void Summarize() {
+    for (size_t c = 0; c < columns.size(); ++c) stats[c] = Summarize(columns[c]);
+  }
+
+  const SummaryStats & Get(size_t col) const { emp_assert(col < stats.size()); return stats[col]; }
+
+  static SummaryStats Summarize(const emp::vector<double> & vals) {
+    SummaryStats s;
+    s.count = vals.size();
+    if (!s.count) return s;
+    const double * v = vals.data();
+    // Shift by the first value so the sum of squares doesn't lose precision when values are large
+    // relative to their spread.
+    const double shift = v[0];
+    double lo = v[0];
+    double hi = v[0];
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for (size_t i = 0; i < s.count; ++i) {
+      const double x = v[i];
+      lo = (x < lo) ? x : lo;
+      hi = (x > hi) ? x : hi;
+      const double d = x - shift;
+      sum += d;
+      sum_sq += d * d;
+    }
+    const double n = (double)s.count;
+    const double mean_d = sum / n;
+    s.min = lo;
+    s.max = hi;
+    s.mean = shift + mean_d;
+    s.variance = std::max(0.0, sum_sq / n - mean_d * mean_d);
+    s.argmax = (size_t)(std::find(vals.begin(), vals.end(), hi) - vals.begin());
+    return s;
+  }
+};
+
+#endif
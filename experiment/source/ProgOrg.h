@@ -5,6 +5,7 @@
 #include "base/vector.h"
 #include "tools/Random.h"
 
+#include "ScoreMatrix.h"
 #include "TagLinearGP.h"
 
 template<size_t TAG_WIDTH>
@@ -16,43 +17,36 @@ public:
   using genome_t = typename TagLGP::TagLinearGP_TW<TAG_WIDTH>::Program;
 
   struct Phenotype {
-    // emp::vector<double> test_results;
-    emp::vector<double> test_scores;
+    ScoreView<double> test_scores;   ///< Score on each test. (Row of the experiment's score matrix.)
     double total_score;
     
-    emp::vector<bool> test_passes;
+    ScoreView<uint8_t> test_passes;  ///< Pass (1) or fail (0) on each test. (Row of the experiment's pass matrix.)
     size_t num_passes;
     size_t num_fails;
 
     size_t total_submissions;
 
-    void Reset(size_t s=0) {
-      // test_results.clear();
-      // test_results.resize(s, 0);
+    Phenotype()
+      : test_scores(), total_score(0), test_passes(), num_passes(0), num_fails(0), total_submissions(0) { ; }
 
-      test_scores.clear();
-      test_scores.resize(s, 0);
+    /// Bind to this evaluation's scores and passes (unbound by default).
+    void Reset(const ScoreView<double> & scores=ScoreView<double>(),
+               const ScoreView<uint8_t> & passes=ScoreView<uint8_t>()) {
+      test_scores = scores;
       total_score = 0;
-      
-      test_passes.clear();
-      test_passes.resize(s, false);
+      test_passes = passes;
       num_passes = 0;
       num_fails = 0;
-
       total_submissions = 0;
     }
 
-    void RecordScore(size_t id, double val) {
-      emp_assert(id < test_scores.size());
+    void RecordScore(double val) {
       total_score += val;
-      test_scores[id] = val;
     }
 
-    void RecordPass(size_t id, bool pass) {
-      emp_assert(id < test_passes.size());
+    void RecordPass(bool pass) {
       if (pass) ++num_passes;
       else ++num_fails;
-      test_passes[id] = pass;
     }
 
     void RecordSubmission(bool sub) {
@@ -65,11 +59,13 @@ protected:
 
   phenotype_t phenotype;
   genome_t genome;
+  bool dirty;         ///< Does phenotype need to be (re-)evaluated? (Clean offspring can copy their parent's.)
+  size_t parent_pos;  ///< Parent's position in the previous generation.
 
 public:
 
   ProgOrg(const genome_t & _g) 
-    : phenotype(), genome(_g) { ; }
+    : phenotype(), genome(_g), dirty(true), parent_pos(0) { ; }
 
   ProgOrg(const ProgOrg &) = default;
   ProgOrg(ProgOrg &&) = default;
@@ -80,7 +76,15 @@ public:
   phenotype_t & GetPhenotype() { return phenotype; }
   const phenotype_t & GetPhenotype() const { return phenotype; }
 
-  void SetGenome(const genome_t & in) { genome = in; }
+  void SetGenome(const genome_t & in) { genome = in; dirty = true; }
+
+  bool IsDirty() const { return dirty; }
+  size_t GetParentPos() const { return parent_pos; }
+
+  /// Mark as an (as yet) unmodified copy of the organism at parent_pos.
+  void SetClone(size_t pos) { dirty = false; parent_pos = pos; }
+  void MarkDirty() { dirty = true; }
+  void ClearDirty() { dirty = false; }
 
   // Todo: randomize genome
 
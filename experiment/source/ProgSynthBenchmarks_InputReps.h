@@ -22,6 +22,9 @@
 
 #include "parser.hpp"
 
+#include "Instrumentation.h"
+#include "ScoreMatrix.h"
+#include "StringPool.h"
 #include "TestCaseSet.h"
 #include "Utilities.h"
 
@@ -222,33 +225,32 @@ class TestOrg_Base {
   public:
 
     struct Phenotype {
-      emp::vector<double> test_scores;
+      ScoreView<double> test_scores;   ///< Score of each program on this test. (Column of the experiment's score matrix.)
       double total_score;
 
-      emp::vector<bool> test_passes;
+      ScoreView<uint8_t> test_passes;  ///< Pass (1) or fail (0) of each program on this test. (Column of the experiment's pass matrix.)
       size_t num_passes;
       size_t num_fails;
 
-      void Reset(size_t s=0) {
-        test_scores.clear();
-        test_scores.resize(s, 0);
-        test_passes.clear();
-        test_passes.resize(s, false);
+      Phenotype() : test_scores(), total_score(0), test_passes(), num_passes(0), num_fails(0) { ; }
+
+      /// Bind to this evaluation's scores and passes (unbound by default).
+      void Reset(const ScoreView<double> & scores=ScoreView<double>(),
+                 const ScoreView<uint8_t> & passes=ScoreView<uint8_t>()) {
+        test_scores = scores;
+        total_score = 0;
+        test_passes = passes;
         num_passes = 0;
         num_fails = 0;
       }
 
-      void RecordScore(size_t id, double val) {
-        emp_assert(id < test_scores.size());
+      void RecordScore(double val) {
         total_score += val;
-        test_scores[id] = val;
       }
 
-      void RecordPass(size_t id, bool pass) {
-        emp_assert(id < test_passes.size());
+      void RecordPass(bool pass) {
         if (pass) ++num_passes;
         else ++num_fails;
-        test_passes[id] = pass;
       }
     };
 
@@ -283,6 +285,20 @@ Problem_NumberIO_input_t GenRandomTestInput_NumberIO(emp::Random & rand, const s
   emp_assert(int_range.first < int_range.second);
   return Problem_NumberIO_input_t{rand.GetInt(int_range.first, int_range.second), rand.GetDouble(double_range.first, double_range.second)};
 }
+
+/// Bulk-generate random NumberIO inputs, filling every entry of (preallocated) inputs.
+void GenRandomTestInputs_NumberIO(emp::Random & rand, emp::vector<Problem_NumberIO_input_t> & inputs,
+                                  const std::pair<int, int> & int_range, const std::pair<double, double> & double_range) {
+  emp_assert(double_range.first < double_range.second);
+  emp_assert(int_range.first < int_range.second);
+  CounterRandom crand;
+  crand.Reseed(rand);
+  const size_t n = inputs.size();
+  for (size_t i = 0; i < n; ++i) {
+    inputs[i].first = crand.GetInt(2*i, int_range.first, int_range.second);
+    inputs[i].second = crand.GetDouble(2*i+1, double_range.first, double_range.second);
+  }
+}
   
 Problem_NumberIO_output_t GenCorrectOut_NumberIO(const Problem_NumberIO_input_t & input) {
   return input.first + input.second;
@@ -432,6 +448,15 @@ Problem_SmallOrLarge_input_t GenRandomTestInput_SmallOrLarge(emp::Random & rand,
   return rand.GetInt(int_range.first, int_range.second+1);
 }
 
+/// Bulk-generate random SmallOrLarge inputs, filling every entry of (preallocated) inputs.
+void GenRandomTestInputs_SmallOrLarge(emp::Random & rand, emp::vector<Problem_SmallOrLarge_input_t> & inputs, const std::pair<int,int> & int_range) {
+  emp_assert(int_range.first < int_range.second);
+  CounterRandom crand;
+  crand.Reseed(rand);
+  const size_t n = inputs.size();
+  for (size_t i = 0; i < n; ++i) inputs[i] = crand.GetInt(i, int_range.first, int_range.second+1);
+}
+
 Problem_SmallOrLarge_output_t GenCorrectOut_SmallOrLarge(const Problem_SmallOrLarge_input_t & input) {
   if (input < SmallOrLarge__SMALL_THRESH) return SmallOrLarge__SMALL_STR;
   else if (input >= SmallOrLarge__LARGE_THRESH) return SmallOrLarge__LARGE_STR;
@@ -828,6 +853,7 @@ class TestOrg_CompareStringLengths: public TestOrg_Base {
   protected:
     genome_t genome;
     out_t out;
+    std::array<str_handle_t, 3> input_handles; ///< Shared handles to genome strings (refreshed by CalcOut).
 
   public:
     TestOrg_CompareStringLengths(const genome_t & _g) : genome(_g), out() { ; }
@@ -835,7 +861,13 @@ class TestOrg_CompareStringLengths: public TestOrg_Base {
     genome_t & GetGenome() { return genome; }
     const genome_t & GetGenome() const { return genome; }
 
-    void CalcOut() { out = GenCorrectOut_CompareStringLengths(genome); }
+    /// Get shared input string handles (O(1) to load into hardware memory).
+    const std::array<str_handle_t, 3> & GetInputHandles() const { return input_handles; }
+
+    void CalcOut() { 
+      out = GenCorrectOut_CompareStringLengths(genome); 
+      for (size_t i = 0; i < genome.size(); ++i) input_handles[i] = MakeStrHandle(genome[i]);
+    }
 
     out_t & GetCorrectOut() { return out; }
     const out_t & GetCorrectOut() const { return out; }   
@@ -1032,6 +1064,15 @@ Problem_CollatzNumbers_input_t GenRandomTestInput_CollatzNumbers(emp::Random & r
   return rand.GetInt(num_range.first, num_range.second+1);
 }
 
+/// Bulk-generate random CollatzNumbers inputs, filling every entry of (preallocated) inputs.
+void GenRandomTestInputs_CollatzNumbers(emp::Random & rand, emp::vector<Problem_CollatzNumbers_input_t> & inputs,
+                                        const std::pair<int, int> & num_range) {
+  CounterRandom crand;
+  crand.Reseed(rand);
+  const size_t n = inputs.size();
+  for (size_t i = 0; i < n; ++i) inputs[i] = crand.GetInt(i, num_range.first, num_range.second+1);
+}
+
 Problem_CollatzNumbers_output_t GenCorrectOut_CollatzNumbers(const Problem_CollatzNumbers_input_t & input) {
   emp_assert(input > 0);
   // std::cout << "Generating collatz seq - input = " << input << std::endl;
@@ -1064,8 +1105,10 @@ class TestOrg_CollatzNumbers : public TestOrg_Base {
       // std::cout << "Calc out w/cache!" << std::endl;
       emp_assert(out_cache != nullptr);
       if (emp::Has(*out_cache, genome)) {
+        EXP_INSTRUMENT_COUNT(CACHE_HITS, 1);
         out = (*out_cache)[genome];
       } else {
+        EXP_INSTRUMENT_COUNT(CACHE_MISSES, 1);
         out = GenCorrectOut_CollatzNumbers(genome);
         (*out_cache)[genome] = out;
       }
@@ -1361,6 +1404,7 @@ class TestOrg_StringLengthsBackwards : public TestOrg_Base {
   protected:
     genome_t genome;
     out_t out;
+    emp::vector<str_handle_t> input_handles; ///< Shared handles to genome strings (refreshed by CalcOut).
 
   public:
     TestOrg_StringLengthsBackwards(const genome_t & _g) : genome(_g), out() { ; }
@@ -1368,7 +1412,14 @@ class TestOrg_StringLengthsBackwards : public TestOrg_Base {
     genome_t & GetGenome() { return genome; }
     const genome_t & GetGenome() const { return genome; }
 
-    void CalcOut() { out = GenCorrectOut_StringLengthsBackwards(genome); }
+    /// Get shared input string handles (O(1) each to load into hardware memory).
+    const emp::vector<str_handle_t> & GetInputHandles() const { return input_handles; }
+
+    void CalcOut() { 
+      out = GenCorrectOut_StringLengthsBackwards(genome); 
+      input_handles.resize(genome.size());
+      for (size_t i = 0; i < genome.size(); ++i) input_handles[i] = MakeStrHandle(genome[i]);
+    }
 
     out_t & GetCorrectOut() { return out; }
     const out_t & GetCorrectOut() const { return out; }   
@@ -2681,6 +2732,14 @@ Problem_SumOfSquares_input_t GenRandomTestInput_SumOfSquares(emp::Random & rnd,
   return rnd.GetInt(num_range.first, num_range.second+1);
 }
 
+/// Bulk-generate random SumOfSquares inputs, filling every entry of (preallocated) inputs.
+void GenRandomTestInputs_SumOfSquares(emp::Random & rnd, emp::vector<Problem_SumOfSquares_input_t> & inputs, const std::pair<int, int> & num_range) {
+  CounterRandom crand;
+  crand.Reseed(rnd);
+  const size_t n = inputs.size();
+  for (size_t i = 0; i < n; ++i) inputs[i] = crand.GetInt(i, num_range.first, num_range.second+1);
+}
+
 
 Problem_SumOfSquares_output_t GenCorrectOut_SumOfSquares(const Problem_SumOfSquares_input_t & input) {
   if (input < (int)SumOfSquaresLookup.size()) {
@@ -3601,6 +3660,18 @@ Problem_Median_input_t GenRandomTestInput_Median(emp::Random & rand,
   return input;
 }
 
+/// Bulk-generate random Median inputs, filling every entry of (preallocated) inputs.
+void GenRandomTestInputs_Median(emp::Random & rand, emp::vector<Problem_Median_input_t> & inputs,
+                                const std::pair<int, int> & num_range) {
+  CounterRandom crand;
+  crand.Reseed(rand);
+  const size_t n = inputs.size();
+  const size_t w = std::tuple_size<Problem_Median_input_t>::value;
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t k = 0; k < w; ++k) inputs[i][k] = crand.GetInt(i*w+k, num_range.first, num_range.second+1);
+  }
+}
+
 /// Generate correct output
 Problem_Median_output_t GenCorrectOut_Median(const Problem_Median_input_t & input) {
   const int min_val = emp::Min(input[0], input[1], input[2]);
@@ -3779,6 +3850,18 @@ Problem_Smallest_input_t GenRandomTestInput_Smallest(emp::Random & rand,
   return input;
 }
 
+/// Bulk-generate random Smallest inputs, filling every entry of (preallocated) inputs.
+void GenRandomTestInputs_Smallest(emp::Random & rand, emp::vector<Problem_Smallest_input_t> & inputs,
+                                  const std::pair<int, int> & num_range) {
+  CounterRandom crand;
+  crand.Reseed(rand);
+  const size_t n = inputs.size();
+  const size_t w = std::tuple_size<Problem_Smallest_input_t>::value;
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t k = 0; k < w; ++k) inputs[i][k] = crand.GetInt(i*w+k, num_range.first, num_range.second+1);
+  }
+}
+
 /// Generate correct output
 Problem_Smallest_output_t GenCorrectOut_Smallest(const Problem_Smallest_input_t & input) {
   int smallest = input[0];
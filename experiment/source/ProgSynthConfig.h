@@ -10,11 +10,13 @@ EMP_BUILD_CONFIG(ProgramSynthesisConfig,
   VALUE(PROG_POP_SIZE, size_t, 1024, "Population size for programs"),
   VALUE(TEST_POP_SIZE, size_t, 1024, "Population size for tests - how many tests exist at once?"),
   VALUE(EVALUATION_MODE, size_t, 0, "How are programs evaluated? \n0: cohorts \n1: full (on all tests) \n2: program only cohorts \n3: TEST_DOWNSAMPLING treatment"),
+  VALUE(SPARSE_EVALUATION, bool, false, "Only evaluate programs whose genomes changed (unmutated offspring copy their parent's results)? Requires STATIC/STATIC_GEN training examples and full or program only cohort evaluation."),
   VALUE(PROG_COHORT_SIZE, size_t, 32, "How big should random cohorts be (only relevant when evaluating with random cohort method)?"),
   VALUE(TEST_COHORT_SIZE, size_t, 32, "How big should random cohorts be (only relevant when evaluating with random cohort method)?"),
   VALUE(TRAINING_EXAMPLE_MODE, size_t, 0, "How do training examples change over time? \n0: co-evolution \n1: static \n2: random \n3: Static-gen \n4: STATIC_COEVO "),
   VALUE(PROBLEM, std::string, "number-io", "Which problem to use?"),
   VALUE(BENCHMARK_DATA_DIR, std::string, "../data/prog-synth-examples", "Location to look for problem test case data."),
+  VALUE(TESTING_SET_STREAM_CHUNK_SIZE, size_t, 0, "Stream testing set from disk this many test cases at a time instead of loading it into memory (0 to load entire testing set)."),
 
   GROUP(SELECTION_GROUP, "Settings specific to selection (both tests and programs)."),
   VALUE(PROG_SELECTION_MODE, size_t, 1, "How are selected? \n0: LEXICASE \n1: COHORT_LEXICASE \n2: TOURNAMENT \n3: DRIFT \n4: PROG_ONLY_COHORT_LEXICASE \n5: TEST_DOWNSAMPLING treatment"),
@@ -26,6 +28,8 @@ EMP_BUILD_CONFIG(ProgramSynthesisConfig,
   VALUE(PROG_TOURNAMENT_SIZE, size_t, 4, "How big should tournaments be during program tournament selection?"),
   VALUE(TEST_TOURNAMENT_SIZE, size_t, 4, "How big should tournaments be during test tournament selection?"),
   VALUE(DISCRIMINATORY_LEXICASE_TESTS, bool, false, "Should we use discriminatory test cases for lexicase selection?"),
+  VALUE(PROG_LEXICASE_CASE_ORDER, size_t, 0, "How are test cases ordered during program LEXICASE selection? \n0: UNIFORM (random shuffle) \n1: DIFFICULTY (biased toward often-failed cases) \n2: DISCRIMINATION (biased toward cases that split the population)"),
+  VALUE(TEST_DIFFICULTY_SMOOTHING, double, 0.1, "Weight given to newest observations when updating running per-test-case pass rates (1.0 = no memory)."),
 
   GROUP(PROGRAM_GROUP, "General settings specific to programs."),
   VALUE(MIN_PROG_SIZE, size_t, 1, "Minimum program size"),
@@ -38,6 +42,9 @@ EMP_BUILD_CONFIG(ProgramSynthesisConfig,
   VALUE(PROG_MUT__PER_PROG_SLIP, double, 0.05, "Program per-program slip mutation rate."),
   VALUE(PROG_MUT__PER_MOD_DUP, double, 0.05, "Program per-module whole-module duplication rate."),
   VALUE(PROG_MUT__PER_MOD_DEL, double, 0.05, "Program per-module whole-module deletion rate."),
+  VALUE(MUTATION_SAMPLING_MODE, size_t, 1, "How are per-site mutations placed? \n0: One random draw per site (legacy random number stream; reproduces earlier runs)\n1: Skip ahead to the next mutated site (geometric gaps; same rates, fewer random draws)"),
+  VALUE(OFFSPRING_MUTATION_MODE, size_t, 0, "When are program offspring mutated? \n0: At birth, during selection (shared random number stream; reproduces earlier runs)\n1: In a batch after selection, in parallel on REPRODUCTION_THREADS (each offspring's random number stream is seeded from the seed, update, and its birth order)"),
+  VALUE(REPRODUCTION_THREADS, size_t, 0, "Number of worker threads for batched offspring mutation (in addition to the main thread). Results do not depend on the number of threads."),
 
   GROUP(HARDWARE_GROUP, "Settings specific to TagLGP virtual hardware"),
   VALUE(MIN_TAG_SPECIFICITY, double, 0.0, "What is the minimum tag similarity required for a tag to successfully reference another tag?"),
@@ -168,8 +175,21 @@ EMP_BUILD_CONFIG(ProgramSynthesisConfig,
   GROUP(DATA_COLLECTION_GROUP, "Settings specific to data collection."),
   VALUE(DATA_DIRECTORY, std::string, "./output", "Where should we dump output files?"),
   VALUE(SNAPSHOT_INTERVAL, size_t, 1000, "How often should we take population snapshots?"),
+  VALUE(SNAPSHOT_QUEUE_SIZE, size_t, 2, "How many population snapshots can be queued for the background writer? (0 to write snapshots synchronously)"),
+  VALUE(OUTPUT_FORMAT, size_t, 0, "Format for population snapshots and solution files: \n0: CSV\n1: Columnar binary (.col; export with columnar_export)"),
+  VALUE(VALIDATION_MODE, size_t, 0, "How are programs validated on the testing set at each snapshot? \n0: Full (every program, every test case)\n1: Unique (run each unique genotype once per snapshot)\n2: Incremental (unique, and reuse results for genotypes validated at the previous snapshot)\n3: Sampled (unique, on a stratified random sample of the testing set; snapshots include pass rate estimates + confidence intervals)"),
+  VALUE(VALIDATION_SAMPLE_SIZE, size_t, 1000, "Number of testing set cases to sample for validation (VALIDATION_MODE=3)."),
+  VALUE(VALIDATION_SAMPLE_STRATA, size_t, 10, "Number of (contiguous) testing set strata to sample from (VALIDATION_MODE=3)."),
   VALUE(SUMMARY_STATS_INTERVAL, size_t, 1000, "How often should we output summary stats?"),
-  VALUE(SOLUTION_SCREEN_INTERVAL, size_t, 1000, "How often should we screen entire population for solutions?")
+  VALUE(SYSTEMATICS_MODE, size_t, 0, "How are phylogenies (program + test systematics) stored? \n0: Full (every taxon stores its genome; phylogeny metrics recalculated every update)\n1: Compact (program taxa store genome hashes + diffs against their parent; phylogeny metrics only calculated when systematics files are written)"),
+  VALUE(SYSTEMATICS_KEYFRAME_INTERVAL, size_t, 16, "Compact systematics: maximum number of diffs between a taxon and a full stored genome (bounds genome decoding cost)."),
+  VALUE(SYSTEMATICS_MAX_MB, size_t, 1024, "Compact systematics: hard memory cap (in MB; 0 for no cap), checked every update. Past the cap, genomes of the oldest extinct ancestors are dropped, then genomes of the oldest living taxa (hash-only)."),
+  VALUE(SOLUTION_SCREEN_INTERVAL, size_t, 1000, "How often should we screen entire population for solutions?"),
+  VALUE(SOLUTION_SCREEN_THREADS, size_t, 1, "Number of background threads verifying solution candidates on the testing set (0 to verify queued candidates on the main thread, at the start of the next update)."),
+  VALUE(SOLUTION_SCREEN_QUEUE_SIZE, size_t, 1024, "Maximum number of solution candidates waiting for verification (candidates past this are dropped, and resubmitted if seen again)."),
+  VALUE(SOLUTION_SCREEN_CACHE_SIZE, size_t, 1000000, "Maximum number of rejected solution candidates remembered (by genome hash) to avoid re-screening them (0 for no limit)."),
+  VALUE(CHECKPOINT_INTERVAL, size_t, 0, "How often should we checkpoint experiment state? (0 to only checkpoint on SIGTERM/SIGUSR1)"),
+  VALUE(CHECKPOINT_FILE, std::string, "checkpoint.bin", "Checkpoint file name (in DATA_DIRECTORY). Resume with --resume <file>.")
   
 )
 
@@ -2,9 +2,14 @@
 #define PROGRAMMING_SYNTHESIS_EXP_H
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <utility>
@@ -27,12 +32,27 @@
 
 #include "TagLinearGP.h"
 #include "Selection.h"
+#include "TestDifficultyIndex.h"
+#include "ValidationSample.h"
+#include "PopulationStats.h"
+#include "CompactSystematics.h"
+#include "Checkpoint.h"
+#include "ExperimentLog.h"
+#include "SystematicsCheckpoint.h"
+#include "SnapshotWriter.h"
+#include "SolutionScreener.h"
+#include "ScoreMatrix.h"
+#include "ColumnarFile.h"
+#include "Instrumentation.h"
 #include "Mutators.h"
+#include "OffspringBuffer.h"
+#include "WorkerPool.h"
 
 #include "ProgOrg.h"
 #include "ProgSynthConfig.h"
 #include "ProgSynthBenchmarks_InputReps.h"
 #include "TestCaseSet.h"
+#include "TestCaseStream.h"
 #include "TagLinearGP.h"
 #include "TagLinearGP_InstLib.h"
 #include "TagLinearGP_Utilities.h"
@@ -76,6 +96,12 @@ constexpr size_t MEM_SIZE = TAG_WIDTH;
 enum TRAINING_EXAMPLE_MODE_TYPE { COEVOLUTION=0, STATIC, RANDOM, STATIC_GEN, STATIC_COEVO };
 enum EVALUATION_TYPE { COHORT=0, FULL=1, PROG_ONLY_COHORT=2, TEST_DOWNSAMPLING };
 enum SELECTION_TYPE { LEXICASE=0, COHORT_LEXICASE, TOURNAMENT, DRIFT, PROG_ONLY_COHORT_LEXICASE, TEST_DOWNSAMPLING_LEXICASE };
+enum OUTPUT_FORMAT_TYPE { CSV_OUTPUT=0, COLUMNAR_OUTPUT=1 };
+enum VALIDATION_MODE_TYPE { FULL_VALIDATION=0, UNIQUE_VALIDATION, INCREMENTAL_VALIDATION, SAMPLED_VALIDATION };
+enum SYSTEMATICS_MODE_TYPE { FULL_SYSTEMATICS=0, COMPACT_SYSTEMATICS };
+enum MUTATION_SAMPLING_MODE_TYPE { PER_SITE_SAMPLING=0, SKIP_SAMPLING };
+enum OFFSPRING_MUTATION_MODE_TYPE { AT_BIRTH=0, BATCHED };
+enum POP_STATS_COLUMN { FITNESS_STAT=0, PASSES_STAT, SIZE_STAT }; ///< Population stats columns (tests have no SIZE_STAT).
 
 enum PROBLEM_ID { NumberIO=0,
                   SmallOrLarge,
@@ -145,6 +171,67 @@ std::unordered_map<std::string, ProblemInfo> problems = {
   {"grade", {PROBLEM_ID::Grade, "training-examples-grade.csv", "testing-examples-grade.csv"}}
 };
 
+/// Checkpoint programs as sequences of (instruction ID, argument tags).
+template<>
+struct CheckpointIO<ProgOrg<TAG_WIDTH>::genome_t> {
+  using program_t = ProgOrg<TAG_WIDTH>::genome_t;
+  static void Write(std::ostream & out, const program_t & prog) {
+    CheckpointWrite(out, (uint64_t)prog.GetSize());
+    for (size_t i = 0; i < prog.GetSize(); ++i) {
+      CheckpointWrite(out, (uint64_t)prog[i].id);
+      // Same layout as a vector of tags.
+      CheckpointWrite(out, (uint64_t)prog[i].arg_tags.size());
+      for (const auto & tag : prog[i].arg_tags) CheckpointWrite(out, tag);
+    }
+  }
+  static void Read(std::istream & in, program_t & prog) {
+    uint64_t size = 0;
+    CheckpointRead(in, size);
+    prog.Clear();
+    for (size_t i = 0; i < size; ++i) {
+      uint64_t id = 0;
+      emp::vector<emp::BitSet<TAG_WIDTH>> arg_tags;
+      CheckpointRead(in, id);
+      CheckpointRead(in, arg_tags);
+      prog.PushInst((size_t)id, arg_tags);
+    }
+  }
+};
+
+/// Compact systematics store programs as instruction sequences.
+template<>
+struct CompactGenomeTraits<ProgOrg<TAG_WIDTH>::genome_t> {
+  using program_t = ProgOrg<TAG_WIDTH>::genome_t;
+  using elem_t = TagLGP::TagLinearGP_TW<TAG_WIDTH>::inst_t;
+  static const emp::vector<elem_t> & GetSeq(const program_t & prog) { return prog.GetInstSeq(); }
+  static void SetSeq(program_t & prog, emp::vector<elem_t> && seq) { prog.program.Replace() = std::move(seq); }
+  static void Hash(uint64_t & hash, const elem_t & inst) {
+    CompactGenomeHash(hash, (uint64_t)inst.id);
+    for (const auto & tag : inst.arg_tags) {
+      uint64_t bits = 0;
+      for (size_t b = 0; b < TAG_WIDTH; ++b) {
+        bits = (bits << 1) | (uint64_t)tag.Get(b);
+        if (b % 64 == 63) { CompactGenomeHash(hash, bits); bits = 0; }
+      }
+      CompactGenomeHash(hash, bits);
+    }
+  }
+  static size_t GetBytes(const elem_t &) { return sizeof(elem_t); }  // Argument tags are stored inline.
+};
+
+/// Mix a program's output on one test case into a hash of its outputs across a testing set (so
+/// that streamed validation can measure behavioral diversity without keeping every output).
+template<typename T>
+void HashValidationOutput(uint64_t & hash, const T & output) {
+  CompactGenomeHash(hash, (uint64_t)std::hash<T>()(output));
+}
+
+template<typename T>
+void HashValidationOutput(uint64_t & hash, const emp::vector<T> & output) {
+  CompactGenomeHash(hash, (uint64_t)output.size());
+  for (const T & val : output) HashValidationOutput(hash, val);
+}
+
 class ProgramSynthesisExperiment {
 public:
   using hardware_t = typename TagLGP::TagLinearGP_TW<TAG_WIDTH>;
@@ -159,7 +246,9 @@ public:
 
   using test_org_phen_t = TestOrg_Base::Phenotype;
 
-  using prog_taxon_t = typename emp::Systematics<prog_org_t, prog_org_gen_t>::taxon_t;
+  using prog_sys_info_t = CompactGenome<prog_org_gen_t>;
+  using prog_systematics_t = emp::Systematics<prog_org_t, prog_sys_info_t>;
+  using prog_taxon_t = typename prog_systematics_t::taxon_t;
 
   // test world aliases
   using prob_NumberIO_world_t = emp::World<TestOrg_NumberIO>;
@@ -277,11 +366,13 @@ protected:
   size_t PROG_POP_SIZE;
   size_t TEST_POP_SIZE;
   size_t EVALUATION_MODE;
+  bool SPARSE_EVALUATION;
   size_t PROG_COHORT_SIZE;
   size_t TEST_COHORT_SIZE;
   size_t TRAINING_EXAMPLE_MODE;
   std::string PROBLEM;
   std::string BENCHMARK_DATA_DIR;
+  size_t TESTING_SET_STREAM_CHUNK_SIZE;
 
   size_t PROG_SELECTION_MODE;
   size_t TEST_SELECTION_MODE;
@@ -292,6 +383,8 @@ protected:
   size_t PROG_TOURNAMENT_SIZE;
   size_t TEST_TOURNAMENT_SIZE;
   bool DISCRIMINATORY_LEXICASE_TESTS;
+  size_t PROG_LEXICASE_CASE_ORDER;
+  double TEST_DIFFICULTY_SMOOTHING;
 
   size_t MIN_PROG_SIZE;
   size_t MAX_PROG_SIZE;
@@ -303,6 +396,9 @@ protected:
   double PROG_MUT__PER_PROG_SLIP;
   double PROG_MUT__PER_MOD_DUP;
   double PROG_MUT__PER_MOD_DEL;
+  size_t MUTATION_SAMPLING_MODE;
+  size_t OFFSPRING_MUTATION_MODE;
+  size_t REPRODUCTION_THREADS;
 
   double MIN_TAG_SPECIFICITY;
   size_t MAX_CALL_DEPTH;
@@ -417,8 +513,21 @@ protected:
   // - Data collection group -
   std::string DATA_DIRECTORY;
   size_t SUMMARY_STATS_INTERVAL;
+  size_t SYSTEMATICS_MODE;
+  size_t SYSTEMATICS_KEYFRAME_INTERVAL;
+  size_t SYSTEMATICS_MAX_MB;
   size_t SNAPSHOT_INTERVAL;
+  size_t SNAPSHOT_QUEUE_SIZE;
+  size_t OUTPUT_FORMAT;
+  size_t VALIDATION_MODE;
+  size_t VALIDATION_SAMPLE_SIZE;
+  size_t VALIDATION_SAMPLE_STRATA;
   size_t SOLUTION_SCREEN_INTERVAL;
+  size_t SOLUTION_SCREEN_THREADS;
+  size_t SOLUTION_SCREEN_QUEUE_SIZE;
+  size_t SOLUTION_SCREEN_CACHE_SIZE;
+  size_t CHECKPOINT_INTERVAL;
+  std::string CHECKPOINT_FILE;
 
   // Experiment variables
   bool setup;
@@ -437,7 +546,7 @@ protected:
 
   emp::Ptr<inst_lib_t> inst_lib;
   emp::Ptr<hardware_t> eval_hardware;
-  size_t eval_time;
+  std::atomic<size_t> test_eval_cnt;   ///< Total number of program-test evaluations run, including solution screening (used for benchmarking).
 
   size_t smallest_prog_sol_size;
   bool solution_found;
@@ -446,13 +555,59 @@ protected:
   emp::BitSet<TAG_WIDTH> call_tag;
   
   emp::Ptr<prog_world_t> prog_world;
-  emp::Ptr<emp::Systematics<prog_org_t, prog_org_gen_t>> prog_genotypic_systematics;
+  ScoreMatrix<double> prog_test_scores;         ///< Scores of programs (rows) on tests (columns); phenotypes view it.
+  ScoreMatrix<uint8_t> prog_test_passes;        ///< Passes of programs (rows) on tests (columns); phenotypes view it.
+  emp::vector<prog_org_phen_t> prev_prog_phenotypes; ///< Program phenotype totals from the previous generation (SPARSE_EVALUATION).
+  ScoreMatrix<double> prev_prog_test_scores;    ///< Program scores from the previous generation (SPARSE_EVALUATION).
+  ScoreMatrix<uint8_t> prev_prog_test_passes;   ///< Program passes from the previous generation (SPARSE_EVALUATION).
+  PopulationStats prog_pop_stats;   ///< Program fitness/passes/size, gathered after evaluation.
+  PopulationStats test_pop_stats;   ///< Test fitness/passes, gathered after evaluation.
+  emp::Ptr<prog_systematics_t> prog_genotypic_systematics;
+  SystematicsCompactor<prog_org_t, prog_org_gen_t> prog_sys_compactor; ///< Used when SYSTEMATICS_MODE is compact.
   emp::Ptr<prog_taxon_t> mrca_taxa_ptr;
   size_t mrca_changes;
   
   emp::vector<std::function<double(prog_org_t &)>> lexicase_prog_fit_set;
 
+  TestDifficultyIndex training_difficulty;   ///< Per-test-case difficulty for the training (test case world) population.
+  TestDifficultyIndex validation_difficulty; ///< Per-test-case difficulty for the testing set (testingset_pop).
+  ValidationSample validation_sample;        ///< Testing set cases that validation runs programs on.
+  size_t validation_round;                   ///< Incremented at each snapshot (validation results cache generation).
+  size_t validation_num_tests;               ///< Test cases each program is validated on (the validation sample, or the streamed testing set).
+
   TagLGPMutator<TAG_WIDTH> prog_mutator;
+  emp::vector<TagLGPMutator<TAG_WIDTH>> prog_worker_mutators;  ///< Copies of prog_mutator, one per reproduction_pool worker (OFFSPRING_MUTATION_MODE = BATCHED).
+  OffspringBuffer<prog_org_t> prog_offspring;                  ///< Program offspring, between selection and placement (OFFSPRING_MUTATION_MODE = BATCHED).
+  WorkerPool reproduction_pool;                                ///< REPRODUCTION_THREADS workers.
+
+  CheckpointWriter checkpoint_writer;
+  CheckpointDataFiles data_files;   ///< Summary data files (appended to over the course of a run).
+  SnapshotWriter snapshot_writer;   ///< Formats/writes population snapshots in the background.
+
+  /// Solution candidate, captured when first seen (for solution screening).
+  struct ProgSolutionCandidate {
+    size_t update;
+    size_t progID;
+    prog_org_gen_t genome;
+  };
+  /// What a solution screener worker evaluates programs with: its own copy of the instruction
+  /// library, hardware running on it, and problem utilities (for per-test evaluation state: the
+  /// current test and the program's submissions). See GetEvalHardware/GetEvalUtils.
+  struct ScreenerEvalState {
+    inst_lib_t inst_lib;
+    hardware_t hardware;
+    const void * prob_utils_key;        ///< Experiment's problem utilities that prob_utils stands in for.
+    std::shared_ptr<void> prob_utils;
+    std::shared_ptr<void> testing_set_stream;  ///< Streamed testing set, opened once per worker (see SetupTestingSetStream).
+    ScreenerEvalState(const inst_lib_t & _inst_lib)
+      : inst_lib(_inst_lib), hardware(inst_lib), prob_utils_key(nullptr), prob_utils(), testing_set_stream() { ; }
+  };
+  SolutionScreener<ProgSolutionCandidate> prog_sol_screener; ///< Screens candidate programs for solutions (on SOLUTION_SCREEN_THREADS workers); skips genomes already screened.
+  std::mutex screen_mtx;                                     ///< Guards screen_order and screen_results (shared with screener workers).
+  std::shared_ptr<const emp::vector<size_t>> screen_order;   ///< Testing set case order for screening (validation_difficulty's, as of the last submission).
+  emp::vector<std::pair<size_t, bool>> screen_results;       ///< Testing set results (case ID, pass) from screening, not yet recorded in validation_difficulty.
+  const ProgSolutionCandidate * cur_solution;                ///< Solution being written to solution files.
+  bool first_solution_reported;                              ///< First solution was written this update (snapshot it).
 
   // Test worlds
   emp::Ptr<prob_NumberIO_world_t> prob_NumberIO_world;
@@ -518,7 +673,14 @@ protected:
   Cohorts test_cohorts;
 
   emp::Ptr<emp::DataFile> solution_file;
+  emp::Ptr<ColumnarWriter> solution_col_file;   ///< Used instead of solution_file for columnar output.
   emp::Ptr<emp::DataFile> prog_phen_diversity_file;
+  emp::Ptr<emp::DataFile> prog_fitness_file;
+  emp::Ptr<emp::DataFile> test_fitness_file;
+  emp::Ptr<emp::DataFile> pop_stats_file;       ///< Min/mean/max/variance of program/test fitness, passes, and program size.
+#ifdef EXP_INSTRUMENT
+  emp::Ptr<InstrumentationFile> timing_file;   ///< Phase timing + counters (timing.csv).
+#endif
 
   struct TestResult {
     double score;
@@ -592,13 +754,17 @@ protected:
   std::function<TestResult(prog_org_t &, size_t)> EvaluateWorldTest;                ///< Evaluate given program org on world test (specified by given ID). Return the test result.
   std::function<TestResult(prog_org_t &, TestOrg_Base &)> CalcProgramResultOnTest;  ///< Calculate the test result for a given program on a given test organism.
   
+  std::function<void(void)> BeginTestingSetValidation;          ///< Optional; called before a snapshot validates the program population.
   std::function<void(prog_org_t &)> DoTestingSetValidation;     ///< Run program on full validation testing set.
   std::function<bool(prog_org_t &)> ScreenForSolution;          ///< Run program on validation testing set. Return true if program is a solution; false otherwise.
+  std::function<emp::vector<bool>(const emp::vector<emp::Ptr<prog_org_t>> &)> ScreenForSolutions;  ///< Optional; screens a batch of programs at once (otherwise, ScreenForSolution screens them one at a time).
   
   std::function<test_org_phen_t&(size_t)> GetTestPhenotype;     ///< Utility function used to get test phenotype of given test (test type agnostic).
   std::function<void(void)> SetupTestMutation;                  ///< Test world configuration utility. To be defined by test setup.
   std::function<void(void)> SetupTestFitFun;                    ///< Test world configuration utility. To be defined by test setup.
   std::function<void(void)> SnapshotTests;                      ///< Snapshot test population.
+  std::function<void(std::ostream &)> WriteTestSystematicsCheckpoint;  ///< Save test systematics (set when tracked).
+  std::function<void(std::istream &)> ReadTestSystematicsCheckpoint;   ///< Restore test systematics (set when tracked).
   
 
   // Internal function signatures.
@@ -607,21 +773,40 @@ protected:
   void InitProgPop_Random();    ///< Randomly initialize the program population.
   
   void SetupHardware();         ///< Setup virtual hardware.
+  void ConfigureHardware(hardware_t & hw);  ///< Configure virtual hardware (memory, tags, call depth).
   void SetupEvaluation();       ///< Setup evaluation
   void SetupSelection();        ///< Setup selection (?)
   void SetupMutation();         ///< Setup mutation (?)
   void SetupFitFuns();
   void SetupDataCollection();   ///< Setup data collection
 
+  void WriteCheckpoint(std::ostream & out);             ///< Serialize experiment state (between generations).
+  void ReadCheckpoint(std::istream & in);               ///< Restore experiment state written by WriteCheckpoint.
+  bool DoCheckpoint();                                  ///< Checkpoint if scheduled/requested. Return true if experiment should stop.
+  void WriteScreenedSolutions();                        ///< Write solutions confirmed by screening (since the last call).
+
   void SetupProgramSelection(); ///< Setup program selection scheme
+  void BindFullEvaluationPhenotypes(); ///< Bind phenotypes to the score matrices for full evaluation.
+  bool ReuseParentPhenotype(prog_org_t & prog_org, size_t pID); ///< Sparse evaluation: copy phenotype of clean offspring's parent.
+  void SaveProgramPhenotypes(); ///< Sparse evaluation: keep this generation's phenotypes for next generation's clean offspring.
   void SetupProgramMutation();  ///< Setup program mutations
   void SetupProgramFitFun();
+  double CalcProgramFitness(const prog_org_t & prog_org) const;
+  void GatherPopulationStats();  ///< Gather + summarize program/test population stats (after evaluation).
+  double CalcEvaluations(size_t world_update) const;  ///< Program-test evaluations run before world_update.
   void SetupProgramStats();
 
   void AddDefaultInstructions(const std::unordered_set<std::string> & includes);
 
   void SnapshotPrograms();
 
+  /// Instruction names (indexed by instruction ID), for columnar program output.
+  emp::vector<std::string> GetInstNames() const;
+
+  /// Take a snapshot of the test population (same format for every problem).
+  template<typename TEST_ORG_T>
+  void SnapshotTestPop(emp::World<TEST_ORG_T> & world);
+
   void SetupProblem();
   void SetupProblem_NumberIO();
   void SetupProblem_SmallOrLarge();
@@ -667,7 +852,7 @@ protected:
     // Tell experiment how to update the world (i.e., which world to update).
     switch (TRAINING_EXAMPLE_MODE) {
       case (size_t)TRAINING_EXAMPLE_MODE_TYPE::COEVOLUTION: {
-        std::cout << "COEVOLUTION training example mode detected, configuring test world to update." << std::endl;
+        ExpLog() << "COEVOLUTION training example mode detected, configuring test world to update." << std::endl;
         UpdateTestCaseWorld = [w]() {
           // std::cout << "-COEVO world update" << std::endl;
           w->Update();
@@ -676,9 +861,9 @@ protected:
         break;
       }
       case (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_GEN:
-        std::cout << "STATIC-GEN training example mode detected, configuring test world to NOT update (reusing STATIC code)." << std::endl;
+        ExpLog() << "STATIC-GEN training example mode detected, configuring test world to NOT update (reusing STATIC code)." << std::endl;
       case (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC: {
-        std::cout << "STATIC training example mode detected, configuring test world to NOT update." << std::endl;
+        ExpLog() << "STATIC training example mode detected, configuring test world to NOT update." << std::endl;
         UpdateTestCaseWorld = [w]() {
           // std::cout << "-STATIC world update" << std::endl;
           w->ClearCache();
@@ -686,13 +871,13 @@ protected:
           for (size_t i = 0; i < w->GetSize(); ++i) {
             emp_assert(w->IsOccupied(i));
             TestOrg_Base & org = static_cast<TestOrg_Base&>(w->GetOrg(i));
-            org.GetPhenotype().Reset(org.GetPhenotype().test_passes.size());
+            org.GetPhenotype().Reset();
           }
         };
         break;
       }
       case (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO: {
-        std::cout << "STATIC_COEVO training example mode detected, configuring test world to update." << std::endl;
+        ExpLog() << "STATIC_COEVO training example mode detected, configuring test world to update." << std::endl;
         UpdateTestCaseWorld = [w]() {
           w->Update();
           w->ClearCache();
@@ -700,7 +885,7 @@ protected:
         break;
       }
       case (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM: {
-        std::cout << "RANDOM training example mode detected, configuring test world to NOT update. Instead, RANDOMIZE population." << std::endl;
+        ExpLog() << "RANDOM training example mode detected, configuring test world to NOT update. Instead, RANDOMIZE population." << std::endl;
         UpdateTestCaseWorld = [w]() {
           // std::cout << "-RANDOM world update" << std::endl;
           w->ClearCache();
@@ -710,25 +895,373 @@ protected:
           for (size_t i = 0; i < w->GetSize(); ++i) {
             emp_assert(w->IsOccupied(i));
             TestOrg_Base & org = static_cast<TestOrg_Base&>(w->GetOrg(i));
-            org.GetPhenotype().Reset(org.GetPhenotype().test_passes.size());
+            org.GetPhenotype().Reset();
             org.CalcOut();
           }
         };
         break;
       }
       default: {
-        std::cout << "Unknown TRAINING_EXAMPLE_MODE (" << TRAINING_EXAMPLE_MODE << "). Exiting." << std::endl;
+        ExpLog() << "Unknown TRAINING_EXAMPLE_MODE (" << TRAINING_EXAMPLE_MODE << "). Exiting." << std::endl;
         exit(-1);
       }
     };
   }
 
+  /// Same as above, but in RANDOM mode, regenerate the entire test population in one pass
+  /// using the given bulk input generator (instead of DoMutations with rates forced to 1.0).
+  /// - gen_inputs fills every entry of a preallocated input buffer (reused across updates).
+  /// - Other modes are set up exactly as above.
+  template<typename WORLD_ORG_TYPE>
+  void SetupTestCaseWorldUpdate(emp::Ptr<emp::World<WORLD_ORG_TYPE>> w,
+                                const std::function<void(emp::vector<typename WORLD_ORG_TYPE::genome_t> &)> & gen_inputs) {
+    if (TRAINING_EXAMPLE_MODE != (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
+      SetupTestCaseWorldUpdate(w);
+      return;
+    }
+    ExpLog() << "RANDOM training example mode detected, configuring test world to NOT update. Instead, REGENERATE population inputs in one pass." << std::endl;
+    emp::vector<typename WORLD_ORG_TYPE::genome_t> input_buffer;
+    UpdateTestCaseWorld = [w, gen_inputs, input_buffer]() mutable {
+      w->ClearCache();
+      // Generate all new inputs at once.
+      input_buffer.resize(w->GetSize());
+      gen_inputs(input_buffer);
+      // Move new inputs into population, compute correct outputs, and reset test phenotypes.
+      for (size_t i = 0; i < w->GetSize(); ++i) {
+        emp_assert(w->IsOccupied(i));
+        WORLD_ORG_TYPE & org = w->GetOrg(i);
+        std::swap(org.GetGenome(), input_buffer[i]);
+        org.CalcOut();
+        org.GetPhenotype().Reset();
+      }
+    };
+  }
+
+  /// Fallback for problems without a bulk input generator (variable-length or rejection-sampled
+  /// inputs): in RANDOM mode, still regenerate the population in one pass, but draw each test's
+  /// input with gen_input, one test at a time from the shared emp::Random.
+  template<typename WORLD_ORG_TYPE>
+  void SetupTestCaseWorldUpdate_PerTestInputs(emp::Ptr<emp::World<WORLD_ORG_TYPE>> w,
+                                              const std::function<typename WORLD_ORG_TYPE::genome_t(void)> & gen_input) {
+    if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
+      ExpLog() << "  No bulk input generator for this problem; drawing test inputs one at a time." << std::endl;
+    }
+    SetupTestCaseWorldUpdate<WORLD_ORG_TYPE>(w, [gen_input](emp::vector<typename WORLD_ORG_TYPE::genome_t> & inputs) {
+      for (size_t i = 0; i < inputs.size(); ++i) inputs[i] = gen_input();
+    });
+  }
+
+  /// Run programs on every test case in a streamed testing set, reading the file once: chunks are
+  /// the outer loop and programs the inner loop, so any per-program state (kept by on_result) is
+  /// carried across chunks. Test organisms are built once per chunk and reused across chunks.
+  /// - Each program's evaluation begins and ends (begin/end_program_eval) once per chunk.
+  /// - on_result is called with the program's index (in progs), the test's ID (its position in the
+  ///   file), and the result; return false from on_result to stop running that program.
+  /// - Reading stops early once every program has stopped.
+  /// - Returns the number of test cases read.
+  template<typename TEST_ORG_T, typename INPUT_T, typename OUTPUT_T>
+  size_t RunTestingSetStream(const emp::vector<emp::Ptr<prog_org_t>> & progs,
+                             TestCaseStream<INPUT_T, OUTPUT_T> & stream,
+                             const std::function<bool(size_t, size_t, const TestResult &)> & on_result) {
+    emp::vector<emp::Ptr<TEST_ORG_T>> test_orgs;
+    emp::vector<bool> running(progs.size(), true);
+    size_t num_running = progs.size();
+    typename TestCaseStream<INPUT_T, OUTPUT_T>::chunk_t chunk;
+    size_t first_testID = 0;
+    stream.Begin();
+    while (num_running && stream.NextChunk(chunk)) {
+      while (test_orgs.size() < chunk.size()) test_orgs.emplace_back(emp::NewPtr<TEST_ORG_T>(typename TEST_ORG_T::genome_t()));
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        test_orgs[i]->GetGenome() = chunk[i].first;
+        test_orgs[i]->CalcOut();
+      }
+      for (size_t p = 0; p < progs.size(); ++p) {
+        if (!running[p]) continue;
+        begin_program_eval.Trigger(*progs[p]);
+        for (size_t i = 0; running[p] && i < chunk.size(); ++i) {
+          begin_program_test.Trigger(*progs[p], test_orgs[i]);
+          do_program_test.Trigger(*progs[p], test_orgs[i]);
+          end_program_test.Trigger(*progs[p], test_orgs[i]);
+          if (!on_result(p, first_testID + i, CalcProgramResultOnTest(*progs[p], *test_orgs[i]))) {
+            running[p] = false;
+            --num_running;
+          }
+        }
+        end_program_eval.Trigger(*progs[p]);
+      }
+      first_testID += chunk.size();
+    }
+    stream.End();
+    for (emp::Ptr<TEST_ORG_T> test_org_ptr : test_orgs) test_org_ptr.Delete();
+    return first_testID;
+  }
+
+  /// Replace validation and ScreenForSolution with versions that stream the testing set from
+  /// disk (TESTING_SET_STREAM_CHUNK_SIZE test cases at a time) instead of holding the entire
+  /// testing set in memory.
+  /// - Validation runs the whole program population in one pass over the file (see
+  ///   BeginTestingSetValidation) and keeps per-program totals and per-test passes (not per-test
+  ///   scores). Behavioral diversity is measured over hashes of each program's outputs (get_output
+  ///   returns the output of the program that just ran).
+  /// - Validation results are cached by genotype as in SetupValidation (which streamed validation
+  ///   doesn't use).
+  /// - Screening runs a batch of candidates (see ScreenForSolutions) in one pass over the file,
+  ///   and stops reading it once every candidate has failed a test case. Each solution screener
+  ///   worker opens its own stream once and reuses it for every batch.
+  template<typename TEST_ORG_T, typename PROB_UTILS_T, typename GET_OUTPUT_T>
+  void SetupTestingSetStream(PROB_UTILS_T & prob_utils, const std::string & fpath, const GET_OUTPUT_T & get_output) {
+    using stream_t = TestCaseStream<typename PROB_UTILS_T::input_t, typename PROB_UTILS_T::output_t>;
+    struct StreamedValidation {
+      double total_score;
+      size_t total_passes;
+      uint64_t output_hash;   ///< Hash of the program's outputs, in testing set order.
+      size_t round;           ///< Last validation round (snapshot) these results were used in.
+      emp::vector<bool> passes;  ///< By test case, in testing set order.
+    };
+    struct StreamedValidationState {
+      std::map<prog_org_gen_t, StreamedValidation> cache;
+      emp::vector<StreamedValidation> results;  ///< By program world ID, for the current round.
+      emp::vector<uint64_t> output_hashes;      ///< One per program, for the current round.
+      size_t num_tests = 0;
+    };
+    ExpLog() << "Streaming testing set from " << fpath << " (chunk size = " << TESTING_SET_STREAM_CHUNK_SIZE << ")." << std::endl;
+    std::shared_ptr<stream_t> stream = std::make_shared<stream_t>();
+    stream->SetLoadFun(&PROB_UTILS_T::LoadTestCaseFromLine);
+    if (!stream->Open(fpath, TESTING_SET_STREAM_CHUNK_SIZE)) {
+      ExpLog() << "Failed to open testing set file (" << fpath << "). Exiting." << std::endl;
+      exit(-1);
+    }
+    auto state = std::make_shared<StreamedValidationState>();
+
+    BeginTestingSetValidation = [this, stream, state, get_output]() {
+      const bool full = VALIDATION_MODE == (size_t)VALIDATION_MODE_TYPE::FULL_VALIDATION;
+      const bool incremental = VALIDATION_MODE == (size_t)VALIDATION_MODE_TYPE::INCREMENTAL_VALIDATION;
+      // Drop cached results that can't be reused.
+      for (auto it = state->cache.begin(); it != state->cache.end(); ) {
+        if (incremental && it->second.round + 1 == validation_round) ++it;
+        else it = state->cache.erase(it);
+      }
+      // Find the programs that need to run (every program, or one per uncached genotype).
+      emp::vector<emp::Ptr<prog_org_t>> progs;
+      for (size_t pID = 0; pID < prog_world->GetSize(); ++pID) {
+        if (!prog_world->IsOccupied(pID)) continue;
+        if (!full) {
+          const auto found = state->cache.emplace(prog_world->GetGenomeAt(pID), StreamedValidation{0, 0, 0, validation_round, emp::vector<bool>()});
+          found.first->second.round = validation_round;
+          if (!found.second) { EXP_INSTRUMENT_COUNT(CACHE_HITS, 1); continue; }
+          EXP_INSTRUMENT_COUNT(CACHE_MISSES, 1);
+        }
+        progs.emplace_back(prog_world->GetOrgPtr(pID));
+      }
+      emp::vector<StreamedValidation> run_results(progs.size(), StreamedValidation{0, 0, 14695981039346656037ull, validation_round, emp::vector<bool>()});
+      if (progs.size()) {
+        state->num_tests = RunTestingSetStream<TEST_ORG_T>(progs, *stream, [&run_results, &get_output](size_t p, size_t testID, const TestResult & result) {
+          run_results[p].total_score += result.score;
+          run_results[p].total_passes += (size_t)result.pass;
+          run_results[p].passes.emplace_back(result.pass);
+          HashValidationOutput(run_results[p].output_hash, get_output());
+          return true;
+        });
+      }
+      validation_num_tests = state->num_tests;
+      // Gather results by world ID.
+      state->results.resize(prog_world->GetSize());
+      state->output_hashes.clear();
+      size_t next_run = 0;
+      for (size_t pID = 0; pID < prog_world->GetSize(); ++pID) {
+        if (!prog_world->IsOccupied(pID)) continue;
+        if (full) {
+          state->results[pID] = run_results[next_run++];
+        } else {
+          StreamedValidation & cached = state->cache.at(prog_world->GetGenomeAt(pID));
+          if (next_run < progs.size() && progs[next_run] == prog_world->GetOrgPtr(pID)) cached = run_results[next_run++];
+          state->results[pID] = cached;
+        }
+        state->output_hashes.emplace_back(state->results[pID].output_hash);
+      }
+    };
+
+    DoTestingSetValidation = [this, state](prog_org_t & prog_org) {
+      begin_program_eval.Trigger(prog_org);
+      const StreamedValidation & results = state->results[stats_util.cur_progID];
+      stats_util.current_program__validation__test_results.clear();
+      for (bool pass : results.passes) stats_util.current_program__validation__test_results.emplace_back(0.0, pass);
+      stats_util.current_program__validation__total_score = results.total_score;
+      stats_util.current_program__validation__total_passes = results.total_passes;
+      stats_util.current_program__validation__is_solution = results.total_passes == state->num_tests;
+      end_program_eval.Trigger(prog_org);
+    };
+    program_stats.get_prog_behavioral_diversity = [state]() { return emp::ShannonEntropy(state->output_hashes); };
+    program_stats.get_prog_unique_behavioral_phenotypes = [state]() { return emp::UniqueCount(state->output_hashes); };
+
+    ScreenForSolutions = [this, fpath](const emp::vector<emp::Ptr<prog_org_t>> & progs) {
+      ScreenerEvalState * eval_state = ThreadScreenerEvalState();
+      emp_assert(eval_state != nullptr, "Screening runs on solution screener verifiers.");
+      if (eval_state->testing_set_stream == nullptr) {
+        std::shared_ptr<stream_t> screen_stream = std::make_shared<stream_t>();
+        screen_stream->SetLoadFun(&PROB_UTILS_T::LoadTestCaseFromLine);
+        if (!screen_stream->Open(fpath, TESTING_SET_STREAM_CHUNK_SIZE)) {
+          ExpLog() << "Failed to open testing set file (" << fpath << ") for solution screening. Exiting." << std::endl;
+          exit(-1);
+        }
+        eval_state->testing_set_stream = screen_stream;
+      }
+      stream_t & screen_stream = *static_cast<stream_t *>(eval_state->testing_set_stream.get());
+      emp::vector<bool> solutions(progs.size(), true);
+      RunTestingSetStream<TEST_ORG_T>(progs, screen_stream, [&solutions](size_t p, size_t testID, const TestResult & result) {
+        solutions[p] = result.pass;
+        return solutions[p];
+      });
+      return solutions;
+    };
+    ScreenForSolution = [this](prog_org_t & prog_org) {
+      return ScreenForSolutions(emp::vector<emp::Ptr<prog_org_t>>{emp::Ptr<prog_org_t>(&prog_org)})[0];
+    };
+  }
+
+  /// Solution screener worker state for the calling thread (nullptr on every other thread).
+  static ScreenerEvalState *& ThreadScreenerEvalState() {
+    thread_local ScreenerEvalState * state = nullptr;
+    return state;
+  }
+
+  /// Problem utilities holding the calling thread's per-test evaluation state (current test and
+  /// submissions): a solution screener worker's own (default-constructed) PROB_UTILS_T, otherwise
+  /// prob_utils itself.
+  template<typename PROB_UTILS_T>
+  PROB_UTILS_T & GetEvalUtils(PROB_UTILS_T & prob_utils) {
+    ScreenerEvalState * state = ThreadScreenerEvalState();
+    if (state == nullptr) return prob_utils;
+    if (state->prob_utils_key != &prob_utils) {
+      state->prob_utils_key = &prob_utils;
+      state->prob_utils = std::make_shared<PROB_UTILS_T>();
+    }
+    return *static_cast<PROB_UTILS_T *>(state->prob_utils.get());
+  }
+
+  /// Screen a program for a solution against prob_utils' (in-memory) testing set, most-often-failed
+  /// cases first (screen_order) so that non-solutions fail fast. Every case checked (passes up to
+  /// and including the first failure) goes to screen_results, to be recorded in
+  /// validation_difficulty by the main thread (see RecordScreenResults). Safe to run on screener
+  /// workers: the testing set is only read.
+  template<typename PROB_UTILS_T>
+  bool ScreenOnTestingSet(prog_org_t & prog_org, PROB_UTILS_T & prob_utils) {
+    std::shared_ptr<const emp::vector<size_t>> order;
+    {
+      std::unique_lock<std::mutex> lock(screen_mtx);
+      order = screen_order;
+    }
+    emp_assert(order != nullptr);
+    emp::vector<std::pair<size_t, bool>> results;
+    bool solution = true;
+    begin_program_eval.Trigger(prog_org);
+    for (size_t testID : *order) {
+      auto test_org_ptr = prob_utils.testingset_pop[testID];
+      begin_program_test.Trigger(prog_org, test_org_ptr);
+      do_program_test.Trigger(prog_org, test_org_ptr);
+      end_program_test.Trigger(prog_org, test_org_ptr);
+      const bool pass = CalcProgramResultOnTest(prog_org, *test_org_ptr).pass;
+      results.emplace_back(testID, pass);
+      if (!pass) { solution = false; break; }
+    }
+    end_program_eval.Trigger(prog_org);
+    std::unique_lock<std::mutex> lock(screen_mtx);
+    screen_results.insert(screen_results.end(), results.begin(), results.end());
+    return solution;
+  }
+
+  /// Give screener workers validation_difficulty's current case order.
+  void PublishScreenOrder() {
+    std::shared_ptr<const emp::vector<size_t>> order = std::make_shared<const emp::vector<size_t>>(validation_difficulty.GetOrder());
+    std::unique_lock<std::mutex> lock(screen_mtx);
+    screen_order = order;
+  }
+
+  /// Record screening results so far in validation_difficulty (folded in with the rest of its
+  /// counts at its next Update).
+  void RecordScreenResults() {
+    emp::vector<std::pair<size_t, bool>> results;
+    {
+      std::unique_lock<std::mutex> lock(screen_mtx);
+      std::swap(results, screen_results);
+    }
+    for (const auto & result : results) validation_difficulty.RecordPass(result.first, result.second);
+  }
+
+  /// Setup how programs are validated on the testing set at snapshots (see VALIDATION_MODE).
+  /// - Validation runs programs on the test cases in validation_sample (the entire testing set,
+  ///   unless sampling).
+  /// - In every mode but FULL, DoTestingSetValidation is wrapped with a results cache keyed by
+  ///   genotype so that each unique genotype is run once per snapshot. INCREMENTAL mode also keeps
+  ///   results for genotypes validated at the previous snapshot; other modes start each snapshot
+  ///   with an empty cache.
+  /// - A cache hit restores everything a run would have produced: test results, validation outputs
+  ///   (behavioral diversity), and validation difficulty counts.
+  /// - Streamed testing sets cache on their own (see SetupTestingSetStream).
+  template<typename PROB_UTILS_T>
+  void SetupValidation(PROB_UTILS_T & prob_utils) {
+    using outputs_t = typename std::decay<decltype(prob_utils.population_validation_outputs[0])>::type;
+    struct CachedValidation {
+      emp::vector<TestResult> results;
+      double total_score;
+      size_t total_passes;
+      bool is_solution;
+      outputs_t outputs;
+      size_t round;     ///< Last validation round (snapshot) these results were used in.
+    };
+    validation_sample.SetFull(prob_utils.testingset_pop.size());
+    if (VALIDATION_MODE == (size_t)VALIDATION_MODE_TYPE::SAMPLED_VALIDATION && TESTING_SET_STREAM_CHUNK_SIZE) {
+      ExpLog() << "Sampled validation (VALIDATION_MODE=3) requires an in-memory testing set (TESTING_SET_STREAM_CHUNK_SIZE=0). Exiting." << std::endl;
+      exit(-1);
+    }
+    if (VALIDATION_MODE == (size_t)VALIDATION_MODE_TYPE::FULL_VALIDATION || TESTING_SET_STREAM_CHUNK_SIZE) return;
+
+    auto cache = std::make_shared<std::map<prog_org_gen_t, CachedValidation>>();
+    auto cache_round = std::make_shared<size_t>(validation_round);
+    std::function<void(prog_org_t &)> validate(DoTestingSetValidation);
+    DoTestingSetValidation = [this, &prob_utils, cache, cache_round, validate](prog_org_t & prog_org) {
+      if (*cache_round != validation_round) {
+        // New validation round; drop results that can't be reused.
+        const bool incremental = VALIDATION_MODE == (size_t)VALIDATION_MODE_TYPE::INCREMENTAL_VALIDATION;
+        for (auto it = cache->begin(); it != cache->end(); ) {
+          if (incremental && it->second.round + 1 == validation_round) ++it;
+          else it = cache->erase(it);
+        }
+        *cache_round = validation_round;
+      }
+      auto it = cache->find(prog_org.GetGenome());
+      if (it == cache->end()) {
+        EXP_INSTRUMENT_COUNT(CACHE_MISSES, 1);
+        validate(prog_org);
+        cache->emplace(prog_org.GetGenome(),
+                       CachedValidation{stats_util.current_program__validation__test_results,
+                                        stats_util.current_program__validation__total_score,
+                                        stats_util.current_program__validation__total_passes,
+                                        stats_util.current_program__validation__is_solution,
+                                        prob_utils.population_validation_outputs[stats_util.cur_progID],
+                                        validation_round});
+        return;
+      }
+      EXP_INSTRUMENT_COUNT(CACHE_HITS, 1);
+      CachedValidation & cached = it->second;
+      cached.round = validation_round;
+      stats_util.current_program__validation__test_results = cached.results;
+      stats_util.current_program__validation__total_score = cached.total_score;
+      stats_util.current_program__validation__total_passes = cached.total_passes;
+      stats_util.current_program__validation__is_solution = cached.is_solution;
+      prob_utils.population_validation_outputs[stats_util.cur_progID] = cached.outputs;
+      for (size_t i = 0; i < cached.results.size(); ++i) {
+        validation_difficulty.RecordPass(validation_sample.GetTestIDs()[i], cached.results[i].pass);
+      }
+    };
+  }
+
   template<typename WORLD_ORG_TYPE>
   void SetupTestSelection(emp::Ptr<emp::World<WORLD_ORG_TYPE>> w, emp::vector<std::function<double(WORLD_ORG_TYPE &)>> & lexicase_fit_set) {
-    std::cout << "Setting up test selection." << std::endl; 
+    ExpLog() << "Setting up test selection." << std::endl; 
 
     if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO) {
-      std::cout << "STATIC_COEVO mode, need to copy first STATIC_NUM (" << STATIC_COEVO__NUM_STATIC_TESTCASES << ") organisms." << std::endl;
+      ExpLog() << "STATIC_COEVO mode, need to copy first STATIC_NUM (" << STATIC_COEVO__NUM_STATIC_TESTCASES << ") organisms." << std::endl;
       do_selection_sig.AddAction([this, w]() mutable {
         for (size_t i = 0; i < STATIC_COEVO__NUM_STATIC_TESTCASES; ++i) {
           w->DoBirth(w->GetGenomeAt(i), i);
@@ -740,11 +1273,11 @@ protected:
     switch (TEST_SELECTION_MODE) {
       case (size_t)SELECTION_TYPE::LEXICASE: {
         emp_assert(EVALUATION_MODE == (size_t)EVALUATION_TYPE::FULL);
-        std::cout << "  Setting up test LEXICASE selection." << std::endl;
+        ExpLog() << "  Setting up test LEXICASE selection." << std::endl;
         // Setup lexicase selection.
         // - 1 lexicase function for every program organism.
         if (DISCRIMINATORY_LEXICASE_TESTS) {
-          std::cout << "    Tests configured to be DISCRIMINATORY." << std::endl;
+          ExpLog() << "    Tests configured to be DISCRIMINATORY." << std::endl;
           for (size_t i = 0; i < PROG_POP_SIZE; ++i) {
             lexicase_fit_set.push_back([i](WORLD_ORG_TYPE & test_org) {
               TestOrg_Base & org = static_cast<TestOrg_Base&>(test_org);
@@ -773,11 +1306,11 @@ protected:
       }
       case (size_t)SELECTION_TYPE::COHORT_LEXICASE: {
         emp_assert(EVALUATION_MODE == (size_t)EVALUATION_TYPE::COHORT);
-        std::cout << "  Setting up test COHORT LEXICASE selection." << std::endl;
+        ExpLog() << "  Setting up test COHORT LEXICASE selection." << std::endl;
         // Setup cohort lexicase.
         // - 1 lexicase function for every program cohort member.
         if (DISCRIMINATORY_LEXICASE_TESTS) {
-          std::cout << "    Tests configured to be DISCRIMINATORY." << std::endl;
+          ExpLog() << "    Tests configured to be DISCRIMINATORY." << std::endl;
           for (size_t i = 0; i < PROG_COHORT_SIZE; ++i) {
             lexicase_fit_set.push_back([i](WORLD_ORG_TYPE & test_org) {
               TestOrg_Base & org = static_cast<TestOrg_Base&>(test_org);
@@ -813,27 +1346,27 @@ protected:
         break;
       }
       case (size_t)SELECTION_TYPE::TOURNAMENT: {
-        std::cout << "  Setting up test TOURNAMENT selection." << std::endl;
+        ExpLog() << "  Setting up test TOURNAMENT selection." << std::endl;
         do_selection_sig.AddAction([this, w]() mutable {
           emp::TournamentSelect(*w, TEST_TOURNAMENT_SIZE, TEST_POP_SIZE);
         });
         break;
       }
       case (size_t)SELECTION_TYPE::DRIFT: {
-        std::cout << "  Setting up test DRIFT selection." << std::endl;
+        ExpLog() << "  Setting up test DRIFT selection." << std::endl;
         do_selection_sig.AddAction([this, w]() mutable {
           emp::RandomSelect(*w, TEST_POP_SIZE);
         });
         break;
       }
       default: {
-        std::cout << "Unknown TEST_SELECTION_MODE (" << TEST_SELECTION_MODE << "). Exiting." << std::endl;
+        ExpLog() << "Unknown TEST_SELECTION_MODE (" << TEST_SELECTION_MODE << "). Exiting." << std::endl;
         exit(-1);
       }
     }
 
     if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO) {
-      std::cout << "STATIC_COEVO mode, need to fix population size post-selection." << std::endl;
+      ExpLog() << "STATIC_COEVO mode, need to fix population size post-selection." << std::endl;
       do_selection_sig.AddAction([this, w]() mutable {
         // std::cout << "Population size pre-resize? " << w->GetSize() << std::endl;
         // Shuffle the non-static test cases to be fair to late cohorts
@@ -852,16 +1385,28 @@ protected:
     using w_t = emp::World<WORLD_ORG_TYPE>;
     std::function<typename w_t::genome_t(const WORLD_ORG_TYPE & org)> sys_get_genome = [](const WORLD_ORG_TYPE & org) { return org.GetGenome(); };
     auto sys = w->AddSystematics(sys_get_genome, true, true, false, true, "test_genotype");
-    sys->AddEvolutionaryDistinctivenessDataNode();
-    sys->AddPairwiseDistanceDataNode();
-    sys->AddPhylogeneticDiversityDataNode();
+    // Test genomes are a handful of values, so compact mode only defers metrics to file writes (genomes
+    // are not hashed/diffed).
+    const bool compact_systematics = SYSTEMATICS_MODE == (size_t)SYSTEMATICS_MODE_TYPE::COMPACT_SYSTEMATICS;
+    if (!compact_systematics) {
+      sys->AddEvolutionaryDistinctivenessDataNode();
+      sys->AddPairwiseDistanceDataNode();
+      sys->AddPhylogeneticDiversityDataNode();
+    }
     auto & sys_file = w->SetupSystematicsFile("test_genotype", DATA_DIRECTORY + "/test_gen_sys.csv", false);
     sys_file.SetTimingRepeat(SUMMARY_STATS_INTERVAL); 
-    sys_file.AddStats(*sys->GetDataNode("evolutionary_distinctiveness") , "evolutionary_distinctiveness", "evolutionary distinctiveness for a single update", true, true);
-    sys_file.AddStats(*sys->GetDataNode("pairwise_distances"), "pairwise_distance", "pairwise distance for a single update", true, true);
-    sys_file.AddCurrent(*sys->GetDataNode("phylogenetic_diversity"), "current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
+    if (compact_systematics) {
+      AddCompactSystematicsMetrics(sys_file, sys, [w]() { return w->GetUpdate(); });
+    } else {
+      sys_file.AddStats(*sys->GetDataNode("evolutionary_distinctiveness") , "evolutionary_distinctiveness", "evolutionary distinctiveness for a single update", true, true);
+      sys_file.AddStats(*sys->GetDataNode("pairwise_distances"), "pairwise_distance", "pairwise distance for a single update", true, true);
+      sys_file.AddCurrent(*sys->GetDataNode("phylogenetic_diversity"), "current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
+    }
     sys_file.template AddFun<size_t>([sys]() { return sys->GetTreeSize(); }, "tree_size", "Phylogenetic tree size");
     sys_file.PrintHeaderKeys();
+    data_files.Add(sys_file, DATA_DIRECTORY + "/test_gen_sys.csv");
+    WriteTestSystematicsCheckpoint = [sys](std::ostream & out) { CheckpointWriteSystematics(out, *sys); };
+    ReadTestSystematicsCheckpoint = [sys](std::istream & in) { CheckpointReadSystematics(in, *sys); };
     using to_taxon_t = typename emp::Systematics<WORLD_ORG_TYPE, typename w_t::genome_t>::taxon_t;
     sys->AddSnapshotFun([print_test](const to_taxon_t & t) {
       std::ostringstream stream;
@@ -902,7 +1447,7 @@ protected:
       else if (prob_Median_world != nullptr) prob_Median_world->OnPlacement(fun);
       else if (prob_Smallest_world != nullptr) prob_Smallest_world->OnPlacement(fun);
       else if (prob_Syllables_world != nullptr) prob_Syllables_world->OnPlacement(fun);
-      else { std::cout << "AHH! More than one test case world has been created. Exiting." << std::endl; exit(-1); }
+      else { ExpLog() << "AHH! More than one test case world has been created. Exiting." << std::endl; exit(-1); }
   }
   
   /// Test set is test set to use if doing static initialization
@@ -914,12 +1459,12 @@ protected:
     
     if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC) {
       TEST_POP_SIZE = test_set.GetSize();
-      std::cout << "In STATIC training example mode, adjusting TEST_POP_SIZE to: " << TEST_POP_SIZE << std::endl;
+      ExpLog() << "In STATIC training example mode, adjusting TEST_POP_SIZE to: " << TEST_POP_SIZE << std::endl;
       end_setup_sig.AddAction([this, w, test_set]() {                     // TODO - test that this is actually working!
         InitTestCasePop_TrainingSet(w, test_set);
       });
     } else if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_GEN) {
-      std::cout << "In STATIC_GEN training example mode bolstering training examples to match TEST_POP_SIZE (" << TEST_POP_SIZE << ")" << std::endl;
+      ExpLog() << "In STATIC_GEN training example mode bolstering training examples to match TEST_POP_SIZE (" << TEST_POP_SIZE << ")" << std::endl;
       end_setup_sig.AddAction([this, w, test_set, gen_rand_test]() {       // TODO - test that this is actually working!
         if (PROBLEM == "sum-of-squares") {
           InitTestCasePop_TrainingSetBolstered(w, test_set, gen_rand_test, false);
@@ -928,7 +1473,7 @@ protected:
         }
       });
     } else if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO) {
-      std::cout << "In STATIC_COEVO training example mode, bolstering training examples to match pop size." << std::endl;
+      ExpLog() << "In STATIC_COEVO training example mode, bolstering training examples to match pop size." << std::endl;
       STATIC_COEVO__NUM_STATIC_TESTCASES = test_set.GetSize(); // Number of test cases to never mutate
       end_setup_sig.AddAction([this, w, test_set, gen_rand_test]() {       // TODO - test that this is actually working!
         if (PROBLEM == "sum-of-squares") {
@@ -938,7 +1483,7 @@ protected:
         }
       });
     } else {
-      std::cout << "Generating training example population randomly." << std::endl;
+      ExpLog() << "Generating training example population randomly." << std::endl;
       end_setup_sig.AddAction([this, w, test_set, gen_rand_test]() {      // TODO - test that this is actually working!
         InitTestCasePop_Random(w, gen_rand_test);
       });
@@ -948,7 +1493,7 @@ protected:
   // Initialize given world's population with training examples in given test case set.
   template<typename WORLD_ORG_TYPE, typename TEST_IN_TYPE, typename TEST_OUT_TYPE>
   void InitTestCasePop_TrainingSet(emp::Ptr<emp::World<WORLD_ORG_TYPE>> w, const TestCaseSet<TEST_IN_TYPE, TEST_OUT_TYPE> & test_set) {
-    std::cout << "Initializing test case population from a training set." << std::endl;
+    ExpLog() << "Initializing test case population from a training set." << std::endl;
     for (size_t i = 0; i < test_set.GetSize(); ++i) {
       w->Inject(test_set.GetInput(i), 1);
     }
@@ -960,8 +1505,8 @@ protected:
                                             const TestCaseSet<TEST_IN_TYPE, TEST_OUT_TYPE> & test_set,
                                             const std::function<typename emp::World<WORLD_ORG_TYPE>::genome_t(void)> & gen_rand,
                                             bool guarantee_unique=true) {
-    std::cout << "Initializing test case population from a training set then bolstering to TEST_POP_SIZE." << std::endl;
-    std::cout << "  Test set size = " << test_set.GetSize() << std::endl;
+    ExpLog() << "Initializing test case population from a training set then bolstering to TEST_POP_SIZE." << std::endl;
+    ExpLog() << "  Test set size = " << test_set.GetSize() << std::endl;
     while (w->GetSize() < TEST_POP_SIZE) {
       if (w->GetSize() < test_set.GetSize()) {
         // std::cout << "Injecting test id " << w->GetSize() << std::endl;
@@ -983,7 +1528,7 @@ protected:
         w->Inject(rand_genome, 1);
       }
     }
-    std::cout << "  World size = " << w->GetSize() << std::endl;
+    ExpLog() << "  World size = " << w->GetSize() << std::endl;
     
     // ensure uniqueness
     bool unique = true;
@@ -997,13 +1542,13 @@ protected:
     }
 
     if (guarantee_unique) { emp_assert(unique); }
-    std::cout << "  Unique pop? " << unique << std::endl;
+    ExpLog() << "  Unique pop? " << unique << std::endl;
   }
 
   // Initialize given world's population randomly.
   template<typename WORLD_ORG_TYPE>
   void InitTestCasePop_Random(emp::Ptr<emp::World<WORLD_ORG_TYPE>> w, const std::function<typename emp::World<WORLD_ORG_TYPE>::genome_t(void)> & fun) {
-    std::cout << "Initializing test case population randomly." << std::endl;
+    ExpLog() << "Initializing test case population randomly." << std::endl;
     for (size_t i = 0; i < TEST_POP_SIZE; ++i) {
       w->Inject(fun(), 1);
     }
@@ -1084,20 +1629,30 @@ protected:
 
 public:
   ProgramSynthesisExperiment() 
-    : setup(false), update(0), solution_found(false)
+    : setup(false), update(0), test_eval_cnt(0), solution_found(false), cur_solution(nullptr), first_solution_reported(false),
+      prog_pop_stats(SIZE_STAT + 1), test_pop_stats(PASSES_STAT + 1), validation_round(0), validation_num_tests(0)
   {
-    std::cout << "Problem info:" << std::endl;
+    ExpLog() << "Problem info:" << std::endl;
     for (const auto & info : problems) {
-      std::cout << "  - Problem name: " << info.first << std::endl;
-      std::cout << "    - Training examples file: " << info.second.GetTrainingSetFilename() << std::endl;
-      std::cout << "    - Testing examples file: " << info.second.GetTestingSetFilename() << std::endl;
+      ExpLog() << "  - Problem name: " << info.first << std::endl;
+      ExpLog() << "    - Training examples file: " << info.second.GetTrainingSetFilename() << std::endl;
+      ExpLog() << "    - Testing examples file: " << info.second.GetTestingSetFilename() << std::endl;
     }
   }
 
   ~ProgramSynthesisExperiment() {
     if (setup) {
-      solution_file.Delete();
+      prog_sol_screener.Shutdown(); // Screener workers use the instruction library, testing set, and signals.
+      snapshot_writer.Wait(); // Queued snapshots may still reference the instruction library.
+      if (solution_file != nullptr) solution_file.Delete();
+      if (solution_col_file != nullptr) solution_col_file.Delete();
       prog_phen_diversity_file.Delete();
+      prog_fitness_file.Delete();
+      test_fitness_file.Delete();
+      pop_stats_file.Delete();
+#ifdef EXP_INSTRUMENT
+      timing_file.Delete();
+#endif
       eval_hardware.Delete();
       inst_lib.Delete();
       prog_world.Delete();
@@ -1139,7 +1694,12 @@ public:
   /// Configure the experiment.
   void Setup(const ProgramSynthesisConfig & config);
 
-  /// Run the experiment start->finish.
+  /// Configure the experiment, then restore its state from a checkpoint file (written by a previous
+  /// run with the same configuration).
+  void Resume(const ProgramSynthesisConfig & config, const std::string & checkpoint_fpath);
+
+  /// Run the experiment start->finish (or from the resumed update to finish).
+  /// - Checkpoints every CHECKPOINT_INTERVAL generations and on SIGUSR1; checkpoints and stops on SIGTERM.
   void Run();
 
   /// Progress experiment by a single time step (generation):
@@ -1151,6 +1711,18 @@ public:
   /// -- Accessors --
   emp::Random & GetRandom() { return *random; }
   prog_world_t & GetProgramWorld() { return *prog_world; }
+  inst_lib_t & GetInstLib() { return *inst_lib; }
+  /// Hardware programs are evaluated on by the calling thread: a solution screener worker's own
+  /// hardware (see ScreenerEvalState), otherwise eval_hardware.
+  hardware_t & GetEvalHardware() {
+    ScreenerEvalState * state = ThreadScreenerEvalState();
+    return (state != nullptr) ? state->hardware : *eval_hardware;
+  }
+  const emp::BitSet<TAG_WIDTH> & GetCallTag() const { return call_tag; }
+  double GetMinTagSpecificity() const { return MIN_TAG_SPECIFICITY; }
+  size_t GetUpdate() const { return update; }
+  void SetUpdate(size_t u) { update = u; }
+  size_t GetTestEvalCount() const { return test_eval_cnt; }
 
 };
 
@@ -1158,7 +1730,7 @@ public:
 
 /// Configure the experiment.
 void ProgramSynthesisExperiment::Setup(const ProgramSynthesisConfig & config) {
-  std::cout << "Running ProgramSynthesisExperiment setup." << std::endl;
+  ExpLog() << "Running ProgramSynthesisExperiment setup." << std::endl;
   emp_assert(setup == false, "Can only run setup once because I'm lazy.");
   // Localize experiment configuration.
   InitConfigs(config);
@@ -1170,7 +1742,7 @@ void ProgramSynthesisExperiment::Setup(const ProgramSynthesisConfig & config) {
     prog_world = emp::NewPtr<prog_world_t>(*random, "program world");
   } else {
     // Fail!
-    std::cout << "Setup only allowed once per experiment! (because I'm too lazy to handle multiple setups) Exiting." << std::endl;
+    ExpLog() << "Setup only allowed once per experiment! (because I'm too lazy to handle multiple setups) Exiting." << std::endl;
     exit(-1);
   }
 
@@ -1187,21 +1759,31 @@ void ProgramSynthesisExperiment::Setup(const ProgramSynthesisConfig & config) {
   end_setup_sig.AddAction([this]() {
     // Initialize program population.
     InitProgPop_Random();
-    std::cout << "Program population size=" << prog_world->GetSize() << std::endl;
+    ExpLog() << "Program population size=" << prog_world->GetSize() << std::endl;
   });
 
   // Configure On Update signal.
   do_update_sig.AddAction([this]() {
-    std::cout << "Update: " << update << "; ";
-    std::cout << "best program score: " << prog_world->CalcFitnessID(dominant_prog_id) << "; ";
-    std::cout << "solution found? " << solution_found << "; ";
-    std::cout << "smallest solution? " << smallest_prog_sol_size << std::endl;
-
-    if (update % SNAPSHOT_INTERVAL == 0 || update_first_solution_found == update || update == GENERATIONS) do_pop_snapshot_sig.Trigger();
+    ExpLog() << "Update: " << update << "; ";
+    ExpLog() << "best program score: " << prog_pop_stats.Get(FITNESS_STAT).max << "; ";
+    ExpLog() << "solution found? " << solution_found << "; ";
+    ExpLog() << "smallest solution? " << smallest_prog_sol_size << std::endl;
+
+    if (update % SNAPSHOT_INTERVAL == 0 || first_solution_reported || update == GENERATIONS) {
+      EXP_INSTRUMENT_PHASE(SNAPSHOT);
+      do_pop_snapshot_sig.Trigger();
+    }
 
-    if (update_first_solution_found == update && update % SUMMARY_STATS_INTERVAL != 0) {
+    if (first_solution_reported && update % SUMMARY_STATS_INTERVAL != 0) {
       prog_world->GetFile(DATA_DIRECTORY + "/prog_gen_sys.csv").Update(); // Update the program systematics files
     } 
+    first_solution_reported = false;
+
+    #ifndef EMSCRIPTEN
+    prog_fitness_file->Update(prog_world->GetUpdate());
+    test_fitness_file->Update(prog_world->GetUpdate());
+    pop_stats_file->Update(prog_world->GetUpdate());
+    #endif
 
     prog_world->Update();
     prog_world->ClearCache();
@@ -1210,40 +1792,40 @@ void ProgramSynthesisExperiment::Setup(const ProgramSynthesisConfig & config) {
   });
 
   // Setup the virtual hardware used to evaluate programs.
-  std::cout << "==== EXPERIMENT SETUP => evaluation hardware ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => evaluation hardware ====" << std::endl;
   SetupHardware(); 
   
   // Setup problem that we're evolving programs to solve. The particular problem
   // we setup depends on experiment configuration.
-  std::cout << "==== EXPERIMENT SETUP => problem ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => problem ====" << std::endl;
   SetupProblem();  //...many many todos embedded in this one...
 
   // Setup program (& test) evaluation.
-  std::cout << "==== EXPERIMENT SETUP => evaluation ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => evaluation ====" << std::endl;
   SetupEvaluation(); 
   
   // Setup program (& test) selection.
-  std::cout << "==== EXPERIMENT SETUP => selection ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => selection ====" << std::endl;
   SetupSelection();
 
   // Setup program (& test) mutation.
-  std::cout << "==== EXPERIMENT SETUP => mutation ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => mutation ====" << std::endl;
   SetupMutation();
 
   // Setup program (& test) fitness calculations.
-  std::cout << "==== EXPERIMENT SETUP => fitness functions ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => fitness functions ====" << std::endl;
   SetupFitFuns();
 
   #ifndef EMSCRIPTEN
   // If we're not compiling to javascript, setup data collection for both programs
   // and tests.
-  std::cout << "==== EXPERIMENT SETUP => data collection ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => data collection ====" << std::endl;
   SetupDataCollection();
   #endif
 
   // Signal that setup is done. This will trigger any post-setup things that need
   // to run before doing evolution (e.g., population initialization).
-  std::cout << "==== EXPERIMENT SETUP => triggering end setup signal ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => triggering end setup signal ====" << std::endl;
   end_setup_sig.Trigger();
 
   // Flag setup as done.
@@ -1251,25 +1833,220 @@ void ProgramSynthesisExperiment::Setup(const ProgramSynthesisConfig & config) {
 
   // TODO - assert that only one test world ptr is not nullptr
 
-  std::cout << "==== EXPERIMENT SETUP => DONE! ====" << std::endl;
+  ExpLog() << "==== EXPERIMENT SETUP => DONE! ====" << std::endl;
 }
 
 /// Run the experiment start->finish [update=0 : update=config.GENERATIONS].
 void ProgramSynthesisExperiment::Run() {
+  InstallCheckpointSignalHandlers();
   // For each generation, advance 'time' by one step.
-  for (update = 0; update <= GENERATIONS; ++update) {
+  for ( ; update <= GENERATIONS; ++update) {
     RunStep();
+    if (DoCheckpoint()) break;
+  }
+  prog_sol_screener.Wait();
+  WriteScreenedSolutions();
+  checkpoint_writer.Wait();
+  snapshot_writer.Wait();
+}
+
+/// Configure the experiment and restore its state from a checkpoint.
+void ProgramSynthesisExperiment::Resume(const ProgramSynthesisConfig & config, const std::string & checkpoint_fpath) {
+  std::istringstream in(LoadCheckpointFile(checkpoint_fpath));
+  const size_t resume_update = ReadCheckpointHeader(in, "ProgramSynthesisExperiment", data_files);
+  Setup(config);
+  ReadCheckpoint(in);
+  if (!in) {
+    ExpLog() << "Failed to read checkpoint (" << checkpoint_fpath << "). Exiting." << std::endl;
+    exit(-1);
   }
+  data_files.Resume();
+  update = resume_update;
+  ExpLog() << "Resumed from checkpoint (" << checkpoint_fpath << ") at update " << update << std::endl;
 }
 
 /// Run a single step of the experiment
 void ProgramSynthesisExperiment::RunStep() {
+  // Act on solutions screened so far (never waits on screening).
+  WriteScreenedSolutions();
   // std::cout << "-- Doing Evaluation --" << std::endl;
-  do_evaluation_sig.Trigger();  // (1) Evaluate all members of program (& test) population(s).
+  {
+    EXP_INSTRUMENT_PHASE(EVALUATION);
+    do_evaluation_sig.Trigger();  // (1) Evaluate all members of program (& test) population(s).
+  }
   // std::cout << "-- Doing Selection --" << std::endl;
-  do_selection_sig.Trigger();   // (2) Select who gets to reproduce!
+  {
+    EXP_INSTRUMENT_PHASE(SELECTION);
+    do_selection_sig.Trigger();   // (2) Select who gets to reproduce!
+  }
   // std::cout << "-- Doing Update --" << std::endl;
-  do_update_sig.Trigger();      // (3) Run update on relevant worlds (population turnover, etc).
+  {
+    EXP_INSTRUMENT_PHASE(UPDATE);
+    do_update_sig.Trigger();      // (3) Run update on relevant worlds (population turnover, etc).
+  }
+#ifdef EXP_INSTRUMENT
+  timing_file->EndStep(update);
+#endif
+}
+
+// ================ Checkpointing ================
+
+/// Serialize experiment state. Only valid between generations (after RunStep):
+/// - Program/test phenotypes have just been reset, and cohorts are re-randomized at the start of
+///   each evaluation, so neither is saved.
+/// - Systematics are saved after the world they track (see SystematicsCheckpoint.h).
+/// - Solution screening state (screened genome hashes and solutions not yet written) is saved, so a
+///   resumed run neither re-screens nor loses candidates.
+void ProgramSynthesisExperiment::WriteCheckpoint(std::ostream & out) {
+  // Finish screening in progress, so that its testing set results are saved with validation_difficulty.
+  prog_sol_screener.Wait();
+  RecordScreenResults();
+  CheckpointWrite(out, solution_found);
+  CheckpointWrite(out, (uint64_t)smallest_prog_sol_size);
+  CheckpointWrite(out, (uint64_t)update_first_solution_found);
+  CheckpointWrite(out, (uint64_t)mrca_changes);
+  training_difficulty.WriteCheckpoint(out);
+  validation_difficulty.WriteCheckpoint(out);
+  // Worlds
+  CheckpointWrite(out, (uint64_t)prog_world->GetUpdate());
+  CheckpointWriteWorld(out, *prog_world);
+  CheckpointWriteSystematics(out, *prog_genotypic_systematics);
+  prog_sys_compactor.WriteCheckpoint(out);
+  CheckpointWriteScreener(out, prog_sol_screener, [](std::ostream & out, const ProgSolutionCandidate & candidate) {
+    CheckpointWrite(out, (uint64_t)candidate.update);
+    CheckpointWrite(out, (uint64_t)candidate.progID);
+    CheckpointIO<prog_org_gen_t>::Write(out, candidate.genome);
+  });
+  if (prob_NumberIO_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_NumberIO_world->GetUpdate()); CheckpointWriteWorld(out, *prob_NumberIO_world); }
+  else if (prob_SmallOrLarge_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_SmallOrLarge_world->GetUpdate()); CheckpointWriteWorld(out, *prob_SmallOrLarge_world); }
+  else if (prob_ForLoopIndex_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_ForLoopIndex_world->GetUpdate()); CheckpointWriteWorld(out, *prob_ForLoopIndex_world); }
+  else if (prob_CompareStringLengths_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_CompareStringLengths_world->GetUpdate()); CheckpointWriteWorld(out, *prob_CompareStringLengths_world); }
+  else if (prob_DoubleLetters_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_DoubleLetters_world->GetUpdate()); CheckpointWriteWorld(out, *prob_DoubleLetters_world); }
+  else if (prob_CollatzNumbers_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_CollatzNumbers_world->GetUpdate()); CheckpointWriteWorld(out, *prob_CollatzNumbers_world); }
+  else if (prob_ReplaceSpaceWithNewline_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_ReplaceSpaceWithNewline_world->GetUpdate()); CheckpointWriteWorld(out, *prob_ReplaceSpaceWithNewline_world); }
+  else if (prob_StringDifferences_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_StringDifferences_world->GetUpdate()); CheckpointWriteWorld(out, *prob_StringDifferences_world); }
+  else if (prob_EvenSquares_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_EvenSquares_world->GetUpdate()); CheckpointWriteWorld(out, *prob_EvenSquares_world); }
+  else if (prob_WallisPi_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_WallisPi_world->GetUpdate()); CheckpointWriteWorld(out, *prob_WallisPi_world); }
+  else if (prob_StringLengthsBackwards_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_StringLengthsBackwards_world->GetUpdate()); CheckpointWriteWorld(out, *prob_StringLengthsBackwards_world); }
+  else if (prob_LastIndexOfZero_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_LastIndexOfZero_world->GetUpdate()); CheckpointWriteWorld(out, *prob_LastIndexOfZero_world); }
+  else if (prob_VectorAverage_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_VectorAverage_world->GetUpdate()); CheckpointWriteWorld(out, *prob_VectorAverage_world); }
+  else if (prob_CountOdds_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_CountOdds_world->GetUpdate()); CheckpointWriteWorld(out, *prob_CountOdds_world); }
+  else if (prob_MirrorImage_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_MirrorImage_world->GetUpdate()); CheckpointWriteWorld(out, *prob_MirrorImage_world); }
+  else if (prob_SuperAnagrams_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_SuperAnagrams_world->GetUpdate()); CheckpointWriteWorld(out, *prob_SuperAnagrams_world); }
+  else if (prob_SumOfSquares_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_SumOfSquares_world->GetUpdate()); CheckpointWriteWorld(out, *prob_SumOfSquares_world); }
+  else if (prob_VectorsSummed_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_VectorsSummed_world->GetUpdate()); CheckpointWriteWorld(out, *prob_VectorsSummed_world); }
+  else if (prob_XWordLines_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_XWordLines_world->GetUpdate()); CheckpointWriteWorld(out, *prob_XWordLines_world); }
+  else if (prob_PigLatin_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_PigLatin_world->GetUpdate()); CheckpointWriteWorld(out, *prob_PigLatin_world); }
+  else if (prob_NegativeToZero_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_NegativeToZero_world->GetUpdate()); CheckpointWriteWorld(out, *prob_NegativeToZero_world); }
+  else if (prob_ScrabbleScore_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_ScrabbleScore_world->GetUpdate()); CheckpointWriteWorld(out, *prob_ScrabbleScore_world); }
+  else if (prob_Checksum_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_Checksum_world->GetUpdate()); CheckpointWriteWorld(out, *prob_Checksum_world); }
+  else if (prob_Digits_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_Digits_world->GetUpdate()); CheckpointWriteWorld(out, *prob_Digits_world); }
+  else if (prob_Grade_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_Grade_world->GetUpdate()); CheckpointWriteWorld(out, *prob_Grade_world); }
+  else if (prob_Median_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_Median_world->GetUpdate()); CheckpointWriteWorld(out, *prob_Median_world); }
+  else if (prob_Smallest_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_Smallest_world->GetUpdate()); CheckpointWriteWorld(out, *prob_Smallest_world); }
+  else if (prob_Syllables_world != nullptr) { CheckpointWrite(out, (uint64_t)prob_Syllables_world->GetUpdate()); CheckpointWriteWorld(out, *prob_Syllables_world); }
+  if (WriteTestSystematicsCheckpoint) WriteTestSystematicsCheckpoint(out);
+  // Random number generator goes last.
+  CheckpointWrite(out, *random);
+}
+
+void ProgramSynthesisExperiment::ReadCheckpoint(std::istream & in) {
+  uint64_t val = 0;
+  CheckpointRead(in, solution_found);
+  CheckpointRead(in, val); smallest_prog_sol_size = (size_t)val;
+  CheckpointRead(in, val); update_first_solution_found = (size_t)val;
+  CheckpointRead(in, val); mrca_changes = (size_t)val;
+  training_difficulty.ReadCheckpoint(in);
+  validation_difficulty.ReadCheckpoint(in);
+  // Worlds
+  CheckpointRead(in, val);
+  CheckpointReadWorld(in, *prog_world);
+  SetWorldUpdate(*prog_world, (size_t)val);
+  CheckpointReadSystematics(in, *prog_genotypic_systematics);
+  prog_sys_compactor.ReadCheckpoint(in);
+  mrca_taxa_ptr = prog_genotypic_systematics->GetMRCA();
+  // Candidate genomes are read into copies of a restored program (for its instruction library).
+  CheckpointReadScreener(in, prog_sol_screener, [this](std::istream & in) {
+    ProgSolutionCandidate candidate{0, 0, prog_world->GetGenomeAt(0)};
+    uint64_t val = 0;
+    CheckpointRead(in, val); candidate.update = (size_t)val;
+    CheckpointRead(in, val); candidate.progID = (size_t)val;
+    CheckpointIO<prog_org_gen_t>::Read(in, candidate.genome);
+    return candidate;
+  });
+  if (prob_NumberIO_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_NumberIO_world); SetWorldUpdate(*prob_NumberIO_world, (size_t)val); }
+  else if (prob_SmallOrLarge_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_SmallOrLarge_world); SetWorldUpdate(*prob_SmallOrLarge_world, (size_t)val); }
+  else if (prob_ForLoopIndex_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_ForLoopIndex_world); SetWorldUpdate(*prob_ForLoopIndex_world, (size_t)val); }
+  else if (prob_CompareStringLengths_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_CompareStringLengths_world); SetWorldUpdate(*prob_CompareStringLengths_world, (size_t)val); }
+  else if (prob_DoubleLetters_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_DoubleLetters_world); SetWorldUpdate(*prob_DoubleLetters_world, (size_t)val); }
+  else if (prob_CollatzNumbers_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_CollatzNumbers_world); SetWorldUpdate(*prob_CollatzNumbers_world, (size_t)val); }
+  else if (prob_ReplaceSpaceWithNewline_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_ReplaceSpaceWithNewline_world); SetWorldUpdate(*prob_ReplaceSpaceWithNewline_world, (size_t)val); }
+  else if (prob_StringDifferences_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_StringDifferences_world); SetWorldUpdate(*prob_StringDifferences_world, (size_t)val); }
+  else if (prob_EvenSquares_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_EvenSquares_world); SetWorldUpdate(*prob_EvenSquares_world, (size_t)val); }
+  else if (prob_WallisPi_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_WallisPi_world); SetWorldUpdate(*prob_WallisPi_world, (size_t)val); }
+  else if (prob_StringLengthsBackwards_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_StringLengthsBackwards_world); SetWorldUpdate(*prob_StringLengthsBackwards_world, (size_t)val); }
+  else if (prob_LastIndexOfZero_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_LastIndexOfZero_world); SetWorldUpdate(*prob_LastIndexOfZero_world, (size_t)val); }
+  else if (prob_VectorAverage_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_VectorAverage_world); SetWorldUpdate(*prob_VectorAverage_world, (size_t)val); }
+  else if (prob_CountOdds_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_CountOdds_world); SetWorldUpdate(*prob_CountOdds_world, (size_t)val); }
+  else if (prob_MirrorImage_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_MirrorImage_world); SetWorldUpdate(*prob_MirrorImage_world, (size_t)val); }
+  else if (prob_SuperAnagrams_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_SuperAnagrams_world); SetWorldUpdate(*prob_SuperAnagrams_world, (size_t)val); }
+  else if (prob_SumOfSquares_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_SumOfSquares_world); SetWorldUpdate(*prob_SumOfSquares_world, (size_t)val); }
+  else if (prob_VectorsSummed_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_VectorsSummed_world); SetWorldUpdate(*prob_VectorsSummed_world, (size_t)val); }
+  else if (prob_XWordLines_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_XWordLines_world); SetWorldUpdate(*prob_XWordLines_world, (size_t)val); }
+  else if (prob_PigLatin_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_PigLatin_world); SetWorldUpdate(*prob_PigLatin_world, (size_t)val); }
+  else if (prob_NegativeToZero_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_NegativeToZero_world); SetWorldUpdate(*prob_NegativeToZero_world, (size_t)val); }
+  else if (prob_ScrabbleScore_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_ScrabbleScore_world); SetWorldUpdate(*prob_ScrabbleScore_world, (size_t)val); }
+  else if (prob_Checksum_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_Checksum_world); SetWorldUpdate(*prob_Checksum_world, (size_t)val); }
+  else if (prob_Digits_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_Digits_world); SetWorldUpdate(*prob_Digits_world, (size_t)val); }
+  else if (prob_Grade_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_Grade_world); SetWorldUpdate(*prob_Grade_world, (size_t)val); }
+  else if (prob_Median_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_Median_world); SetWorldUpdate(*prob_Median_world, (size_t)val); }
+  else if (prob_Smallest_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_Smallest_world); SetWorldUpdate(*prob_Smallest_world, (size_t)val); }
+  else if (prob_Syllables_world != nullptr) { CheckpointRead(in, val); CheckpointReadWorld(in, *prob_Syllables_world); SetWorldUpdate(*prob_Syllables_world, (size_t)val); }
+  if (ReadTestSystematicsCheckpoint) ReadTestSystematicsCheckpoint(in);
+  // Random number generator goes last.
+  CheckpointRead(in, *random);
+}
+
+bool ProgramSynthesisExperiment::DoCheckpoint() {
+  const int sig = TakeCheckpointSignal();
+  const bool scheduled = CHECKPOINT_INTERVAL && update && (update % CHECKPOINT_INTERVAL == 0);
+  if (!sig && !scheduled) return false;
+  const std::string checkpoint_fpath = DATA_DIRECTORY + "/" + CHECKPOINT_FILE;
+  ExpLog() << "Checkpointing at update " << update << " (" << checkpoint_fpath << ")" << std::endl;
+  // Serialize state now (so next generation can proceed); write it out in the background.
+  std::ostringstream out;
+  WriteCheckpointHeader(out, "ProgramSynthesisExperiment", update + 1, data_files);
+  WriteCheckpoint(out);
+  checkpoint_writer.Write(checkpoint_fpath, out.str());
+  if (sig == SIGTERM) {
+    checkpoint_writer.Wait();
+    ExpLog() << "SIGTERM received; stopping after checkpoint." << std::endl;
+    return true;
+  }
+  return false;
+}
+
+/// Confirmed solutions are written in the order they were first seen, each only if it is smaller
+/// than every solution written before it.
+void ProgramSynthesisExperiment::WriteScreenedSolutions() {
+  emp::vector<ProgSolutionCandidate> solutions(prog_sol_screener.Drain());
+  if (solutions.empty()) return;
+  std::stable_sort(solutions.begin(), solutions.end(), [](const ProgSolutionCandidate & a, const ProgSolutionCandidate & b) {
+    return a.update < b.update;
+  });
+  for (const ProgSolutionCandidate & solution : solutions) {
+    if (solution.genome.GetSize() >= smallest_prog_sol_size) continue;
+    if (!solution_found) {
+      update_first_solution_found = solution.update;
+      first_solution_reported = true;
+    }
+    solution_found = true;
+    smallest_prog_sol_size = solution.genome.GetSize();
+    cur_solution = &solution;
+    if (OUTPUT_FORMAT == OUTPUT_FORMAT_TYPE::COLUMNAR_OUTPUT) solution_col_file->Update();
+    else solution_file->Update();
+  }
+  cur_solution = nullptr;
 }
 
 // ================ Internal function implementations ================
@@ -1280,11 +2057,13 @@ void ProgramSynthesisExperiment::InitConfigs(const ProgramSynthesisConfig & conf
   PROG_POP_SIZE = config.PROG_POP_SIZE();
   TEST_POP_SIZE = config.TEST_POP_SIZE();
   EVALUATION_MODE = config.EVALUATION_MODE();
+  SPARSE_EVALUATION = config.SPARSE_EVALUATION();
   PROG_COHORT_SIZE = config.PROG_COHORT_SIZE();
   TEST_COHORT_SIZE = config.TEST_COHORT_SIZE();
   TRAINING_EXAMPLE_MODE = config.TRAINING_EXAMPLE_MODE();
   PROBLEM = config.PROBLEM();
   BENCHMARK_DATA_DIR = config.BENCHMARK_DATA_DIR();
+  TESTING_SET_STREAM_CHUNK_SIZE = config.TESTING_SET_STREAM_CHUNK_SIZE();
 
   // -- Selection settings --
   PROG_SELECTION_MODE = config.PROG_SELECTION_MODE();
@@ -1296,6 +2075,8 @@ void ProgramSynthesisExperiment::InitConfigs(const ProgramSynthesisConfig & conf
   PROG_TOURNAMENT_SIZE = config.PROG_TOURNAMENT_SIZE();
   TEST_TOURNAMENT_SIZE = config.TEST_TOURNAMENT_SIZE();
   DISCRIMINATORY_LEXICASE_TESTS = config.DISCRIMINATORY_LEXICASE_TESTS();
+  PROG_LEXICASE_CASE_ORDER = config.PROG_LEXICASE_CASE_ORDER();
+  TEST_DIFFICULTY_SMOOTHING = config.TEST_DIFFICULTY_SMOOTHING();
 
   // -- Hardware settings --
   MIN_TAG_SPECIFICITY = config.MIN_TAG_SPECIFICITY();
@@ -1312,6 +2093,9 @@ void ProgramSynthesisExperiment::InitConfigs(const ProgramSynthesisConfig & conf
   PROG_MUT__PER_PROG_SLIP = config.PROG_MUT__PER_PROG_SLIP();
   PROG_MUT__PER_MOD_DUP = config.PROG_MUT__PER_MOD_DUP();
   PROG_MUT__PER_MOD_DEL = config.PROG_MUT__PER_MOD_DEL();
+  MUTATION_SAMPLING_MODE = config.MUTATION_SAMPLING_MODE();
+  OFFSPRING_MUTATION_MODE = config.OFFSPRING_MUTATION_MODE();
+  REPRODUCTION_THREADS = config.REPRODUCTION_THREADS();
 
   // -- Number IO settings --
   PROB_NUMBER_IO__DOUBLE_MIN = config.PROB_NUMBER_IO__DOUBLE_MIN();
@@ -1423,8 +2207,21 @@ void ProgramSynthesisExperiment::InitConfigs(const ProgramSynthesisConfig & conf
 
   DATA_DIRECTORY = config.DATA_DIRECTORY();
   SUMMARY_STATS_INTERVAL = config.SUMMARY_STATS_INTERVAL();
+  SYSTEMATICS_MODE = config.SYSTEMATICS_MODE();
+  SYSTEMATICS_KEYFRAME_INTERVAL = config.SYSTEMATICS_KEYFRAME_INTERVAL();
+  SYSTEMATICS_MAX_MB = config.SYSTEMATICS_MAX_MB();
   SNAPSHOT_INTERVAL = config.SNAPSHOT_INTERVAL();
+  SNAPSHOT_QUEUE_SIZE = config.SNAPSHOT_QUEUE_SIZE();
+  OUTPUT_FORMAT = config.OUTPUT_FORMAT();
+  VALIDATION_MODE = config.VALIDATION_MODE();
+  VALIDATION_SAMPLE_SIZE = config.VALIDATION_SAMPLE_SIZE();
+  VALIDATION_SAMPLE_STRATA = config.VALIDATION_SAMPLE_STRATA();
   SOLUTION_SCREEN_INTERVAL = config.SOLUTION_SCREEN_INTERVAL();
+  SOLUTION_SCREEN_THREADS = config.SOLUTION_SCREEN_THREADS();
+  SOLUTION_SCREEN_QUEUE_SIZE = config.SOLUTION_SCREEN_QUEUE_SIZE();
+  SOLUTION_SCREEN_CACHE_SIZE = config.SOLUTION_SCREEN_CACHE_SIZE();
+  CHECKPOINT_INTERVAL = config.CHECKPOINT_INTERVAL();
+  CHECKPOINT_FILE = config.CHECKPOINT_FILE();
 
 }
 
@@ -1463,23 +2260,27 @@ void ProgramSynthesisExperiment::SetupProblem() {
     case PROBLEM_ID::Smallest: { SetupProblem_Smallest(); break; }
     case PROBLEM_ID::Syllables: { SetupProblem_Syllables(); break; }
     default: {
-      std::cout << "Unknown problem (" << PROBLEM << "). Exiting." << std::endl;
+      ExpLog() << "Unknown problem (" << PROBLEM << "). Exiting." << std::endl;
       exit(-1);
     }
   }
 }
 
+/// Configure the CPU (evaluation hardware and solution screener workers' hardware).
+void ProgramSynthesisExperiment::ConfigureHardware(hardware_t & hw) {
+  hw.SetMemSize(MEM_SIZE);                       // Configure size of memory.
+  hw.SetMinTagSpecificity(MIN_TAG_SPECIFICITY);  // Configure minimum tag specificity required for tag-based referencing.
+  hw.SetMaxCallDepth(MAX_CALL_DEPTH);            // Configure maximum depth of call stack (recursion limit).
+  hw.SetMemTags(GenHadamardMatrix<TAG_WIDTH>()); // Configure memory location tags. Use Hadamard matrix for given TAG_WIDTH.
+}
+
 /// Setup hardware used to evaluate evolving programs.
 void ProgramSynthesisExperiment::SetupHardware() {
   // Create new instruction library.
   inst_lib = emp::NewPtr<inst_lib_t>();
   // Create evaluation hardware.
   eval_hardware = emp::NewPtr<hardware_t>(inst_lib, random);
-  // Configure the CPU.
-  eval_hardware->SetMemSize(MEM_SIZE);                       // Configure size of memory.
-  eval_hardware->SetMinTagSpecificity(MIN_TAG_SPECIFICITY);  // Configure minimum tag specificity required for tag-based referencing.
-  eval_hardware->SetMaxCallDepth(MAX_CALL_DEPTH);            // Configure maximum depth of call stack (recursion limit).
-  eval_hardware->SetMemTags(GenHadamardMatrix<TAG_WIDTH>()); // Configure memory location tags. Use Hadamard matrix for given TAG_WIDTH.
+  ConfigureHardware(*eval_hardware);
 
   // Configure call tag (tag used to call initial module during test evaluation).
   call_tag.Clear(); // Set initial call tag to all 0s.
@@ -1488,8 +2289,8 @@ void ProgramSynthesisExperiment::SetupHardware() {
   // - Reset virtual hardware (reset hardware, clear module definitions, clear program).
   // - Set program to given organism's 'genome'.
   begin_program_eval.AddAction([this](prog_org_t & prog_org) {
-    eval_hardware->Reset();
-    eval_hardware->SetProgram(prog_org.GetGenome());
+    GetEvalHardware().Reset();
+    GetEvalHardware().SetProgram(prog_org.GetGenome());
   });
 
   // What do at end of program evaluation (after being run on some number of tests)?
@@ -1498,34 +2299,63 @@ void ProgramSynthesisExperiment::SetupHardware() {
   // What to do before running program on a single test?
   // - Reset virtual hardware (reset global memory, reset call stack).
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_ptr) {
-    eval_hardware->ResetHardware();
-    eval_hardware->CallModule(call_tag, MIN_TAG_SPECIFICITY, true, false);
+    GetEvalHardware().ResetHardware();
+    GetEvalHardware().CallModule(call_tag, MIN_TAG_SPECIFICITY, true, false);
   });
 
   // Specify how we 'do' a program test.
   // - For specified evaluation time, advance evaluation hardware. If at any point
   //   the program's call stack is empty, automatically finish the evaluation.
   do_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_ptr) {
+    hardware_t & hw = GetEvalHardware();
     // std::cout << "--- DO PROGRAM TEST ---" << std::endl;
     // std::cout << "==== Initial hardware state ====" << std::endl;
     // eval_hardware->PrintHardwareState();
-    for (eval_time = 0; eval_time < PROG_EVAL_TIME; ++eval_time) {
+    for (size_t eval_time = 0; eval_time < PROG_EVAL_TIME; ++eval_time) {
       // std::cout << "==== Time = " << eval_time << "==== " << std::endl;
       do_program_advance.Trigger(prog_org);
       // eval_hardware->PrintHardwareState();
-      if (eval_hardware->GetCallStackSize() == 0) break; // If call stack is ever completely empty, program is done early.
+      if (hw.GetCallStackSize() == 0) break; // If call stack is ever completely empty, program is done early.
     }
+    test_eval_cnt.fetch_add(1, std::memory_order_relaxed);
+    EXP_INSTRUMENT_COUNT(TESTS_EVALUATED, 1);
     // exit(-1);
   });
   
   // How do we advance the evaluation hardware?
   do_program_advance.AddAction([this](prog_org_t &) {
-    eval_hardware->SingleProcess();
+    GetEvalHardware().SingleProcess();
+    EXP_INSTRUMENT_COUNT(INSTRUCTIONS, 1);
   });
 }
 
 // Setup evaluation.
 void ProgramSynthesisExperiment::SetupEvaluation() {
+  // Setup test case difficulty indices. Running statistics only carry over across
+  // generations if test case IDs always refer to the same test case.
+  training_difficulty.Resize(TEST_POP_SIZE);
+  if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC || TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_GEN) {
+    training_difficulty.SetSmoothing(TEST_DIFFICULTY_SMOOTHING);
+  } else {
+    training_difficulty.SetSmoothing(1.0);
+  }
+  validation_difficulty.SetSmoothing(TEST_DIFFICULTY_SMOOTHING);
+
+  // Sparse evaluation only re-evaluates programs whose genomes changed, which is only valid if
+  // every program is evaluated on the same (unchanging) tests every generation.
+  prev_prog_phenotypes.clear();
+  if (SPARSE_EVALUATION) {
+    const bool static_tests = TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC
+                              || TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_GEN;
+    const bool all_tests = EVALUATION_MODE == (size_t)EVALUATION_TYPE::FULL
+                           || EVALUATION_MODE == (size_t)EVALUATION_TYPE::PROG_ONLY_COHORT;
+    if (!static_tests || !all_tests) {
+      ExpLog() << "SPARSE_EVALUATION requires STATIC or STATIC_GEN training examples and FULL or PROG_ONLY_COHORT evaluation. Exiting." << std::endl;
+      exit(-1);
+    }
+    ExpLog() << "Sparse evaluation: only programs with new genomes are evaluated." << std::endl;
+  }
+
   switch (EVALUATION_MODE) {
     // In cohort evaluation, programs and tests are evaluated in 'cohorts'. Populations
     // are divided into cohorts (the number of cohorts for tests and programs must
@@ -1533,28 +2363,32 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
     case (size_t)EVALUATION_TYPE::COHORT: {
       emp_assert(PROG_POP_SIZE % PROG_COHORT_SIZE == 0, "Program population size must be evenly divisible by program cohort size.");
       emp_assert(TEST_POP_SIZE % TEST_COHORT_SIZE == 0, "Test population size must be evenly divisible by test cohort size.");
-      std::cout << "Setting up cohorts." << std::endl;
+      ExpLog() << "Setting up cohorts." << std::endl;
       test_cohorts.Setup(TEST_POP_SIZE, TEST_COHORT_SIZE);
       prog_cohorts.Setup(PROG_POP_SIZE, PROG_COHORT_SIZE);
-      std::cout << "  # test cohorts = " << test_cohorts.GetCohortCnt() << std::endl;
-      std::cout << "  # program cohorts = " << prog_cohorts.GetCohortCnt() << std::endl;
+      ExpLog() << "  # test cohorts = " << test_cohorts.GetCohortCnt() << std::endl;
+      ExpLog() << "  # program cohorts = " << prog_cohorts.GetCohortCnt() << std::endl;
       if (test_cohorts.GetCohortCnt() != prog_cohorts.GetCohortCnt()) {
-        std::cout << "ERROR: Test cohort count must the same as program cohort count in COHORT mode. Exiting." << std::endl;
+        ExpLog() << "ERROR: Test cohort count must the same as program cohort count in COHORT mode. Exiting." << std::endl;
         exit(-1);
       }
       NUM_COHORTS = prog_cohorts.GetCohortCnt();
       PROGRAM_MAX_PASSES = TEST_COHORT_SIZE;
+      // Scores are stored by cohort slot: row (cID * PROG_COHORT_SIZE + pID), column tID. Each
+      // test's scores are its column within its cohort's rows.
+      prog_test_scores.Resize(PROG_POP_SIZE, TEST_COHORT_SIZE);
+      prog_test_passes.Resize(PROG_POP_SIZE, TEST_COHORT_SIZE);
 
       // Setup program world on placement response.
       prog_world->OnPlacement([this](size_t pos) {
         // On placement, reset organism phenotype.
-        prog_world->GetOrg(pos).GetPhenotype().Reset(TEST_COHORT_SIZE);
+        prog_world->GetOrg(pos).GetPhenotype().Reset();
       });
       
       // Setup test case world on placement response.
       OnPlacement_ActiveTestCaseWorld([this](size_t pos) { 
         // On placement, reset organism phenotype.
-        GetTestPhenotype(pos).Reset(PROG_COHORT_SIZE); 
+        GetTestPhenotype(pos).Reset(); 
       });
 
       // What should happen on evaluation?
@@ -1564,9 +2398,15 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
         test_cohorts.Randomize(*random);
         // For each cohort, evaluate all programs against all tests in corresponding cohort.
         for (size_t cID = 0; cID < prog_cohorts.GetCohortCnt(); ++cID) {
+          const size_t row_begin = cID * PROG_COHORT_SIZE;
+          for (size_t tID = 0; tID < TEST_COHORT_SIZE; ++tID) {
+            GetTestPhenotype(test_cohorts.GetWorldID(cID, tID)).Reset(prog_test_scores.GetColumn(tID, row_begin, PROG_COHORT_SIZE),
+                                                                     prog_test_passes.GetColumn(tID, row_begin, PROG_COHORT_SIZE));
+          }
           for (size_t pID = 0; pID < PROG_COHORT_SIZE; ++pID) {
             // Get program organism specified by pID.
             prog_org_t & prog_org = prog_world->GetOrg(prog_cohorts.GetWorldID(cID, pID));
+            prog_org.GetPhenotype().Reset(prog_test_scores.GetRow(row_begin + pID), prog_test_passes.GetRow(row_begin + pID));
             begin_program_eval.Trigger(prog_org);
             for (size_t tID = 0; tID < TEST_COHORT_SIZE; ++tID) {
               const size_t test_world_id = test_cohorts.GetWorldID(cID, tID);
@@ -1583,14 +2423,18 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
               // - bool pass;
               // - bool sub;
         
+              // Update score matrices.
+              prog_test_scores(row_begin + pID, tID) = result.score;
+              prog_test_passes(row_begin + pID, tID) = (uint8_t)result.pass;
+
               // Update program phenotype.
-              prog_phen.RecordScore(tID, result.score);
-              prog_phen.RecordPass(tID, result.pass);
+              prog_phen.RecordScore(result.score);
+              prog_phen.RecordPass(result.pass);
               prog_phen.RecordSubmission(result.sub);
               
               // Update test phenotype
-              test_phen.RecordScore(pID, result.score);
-              test_phen.RecordPass(pID, result.pass);
+              test_phen.RecordScore(result.score);
+              test_phen.RecordPass(result.pass);
             }
             end_program_eval.Trigger(prog_org);
           }
@@ -1600,18 +2444,18 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
     }
     // In full evaluation mode, evaluate all programs on all tests.
     case (size_t)EVALUATION_TYPE::FULL: {
-      std::cout << "Setting up full evaluation. No cohorts here." << std::endl;
+      ExpLog() << "Setting up full evaluation. No cohorts here." << std::endl;
       
       // Setup program world on placement signal response.
       prog_world->OnPlacement([this](size_t pos) {
         // Reset program phenotype on placement.
-        prog_world->GetOrg(pos).GetPhenotype().Reset(TEST_POP_SIZE); 
+        prog_world->GetOrg(pos).GetPhenotype().Reset(); 
       });
 
       // Setup test world on placement signal response.
       OnPlacement_ActiveTestCaseWorld([this](size_t pos) {
         // Reset test phenotype on placement.
-        GetTestPhenotype(pos).Reset(PROG_POP_SIZE);   
+        GetTestPhenotype(pos).Reset();   
       });
       
       PROGRAM_MAX_PASSES = TEST_POP_SIZE;
@@ -1619,9 +2463,11 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
 
       // What should happen on evaluation?
       do_evaluation_sig.AddAction([this]() {
+        BindFullEvaluationPhenotypes();
         for (size_t pID = 0; pID < PROG_POP_SIZE; ++pID) {
           emp_assert(prog_world->IsOccupied(pID));
           prog_org_t & prog_org = prog_world->GetOrg(pID);
+          if (SPARSE_EVALUATION && ReuseParentPhenotype(prog_org, pID)) continue;
           begin_program_eval.Trigger(prog_org);
           for (size_t tID = 0; tID < TEST_POP_SIZE; ++tID) {
 
@@ -1636,41 +2482,47 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
             // - bool pass;
             // - bool sub;
 
+            // Update score matrices.
+            prog_test_scores(pID, tID) = result.score;
+            prog_test_passes(pID, tID) = (uint8_t)result.pass;
+
             // Update program phenotype.
-            prog_phen.RecordScore(tID, result.score);
-            prog_phen.RecordPass(tID, result.pass);
+            prog_phen.RecordScore(result.score);
+            prog_phen.RecordPass(result.pass);
             prog_phen.RecordSubmission(result.sub);
             
             // Update phenotypes.
-            test_phen.RecordScore(pID, result.score);
-            test_phen.RecordPass(pID, result.pass);
+            test_phen.RecordScore(result.score);
+            test_phen.RecordPass(result.pass);
           }
           end_program_eval.Trigger(prog_org);
+          prog_org.ClearDirty();
         }
+        if (SPARSE_EVALUATION) SaveProgramPhenotypes();
       });
 
       break;
     }
     case (size_t)EVALUATION_TYPE::PROG_ONLY_COHORT: {
-      std::cout << "Setting up full evaluation with PROGRAM ONLY cohorts." << std::endl;
+      ExpLog() << "Setting up full evaluation with PROGRAM ONLY cohorts." << std::endl;
 
       emp_assert(PROG_POP_SIZE % PROG_COHORT_SIZE == 0, "Program population size must be evenly divisible by program cohort size.");
-      std::cout << "Setting up PROGRAM cohorts." << std::endl;
+      ExpLog() << "Setting up PROGRAM cohorts." << std::endl;
       prog_cohorts.Setup(PROG_POP_SIZE, PROG_COHORT_SIZE);
-      std::cout << "  # program cohorts = " << prog_cohorts.GetCohortCnt() << std::endl;
+      ExpLog() << "  # program cohorts = " << prog_cohorts.GetCohortCnt() << std::endl;
       NUM_COHORTS = prog_cohorts.GetCohortCnt();
       PROGRAM_MAX_PASSES = TEST_POP_SIZE;  
       
       // Setup program world on placement signal response.
       prog_world->OnPlacement([this](size_t pos) {
         // Reset program phenotype on placement.
-        prog_world->GetOrg(pos).GetPhenotype().Reset(TEST_POP_SIZE); 
+        prog_world->GetOrg(pos).GetPhenotype().Reset(); 
       });
 
       // Setup test world on placement signal response.
       OnPlacement_ActiveTestCaseWorld([this](size_t pos) {
         // Reset test phenotype on placement.
-        GetTestPhenotype(pos).Reset(PROG_POP_SIZE);   
+        GetTestPhenotype(pos).Reset();   
       });
       
 
@@ -1679,9 +2531,11 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
 
         prog_cohorts.Randomize(*random);
 
+        BindFullEvaluationPhenotypes();
         for (size_t pID = 0; pID < PROG_POP_SIZE; ++pID) {
           emp_assert(prog_world->IsOccupied(pID));
           prog_org_t & prog_org = prog_world->GetOrg(pID);
+          if (SPARSE_EVALUATION && ReuseParentPhenotype(prog_org, pID)) continue;
           begin_program_eval.Trigger(prog_org);
           for (size_t tID = 0; tID < TEST_POP_SIZE; ++tID) {
 
@@ -1696,37 +2550,46 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
             // - bool pass;
             // - bool sub;
 
+            // Update score matrices.
+            prog_test_scores(pID, tID) = result.score;
+            prog_test_passes(pID, tID) = (uint8_t)result.pass;
+
             // Update program phenotype.
-            prog_phen.RecordScore(tID, result.score);
-            prog_phen.RecordPass(tID, result.pass);
+            prog_phen.RecordScore(result.score);
+            prog_phen.RecordPass(result.pass);
             prog_phen.RecordSubmission(result.sub);
             
             // Update phenotypes.
-            test_phen.RecordScore(pID, result.score);
-            test_phen.RecordPass(pID, result.pass);
+            test_phen.RecordScore(result.score);
+            test_phen.RecordPass(result.pass);
           }
           end_program_eval.Trigger(prog_org);
+          prog_org.ClearDirty();
         }
+        if (SPARSE_EVALUATION) SaveProgramPhenotypes();
       });
       break;
     }
     case (size_t)EVALUATION_TYPE::TEST_DOWNSAMPLING: {
-      std::cout << "Setting up downsampled evaluation with NO program cohorts." << std::endl;
+      ExpLog() << "Setting up downsampled evaluation with NO program cohorts." << std::endl;
       test_cohorts.Setup(TEST_POP_SIZE, TEST_COHORT_SIZE);
-      std::cout << "  # test cohorts = " << test_cohorts.GetCohortCnt() << std::endl;
+      ExpLog() << "  # test cohorts = " << test_cohorts.GetCohortCnt() << std::endl;
       NUM_COHORTS = prog_cohorts.GetCohortCnt();
       PROGRAM_MAX_PASSES = TEST_COHORT_SIZE;  
+      // Scores are stored by program world position (row pID) and sampled test (column tID).
+      prog_test_scores.Resize(PROG_POP_SIZE, TEST_COHORT_SIZE);
+      prog_test_passes.Resize(PROG_POP_SIZE, TEST_COHORT_SIZE);
       
       // Setup program world on placement signal response.
       prog_world->OnPlacement([this](size_t pos) {
         // Reset program phenotype on placement.
-        prog_world->GetOrg(pos).GetPhenotype().Reset(TEST_COHORT_SIZE); 
+        prog_world->GetOrg(pos).GetPhenotype().Reset(); 
       });
 
       // Setup test world on placement signal response.
       OnPlacement_ActiveTestCaseWorld([this](size_t pos) {
         // Reset test phenotype on placement.
-        GetTestPhenotype(pos).Reset(PROG_POP_SIZE);   
+        GetTestPhenotype(pos).Reset();   
       });
       
 
@@ -1735,9 +2598,17 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
 
         test_cohorts.Randomize(*random);
 
+        // Tests left out of the sample record no passes (or scores) against any program.
+        for (size_t tID = 0; tID < TEST_POP_SIZE; ++tID) {
+          GetTestPhenotype(tID).Reset(ScoreView<double>::Zeros(PROG_POP_SIZE), ScoreView<uint8_t>::Zeros(PROG_POP_SIZE));
+        }
+        for (size_t tID = 0; tID < TEST_COHORT_SIZE; ++tID) {
+          GetTestPhenotype(test_cohorts.GetWorldID(0, tID)).Reset(prog_test_scores.GetColumn(tID), prog_test_passes.GetColumn(tID));
+        }
         for (size_t pID = 0; pID < PROG_POP_SIZE; ++pID) {
           emp_assert(prog_world->IsOccupied(pID));
           prog_org_t & prog_org = prog_world->GetOrg(pID);
+          prog_org.GetPhenotype().Reset(prog_test_scores.GetRow(pID), prog_test_passes.GetRow(pID));
           begin_program_eval.Trigger(prog_org);
           for (size_t tID = 0; tID < TEST_COHORT_SIZE; ++tID) {
             const size_t test_world_id = test_cohorts.GetWorldID(0, tID);
@@ -1752,14 +2623,18 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
             // - bool pass;
             // - bool sub;
 
+            // Update score matrices.
+            prog_test_scores(pID, tID) = result.score;
+            prog_test_passes(pID, tID) = (uint8_t)result.pass;
+
             // Update program phenotype.
-            prog_phen.RecordScore(tID, result.score);
-            prog_phen.RecordPass(tID, result.pass);
+            prog_phen.RecordScore(result.score);
+            prog_phen.RecordPass(result.pass);
             prog_phen.RecordSubmission(result.sub);
             
             // Update phenotypes.
-            test_phen.RecordScore(pID, result.score);
-            test_phen.RecordPass(pID, result.pass);
+            test_phen.RecordScore(result.score);
+            test_phen.RecordPass(result.pass);
           }
           end_program_eval.Trigger(prog_org);
         }
@@ -1767,58 +2642,138 @@ void ProgramSynthesisExperiment::SetupEvaluation() {
       break;
     }
     default: {
-      std::cout << "Unknown EVALUATION_MODE (" << EVALUATION_MODE << "). Exiting." << std::endl;
+      ExpLog() << "Unknown EVALUATION_MODE (" << EVALUATION_MODE << "). Exiting." << std::endl;
       exit(-1);
     } 
   }
 
   // Add generic evaluation action - calculate num_passes/fails for tests and programs.
   do_evaluation_sig.AddAction([this]() {
-    // Sum pass totals for programs, find 'dominant' program.
-    double cur_best_score = 0;
+    // Gather population stats; 'dominant' program/test have the highest fitness.
+    GatherPopulationStats();
+    dominant_prog_id = prog_pop_stats.Get(FITNESS_STAT).argmax;
+    dominant_test_id = test_pop_stats.Get(FITNESS_STAT).argmax;
+
+    bool screen_order_published = false;
     for (size_t pID = 0; pID < prog_world->GetSize(); ++pID) {
       emp_assert(prog_world->IsOccupied(pID));
 
       prog_org_t & prog_org = prog_world->GetOrg(pID);
       const size_t pass_total = prog_org.GetPhenotype().num_passes;
-      const double total_score = prog_org.GetPhenotype().total_score;
-
-      // Is this the highest pass total program this generation?
-      if (total_score > cur_best_score || pID == 0) {
-        dominant_prog_id = pID;
-        cur_best_score = pass_total;
-      }
       // At this point, program has been evaluated against all tests. .
+      // Confirmed solutions are written at the start of an update (see WriteScreenedSolutions).
       if (pass_total == PROGRAM_MAX_PASSES && prog_org.GetGenome().GetSize() < smallest_prog_sol_size) {
-        stats_util.cur_progID = pID;
-        if (ScreenForSolution(prog_org)) {
-          if (!solution_found) { update_first_solution_found = prog_world->GetUpdate(); }
-          solution_found = true;
-          smallest_prog_sol_size = prog_org.GetGenome().GetSize();
-          // Add to solutions file.
-          solution_file->Update();
+        EXP_INSTRUMENT_PHASE(SCREEN);
+        if (!screen_order_published) {
+          PublishScreenOrder();
+          screen_order_published = true;
         }
+        prog_sol_screener.Submit(prog_sys_info_t::CalcHash(prog_org.GetGenome()), {prog_world->GetUpdate(), pID, prog_org.GetGenome()});
       }
     }
 
-    // Sum pass/fail totals for tests.
+    // Fold in screening results so far (pushing failed cases toward the front of future screens).
+    RecordScreenResults();
+    validation_difficulty.Update();
+
     for (size_t tID = 0; tID < TEST_POP_SIZE; ++tID) {
       test_org_phen_t & test_phen = GetTestPhenotype(tID);
-      if (test_phen.num_fails > cur_best_score || tID == 0) { // NOTE - will need to be updated if switch to gradient fitness functions (will be problem specific whether or not use a gradient).
-        dominant_test_id = tID;
-        cur_best_score = test_phen.num_fails;
-      }
+      training_difficulty.RecordCounts(tID, test_phen.num_passes, test_phen.num_passes + test_phen.num_fails);
     }
+    training_difficulty.Update();
   });
 }
 
+double ProgramSynthesisExperiment::CalcEvaluations(size_t world_update) const {
+  if (EVALUATION_MODE == (size_t)EVALUATION_TYPE::COHORT) {
+    // update * cohort size * cohort size * num cohorts
+    return world_update * PROG_COHORT_SIZE * TEST_COHORT_SIZE * NUM_COHORTS;
+  } else {
+    return world_update * PROG_POP_SIZE * TEST_POP_SIZE;
+  }
+}
+
+/// Gather per-organism values into population stats (one pass over each population), then
+/// summarize them. Test fitness is the test's fail count (see SetupTestFitFun).
+void ProgramSynthesisExperiment::GatherPopulationStats() {
+  const size_t num_progs = prog_world->GetSize();
+  prog_pop_stats.Resize(num_progs);
+  double * prog_fitness = prog_pop_stats.GetColumn(FITNESS_STAT);
+  double * prog_passes = prog_pop_stats.GetColumn(PASSES_STAT);
+  double * prog_size = prog_pop_stats.GetColumn(SIZE_STAT);
+  for (size_t pID = 0; pID < num_progs; ++pID) {
+    const prog_org_t & prog_org = prog_world->GetOrg(pID);
+    prog_fitness[pID] = CalcProgramFitness(prog_org);
+    prog_passes[pID] = (double)prog_org.GetPhenotype().num_passes;
+    prog_size[pID] = (double)prog_org.GetGenome().GetSize();
+  }
+  prog_pop_stats.Summarize();
+
+  test_pop_stats.Resize(TEST_POP_SIZE);
+  double * test_fitness = test_pop_stats.GetColumn(FITNESS_STAT);
+  double * test_passes = test_pop_stats.GetColumn(PASSES_STAT);
+  for (size_t tID = 0; tID < TEST_POP_SIZE; ++tID) {
+    const test_org_phen_t & test_phen = GetTestPhenotype(tID);
+    test_fitness[tID] = (double)test_phen.num_fails;
+    test_passes[tID] = (double)test_phen.num_passes;
+  }
+  test_pop_stats.Summarize();
+}
+
+/// Full evaluation (FULL/PROG_ONLY_COHORT): scores are stored by world position, row pID and
+/// column tID; bind every program to its row and every test to its column.
+void ProgramSynthesisExperiment::BindFullEvaluationPhenotypes() {
+  prog_test_scores.Resize(PROG_POP_SIZE, TEST_POP_SIZE);
+  prog_test_passes.Resize(PROG_POP_SIZE, TEST_POP_SIZE);
+  for (size_t tID = 0; tID < TEST_POP_SIZE; ++tID) {
+    GetTestPhenotype(tID).Reset(prog_test_scores.GetColumn(tID), prog_test_passes.GetColumn(tID));
+  }
+  for (size_t pID = 0; pID < PROG_POP_SIZE; ++pID) {
+    prog_world->GetOrg(pID).GetPhenotype().Reset(prog_test_scores.GetRow(pID), prog_test_passes.GetRow(pID));
+  }
+}
+
+/// Clean offspring (unmutated copies of their parent) get their parent's totals and scores (copied
+/// from the previous generation's row), and their parent's results are recorded in test
+/// phenotypes. Returns false if prog_org must be evaluated.
+bool ProgramSynthesisExperiment::ReuseParentPhenotype(prog_org_t & prog_org, size_t pID) {
+  const size_t parentID = prog_org.GetParentPos();
+  if (prog_org.IsDirty() || parentID >= prev_prog_phenotypes.size()) return false;
+  prog_org_phen_t & prog_phen = prog_org.GetPhenotype();
+  prog_phen = prev_prog_phenotypes[parentID];
+  prog_phen.test_scores = prog_test_scores.GetRow(pID);
+  prog_phen.test_passes = prog_test_passes.GetRow(pID);
+  for (size_t tID = 0; tID < prog_test_scores.GetNumCols(); ++tID) {
+    const double score = prev_prog_test_scores(parentID, tID);
+    const uint8_t pass = prev_prog_test_passes(parentID, tID);
+    prog_test_scores(pID, tID) = score;
+    prog_test_passes(pID, tID) = pass;
+    test_org_phen_t & test_phen = GetTestPhenotype(tID);
+    test_phen.RecordScore(score);
+    test_phen.RecordPass(pass);
+  }
+  return true;
+}
+
+/// Keep totals, and swap score matrices with the previous generation's: this generation's
+/// phenotypes still view their scores (now in the prev_ matrices) until the next evaluation, which
+/// writes into the other pair (resized then if needed).
+void ProgramSynthesisExperiment::SaveProgramPhenotypes() {
+  prev_prog_phenotypes.resize(prog_world->GetSize());
+  for (size_t pID = 0; pID < prog_world->GetSize(); ++pID) {
+    prev_prog_phenotypes[pID] = prog_world->GetOrg(pID).GetPhenotype();
+  }
+  std::swap(prog_test_scores, prev_prog_test_scores);
+  std::swap(prog_test_passes, prev_prog_test_passes);
+}
+
 /// Setup selection for programs and tests.
 void ProgramSynthesisExperiment::SetupSelection() {
   // (1) Setup program selection.
   SetupProgramSelection();
   // (2) Setup test selection.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::COEVOLUTION || TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO) {
-    std::cout << "COEVOLUTION training example mode detected, setting up test case selection." << std::endl;
+    ExpLog() << "COEVOLUTION training example mode detected, setting up test case selection." << std::endl;
     if (prob_NumberIO_world != nullptr) { SetupTestSelection(prob_NumberIO_world, prob_utils_NumberIO.lexicase_fit_set); }
     else if (prob_SmallOrLarge_world != nullptr) { SetupTestSelection(prob_SmallOrLarge_world, prob_utils_SmallOrLarge.lexicase_fit_set); }
     else if (prob_ForLoopIndex_world != nullptr) { SetupTestSelection(prob_ForLoopIndex_world, prob_utils_ForLoopIndex.lexicase_fit_set); }
@@ -1847,7 +2802,7 @@ void ProgramSynthesisExperiment::SetupSelection() {
     else if (prob_Median_world != nullptr) { SetupTestSelection(prob_Median_world, prob_utils_Median.lexicase_fit_set); }
     else if (prob_Smallest_world != nullptr) { SetupTestSelection(prob_Smallest_world, prob_utils_Smallest.lexicase_fit_set); }
     else if (prob_Syllables_world != nullptr) { SetupTestSelection(prob_Syllables_world, prob_utils_Syllables.lexicase_fit_set); }
-    else { std::cout << "AHH! More than one test case world has been created. Exiting." << std::endl; exit(-1); }
+    else { ExpLog() << "AHH! More than one test case world has been created. Exiting." << std::endl; exit(-1); }
   }
 }
 
@@ -1855,7 +2810,7 @@ void ProgramSynthesisExperiment::SetupSelection() {
 void ProgramSynthesisExperiment::SetupProgramSelection() {
   switch (PROG_SELECTION_MODE) {
     case (size_t)SELECTION_TYPE::LEXICASE: {
-      std::cout << "Setting up program LEXICASE selection." << std::endl;
+      ExpLog() << "Setting up program LEXICASE selection." << std::endl;
       // Lexicase selection requires full evaluation mode?
       emp_assert(EVALUATION_MODE == (size_t)EVALUATION_TYPE::FULL, "Lexicase selection requires FULL evaluation mode.");
       // Setup program fitness functions.
@@ -1875,16 +2830,32 @@ void ProgramSynthesisExperiment::SetupProgramSelection() {
         return 0.0;
       });
       // Add selection action
-      do_selection_sig.AddAction([this]() {
-        emp::LexicaseSelect_NAIVE(*prog_world,
-                                  lexicase_prog_fit_set,
-                                  PROG_POP_SIZE,
-                                  PROG_LEXICASE_MAX_FUNS); // TODO - track lexicase fit fun stats
-      });
+      if (PROG_LEXICASE_CASE_ORDER == (size_t)TestDifficultyIndex::CASE_ORDER_MODE::UNIFORM) {
+        do_selection_sig.AddAction([this]() {
+          emp::LexicaseSelect_NAIVE(*prog_world,
+                                    lexicase_prog_fit_set,
+                                    PROG_POP_SIZE,
+                                    PROG_LEXICASE_MAX_FUNS); // TODO - track lexicase fit fun stats
+        });
+      } else {
+        ExpLog() << "  Biasing lexicase case ordering by test case difficulty index (mode = " << PROG_LEXICASE_CASE_ORDER << ")." << std::endl;
+        do_selection_sig.AddAction([this]() {
+          emp::vector<double> case_weights(training_difficulty.GetCaseWeights(PROG_LEXICASE_CASE_ORDER));
+          // Small-size pressure function gets the average case weight.
+          case_weights.emplace_back(emp::Mean(case_weights));
+          emp::LexicaseSelect_NAIVE(*prog_world,
+                                    lexicase_prog_fit_set,
+                                    PROG_POP_SIZE,
+                                    PROG_LEXICASE_MAX_FUNS,
+                                    [](size_t){ ; },
+                                    [](size_t){ ; },
+                                    case_weights);
+        });
+      }
       break;
     }
     case (size_t)SELECTION_TYPE::COHORT_LEXICASE: {
-      std::cout << "Setting up program COHORT LEXICASE selection." << std::endl;
+      ExpLog() << "Setting up program COHORT LEXICASE selection." << std::endl;
       emp_assert(EVALUATION_MODE == (size_t)EVALUATION_TYPE::COHORT, "Cohort lexicase selection requires COHORT evaluation mode.");
       emp_assert(PROG_COHORT_SIZE * prog_cohorts.GetCohortCnt() == PROG_POP_SIZE);
 
@@ -1917,7 +2888,7 @@ void ProgramSynthesisExperiment::SetupProgramSelection() {
       break;
     }
     case (size_t)SELECTION_TYPE::PROG_ONLY_COHORT_LEXICASE: {
-      std::cout << "Setting up program PROGRAM ONLY COHORT LEXICASE selection." << std::endl;
+      ExpLog() << "Setting up program PROGRAM ONLY COHORT LEXICASE selection." << std::endl;
       emp_assert(EVALUATION_MODE == (size_t)EVALUATION_TYPE::PROG_ONLY_COHORT, "Program only Cohort lexicase selection requires program only COHORT evaluation mode.");
       emp_assert(PROG_COHORT_SIZE * prog_cohorts.GetCohortCnt() == PROG_POP_SIZE);
 
@@ -1951,7 +2922,7 @@ void ProgramSynthesisExperiment::SetupProgramSelection() {
       break;
     }
     case (size_t)SELECTION_TYPE::TEST_DOWNSAMPLING_LEXICASE: {
-      std::cout << "Setting up program selection - TEST_DOWNSAMPLING_LEXICASE experiment." << std::endl;
+      ExpLog() << "Setting up program selection - TEST_DOWNSAMPLING_LEXICASE experiment." << std::endl;
       emp_assert(EVALUATION_MODE == (size_t)EVALUATION_TYPE::TEST_DOWNSAMPLING, "Program only Cohort lexicase selection requires program only COHORT evaluation mode.");
 
       // Setup program fitness functions.
@@ -1980,21 +2951,21 @@ void ProgramSynthesisExperiment::SetupProgramSelection() {
       break;
     }
     case (size_t)SELECTION_TYPE::TOURNAMENT: {
-      std::cout << "Setting up program TOURNAMENT selection." << std::endl;
+      ExpLog() << "Setting up program TOURNAMENT selection." << std::endl;
       do_selection_sig.AddAction([this]() {
         emp::TournamentSelect(*prog_world, PROG_TOURNAMENT_SIZE, PROG_POP_SIZE);
       });
       break;
     }
     case (size_t)SELECTION_TYPE::DRIFT: {
-      std::cout << "Setting up program DRIFT selection." << std::endl;
+      ExpLog() << "Setting up program DRIFT selection." << std::endl;
       do_selection_sig.AddAction([this]() {
         emp::RandomSelect(*prog_world, PROG_POP_SIZE);
       });
       break;
     }
     default: {
-      std::cout << "Unknown PROG_SELECTION_MODE (" << PROG_SELECTION_MODE << "). Exiting." << std::endl;
+      ExpLog() << "Unknown PROG_SELECTION_MODE (" << PROG_SELECTION_MODE << "). Exiting." << std::endl;
       exit(-1);
     }
   }
@@ -2006,13 +2977,39 @@ void ProgramSynthesisExperiment::SetupMutation() {
   SetupProgramMutation();
   // (2) Setup test mutations
   SetupTestMutation();
-  // (3) Setup world(s) to auto mutate.
-  end_setup_sig.AddAction([this]() {
-    prog_world->SetAutoMutate();      // After we've initialized populations, turn auto mutate on.
-  });
+  // (3) Setup world(s) to auto mutate (or, for programs, to mutate offspring in a batch after selection).
+  switch (OFFSPRING_MUTATION_MODE) {
+    case (size_t)OFFSPRING_MUTATION_MODE_TYPE::AT_BIRTH: {
+      end_setup_sig.AddAction([this]() {
+        prog_world->SetAutoMutate();      // After we've initialized populations, turn auto mutate on.
+      });
+      break;
+    }
+    case (size_t)OFFSPRING_MUTATION_MODE_TYPE::BATCHED: {
+      ExpLog() << "Batched offspring mutation (" << REPRODUCTION_THREADS << " reproduction threads)." << std::endl;
+      reproduction_pool.Start(REPRODUCTION_THREADS);
+      prog_worker_mutators.assign(reproduction_pool.GetNumWorkers(), prog_mutator);
+      prog_offspring.Attach(*prog_world);
+      // Runs after selection (selection actions are added first): selected programs' offspring are
+      // buffered, mutated in parallel, then placed into the next population.
+      do_selection_sig.AddAction([this]() {
+        prog_offspring.Mutate(reproduction_pool, random->GetSeed(), update, [this](emp::Random & rnd, prog_org_gen_t & genome, size_t worker_id) {
+          return prog_worker_mutators[worker_id].Mutate(rnd, genome);
+        });
+        prog_offspring.Place([](prog_org_t & prog_org, size_t mut_cnt) {
+          if (mut_cnt) prog_org.MarkDirty();
+        });
+      });
+      break;
+    }
+    default: {
+      ExpLog() << "Unknown OFFSPRING_MUTATION_MODE (" << OFFSPRING_MUTATION_MODE << "). Exiting." << std::endl;
+      exit(-1);
+    }
+  }
 
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::COEVOLUTION) {
-    std::cout << "COEVOLUTION training mode detected. Setting test world to AUTO-MUTATE." << std::endl;
+    ExpLog() << "COEVOLUTION training mode detected. Setting test world to AUTO-MUTATE." << std::endl;
     if (prob_NumberIO_world != nullptr) { end_setup_sig.AddAction([this]() { prob_NumberIO_world->SetAutoMutate(); }); }
     else if (prob_SmallOrLarge_world != nullptr) { end_setup_sig.AddAction([this]() { prob_SmallOrLarge_world->SetAutoMutate(); }); }
     else if (prob_ForLoopIndex_world != nullptr) { end_setup_sig.AddAction([this]() { prob_ForLoopIndex_world->SetAutoMutate(); }); }
@@ -2041,9 +3038,9 @@ void ProgramSynthesisExperiment::SetupMutation() {
     else if (prob_Median_world != nullptr) { end_setup_sig.AddAction([this]() { prob_Median_world->SetAutoMutate(); }); }
     else if (prob_Smallest_world != nullptr) { end_setup_sig.AddAction([this]() { prob_Smallest_world->SetAutoMutate(); }); }
     else if (prob_Syllables_world != nullptr) { end_setup_sig.AddAction([this]() { prob_Syllables_world->SetAutoMutate(); }); }
-    else { std::cout << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
+    else { ExpLog() << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
   } else if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO) {
-    std::cout << "STATIC_COEVO training mode detected. Setting test world to AUTO-MUTATE (only if mut pos >= " << STATIC_COEVO__NUM_STATIC_TESTCASES << ")." << std::endl;
+    ExpLog() << "STATIC_COEVO training mode detected. Setting test world to AUTO-MUTATE (only if mut pos >= " << STATIC_COEVO__NUM_STATIC_TESTCASES << ")." << std::endl;
     // std::function<bool(size_t pos)> test_fun = [this](size_t p) { return p >= STATIC_COEVO__NUM_STATIC_TESTCASES; };
     if (prob_NumberIO_world != nullptr) { end_setup_sig.AddAction([this]() { prob_NumberIO_world->SetAutoMutate([this](size_t p) { return p >= STATIC_COEVO__NUM_STATIC_TESTCASES; }); }); }
     else if (prob_SmallOrLarge_world != nullptr) { end_setup_sig.AddAction([this]() { prob_SmallOrLarge_world->SetAutoMutate([this](size_t p) { return p >= STATIC_COEVO__NUM_STATIC_TESTCASES; }); }); }
@@ -2073,7 +3070,7 @@ void ProgramSynthesisExperiment::SetupMutation() {
     else if (prob_Median_world != nullptr) { end_setup_sig.AddAction([this]() { prob_Median_world->SetAutoMutate([this](size_t p) { return p >= STATIC_COEVO__NUM_STATIC_TESTCASES; }); }); }
     else if (prob_Smallest_world != nullptr) { end_setup_sig.AddAction([this]() { prob_Smallest_world->SetAutoMutate([this](size_t p) { return p >= STATIC_COEVO__NUM_STATIC_TESTCASES; }); }); }
     else if (prob_Syllables_world != nullptr) { end_setup_sig.AddAction([this]() { prob_Syllables_world->SetAutoMutate([this](size_t p) { return p >= STATIC_COEVO__NUM_STATIC_TESTCASES; }); }); }
-    else { std::cout << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
+    else { ExpLog() << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
   }
 }
 
@@ -2089,11 +3086,22 @@ void ProgramSynthesisExperiment::SetupProgramMutation() {
   prog_mutator.PER_PROG_SLIP = PROG_MUT__PER_PROG_SLIP;
   prog_mutator.PER_MOD_DUP = PROG_MUT__PER_MOD_DUP;
   prog_mutator.PER_MOD_DEL = PROG_MUT__PER_MOD_DEL;
+  prog_mutator.skip_sampling = MUTATION_SAMPLING_MODE == (size_t)MUTATION_SAMPLING_MODE_TYPE::SKIP_SAMPLING;
 
   // Configure world mutation function.
   prog_world->SetMutFun([this](prog_org_t & prog_org, emp::Random & rnd) {
-    return prog_mutator.Mutate(rnd, prog_org.GetGenome());
+    const size_t mut_cnt = prog_mutator.Mutate(rnd, prog_org.GetGenome());
+    if (mut_cnt) prog_org.MarkDirty();
+    return mut_cnt;
   });
+
+  // Offspring start out clean (i.e., can reuse their parent's phenotype). Auto-mutate is turned on
+  // at the end of setup, so this runs before offspring are mutated.
+  if (SPARSE_EVALUATION) {
+    prog_world->OnOffspringReady([](prog_org_t & prog_org, size_t parent_pos) {
+      prog_org.SetClone(parent_pos);
+    });
+  }
 }
 
 /// Setup fitness functions for tests/programs.
@@ -2106,18 +3114,20 @@ void ProgramSynthesisExperiment::SetupFitFuns() {
 
 /// Setup program fitness function.
 void ProgramSynthesisExperiment::SetupProgramFitFun() {
-  prog_world->SetFitFun([this](prog_org_t & prog_org) {
-    double fitness = prog_org.GetPhenotype().total_score;
-    if (prog_org.GetPhenotype().num_passes == PROGRAM_MAX_PASSES) { // Add 'smallness' bonus.
-      fitness += ((double)(MAX_PROG_SIZE - prog_org.GetGenome().GetSize()))/(double)MAX_PROG_SIZE;
-    }
-    return fitness;
-  });
+  prog_world->SetFitFun([this](prog_org_t & prog_org) { return CalcProgramFitness(prog_org); });
+}
+
+double ProgramSynthesisExperiment::CalcProgramFitness(const prog_org_t & prog_org) const {
+  double fitness = prog_org.GetPhenotype().total_score;
+  if (prog_org.GetPhenotype().num_passes == PROGRAM_MAX_PASSES) { // Add 'smallness' bonus.
+    fitness += ((double)(MAX_PROG_SIZE - prog_org.GetGenome().GetSize()))/(double)MAX_PROG_SIZE;
+  }
+  return fitness;
 }
 
 /// Setup data collection.
 void ProgramSynthesisExperiment::SetupDataCollection() {
-  std::cout << "Setting up data collection." << std::endl;
+  ExpLog() << "Setting up data collection." << std::endl;
   // Make a data directory
   mkdir(DATA_DIRECTORY.c_str(), ACCESSPERMS);
   if (DATA_DIRECTORY.back() != '/') DATA_DIRECTORY += '/';
@@ -2126,20 +3136,18 @@ void ProgramSynthesisExperiment::SetupDataCollection() {
   SetupProgramStats();
 
   std::function<size_t(void)> get_update = [this]() { return prog_world->GetUpdate(); };
-  std::function<double(void)> get_evaluations = [this]() {
-    if (EVALUATION_MODE == (size_t)EVALUATION_TYPE::COHORT) {
-      // update * cohort size * cohort size * num cohorts
-      return prog_world->GetUpdate() * PROG_COHORT_SIZE * TEST_COHORT_SIZE * NUM_COHORTS;
-    } else {
-      return prog_world->GetUpdate() * PROG_POP_SIZE * TEST_POP_SIZE;
-    }
-  };
+  std::function<double(void)> get_evaluations = [this]() { return CalcEvaluations(prog_world->GetUpdate()); };
 
   // Setup program systematics
-  prog_genotypic_systematics = emp::NewPtr<emp::Systematics<prog_org_t, prog_org_gen_t>>([](const prog_org_t & o) { return o.GetGenome(); });
-  prog_genotypic_systematics->AddEvolutionaryDistinctivenessDataNode();
-  prog_genotypic_systematics->AddPairwiseDistanceDataNode();
-  prog_genotypic_systematics->AddPhylogeneticDiversityDataNode();
+  // - Compact mode: taxa store genome hashes + diffs (compacted whenever prog_gen_sys.csv is written, or sooner to hold the memory cap; see
+  //   CompactSystematics.h), and phylogeny metrics are only calculated when prog_gen_sys.csv is written.
+  const bool compact_systematics = SYSTEMATICS_MODE == (size_t)SYSTEMATICS_MODE_TYPE::COMPACT_SYSTEMATICS;
+  prog_genotypic_systematics = emp::NewPtr<prog_systematics_t>([](const prog_org_t & o) { return prog_sys_info_t(o.GetGenome()); });
+  if (!compact_systematics) {
+    prog_genotypic_systematics->AddEvolutionaryDistinctivenessDataNode();
+    prog_genotypic_systematics->AddPairwiseDistanceDataNode();
+    prog_genotypic_systematics->AddPhylogeneticDiversityDataNode();
+  }
   prog_world->AddSystematics(prog_genotypic_systematics, "prog_genotype");
   auto & prog_gen_sys_file = prog_world->SetupSystematicsFile("prog_genotype", DATA_DIRECTORY + "/prog_gen_sys.csv", false);
   prog_gen_sys_file.SetTimingRepeat(SUMMARY_STATS_INTERVAL);
@@ -2152,10 +3160,19 @@ void ProgramSynthesisExperiment::SetupDataCollection() {
   // - CalcDiversity (entropy of taxa in population)
   // Functions to add:
   prog_gen_sys_file.template AddFun<size_t>([this]() { return mrca_changes; }, "mrca_changes", "MRCA changes");
-  prog_gen_sys_file.AddStats(*prog_genotypic_systematics->GetDataNode("evolutionary_distinctiveness") , "evolutionary_distinctiveness", "evolutionary distinctiveness for a single update", true, true);
-  prog_gen_sys_file.AddStats(*prog_genotypic_systematics->GetDataNode("pairwise_distances"), "pairwise_distance", "pairwise distance for a single update", true, true);
-  // - GetPhylogeneticDiversity
-  prog_gen_sys_file.AddCurrent(*prog_genotypic_systematics->GetDataNode("phylogenetic_diversity"), "current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
+  if (compact_systematics) {
+    prog_sys_compactor.Configure(SYSTEMATICS_KEYFRAME_INTERVAL, SYSTEMATICS_MAX_MB * 1024 * 1024);
+    prog_gen_sys_file.AddPreFun([this]() { prog_sys_compactor.Compact(*prog_genotypic_systematics); });
+    // Hold the memory cap between file writes (after the program world update adds new taxa).
+    do_update_sig.AddAction([this]() { prog_sys_compactor.Enforce(*prog_genotypic_systematics); });
+    AddCompactSystematicsMetrics(prog_gen_sys_file, prog_genotypic_systematics, [this]() { return prog_world->GetUpdate(); });
+    AddCompactSystematicsStats(prog_gen_sys_file, prog_sys_compactor);
+  } else {
+    prog_gen_sys_file.AddStats(*prog_genotypic_systematics->GetDataNode("evolutionary_distinctiveness") , "evolutionary_distinctiveness", "evolutionary distinctiveness for a single update", true, true);
+    prog_gen_sys_file.AddStats(*prog_genotypic_systematics->GetDataNode("pairwise_distances"), "pairwise_distance", "pairwise distance for a single update", true, true);
+    // - GetPhylogeneticDiversity
+    prog_gen_sys_file.AddCurrent(*prog_genotypic_systematics->GetDataNode("phylogenetic_diversity"), "current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
+  }
   // - GetTreeSize
   prog_gen_sys_file.template AddFun<size_t>([this]() { return prog_genotypic_systematics->GetTreeSize(); }, "tree_size", "Phylogenetic tree size");
   // - NumSparseTaxa
@@ -2170,11 +3187,14 @@ void ProgramSynthesisExperiment::SetupDataCollection() {
   prog_gen_sys_file.AddFun(get_evaluations, "evaluations");
 
   prog_gen_sys_file.PrintHeaderKeys();
+  data_files.Add(prog_gen_sys_file, DATA_DIRECTORY + "/prog_gen_sys.csv");
 
   // Add function(s) to program systematics snapshot
+  // - Taxa whose genome was dropped (compact mode memory cap) get an empty program.
   prog_genotypic_systematics->AddSnapshotFun([](const prog_taxon_t & t) {
+    if (!t.GetInfo().HasGenome()) return std::string("\"\"");
     std::ostringstream stream;
-    t.GetInfo().PrintCSVEntry(stream);
+    t.GetInfo().WithGenome([&stream](const prog_org_gen_t & prog) { prog.PrintCSVEntry(stream); });
     return stream.str();
   }, "program", "Program");
 
@@ -2187,6 +3207,12 @@ void ProgramSynthesisExperiment::SetupDataCollection() {
     }
   });
 
+#ifdef EXP_INSTRUMENT
+  // Setup timing file (phase timing + counters; see Instrumentation.h).
+  timing_file = emp::NewPtr<InstrumentationFile>(DATA_DIRECTORY + "/timing.csv", SUMMARY_STATS_INTERVAL);
+  data_files.Add(*timing_file);
+#endif
+
   // Setup prog_phen_diversity_file --> Gets updated during a snapshot, so we can assume that 
   prog_phen_diversity_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/prog_phenotype_diversity.csv");
   prog_phen_diversity_file->AddFun(get_update, "update");
@@ -2196,54 +3222,109 @@ void ProgramSynthesisExperiment::SetupDataCollection() {
   // - unique behavioral phenotypes
   prog_phen_diversity_file->AddFun(program_stats.get_prog_unique_behavioral_phenotypes, "unique_behavioral_phenotypes", "Unique behavioral profiles in program population");
   prog_phen_diversity_file->PrintHeaderKeys();
+  data_files.Add(*prog_phen_diversity_file, DATA_DIRECTORY + "/prog_phenotype_diversity.csv");
+
+  // Setup solution screening. Each worker runs candidates (the genome captured at submission) on
+  // its own copy of the instruction library and its own hardware (see ScreenerEvalState), a batch
+  // (every queued candidate) at a time.
+  // Confirmed solutions are acted on at the start of an update (see WriteScreenedSolutions).
+  prog_sol_screener.ConfigureBatched(SOLUTION_SCREEN_THREADS, SOLUTION_SCREEN_QUEUE_SIZE, SOLUTION_SCREEN_CACHE_SIZE, [this]() {
+    std::shared_ptr<ScreenerEvalState> state = std::make_shared<ScreenerEvalState>(*inst_lib);
+    ConfigureHardware(state->hardware);
+    return [this, state](const emp::vector<ProgSolutionCandidate> & candidates) {
+      emp::vector<prog_org_t> prog_orgs;
+      prog_orgs.reserve(candidates.size());
+      for (const ProgSolutionCandidate & candidate : candidates) {
+        prog_orgs.emplace_back(prog_org_gen_t(&state->inst_lib, candidate.genome.GetInstSeq()));
+      }
+      emp::vector<emp::Ptr<prog_org_t>> progs;
+      for (prog_org_t & prog_org : prog_orgs) progs.emplace_back(&prog_org);
+      ThreadScreenerEvalState() = state.get();
+      emp::vector<bool> solutions;
+      if (ScreenForSolutions) {
+        solutions = ScreenForSolutions(progs);
+      } else {
+        for (emp::Ptr<prog_org_t> prog : progs) solutions.emplace_back(ScreenForSolution(*prog));
+      }
+      ThreadScreenerEvalState() = nullptr;
+      return solutions;
+    };
+  });
+  // Solution files describe cur_solution (as it was when first seen).
+  std::function<size_t(void)> get_sol_update = [this]() { return cur_solution->update; };
+  std::function<double(void)> get_sol_evaluations = [this]() { return CalcEvaluations(cur_solution->update); };
+  std::function<size_t(void)> get_sol_id = [this]() { return cur_solution->progID; };
+  std::function<size_t(void)> get_sol_len = [this]() { return cur_solution->genome.GetSize(); };
+  std::function<std::string(void)> get_sol_program = [this]() {
+    std::ostringstream stream;
+    cur_solution->genome.PrintCSVEntry(stream);
+    return stream.str();
+  };
 
   // Setup solution file.
-  solution_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/solutions.csv");
-
-  solution_file->AddFun(get_update, "update");
-  solution_file->AddFun(get_evaluations, "evaluations");
-  solution_file->AddFun(program_stats.get_id, "program_id");
-  solution_file->AddFun(program_stats.get_program_len, "program_len");
-  solution_file->AddFun(program_stats.get_program, "program");
-  solution_file->PrintHeaderKeys();
+  if (OUTPUT_FORMAT == OUTPUT_FORMAT_TYPE::COLUMNAR_OUTPUT) {
+    solution_col_file = emp::NewPtr<ColumnarWriter>(DATA_DIRECTORY + "/solutions.col", 1);
+    solution_col_file->AddFun(get_sol_update, "update");
+    solution_col_file->AddFun(get_sol_evaluations, "evaluations");
+    solution_col_file->AddFun(get_sol_id, "program_id");
+    solution_col_file->AddFun(get_sol_len, "program_len");
+    solution_col_file->AddProgram([this]() {
+      return MakeColumnarProgram(cur_solution->genome);
+    }, "program", GetInstNames(), TAG_WIDTH);
+    solution_col_file->PrintHeaderKeys();
+    data_files.Add(*solution_col_file);
+  } else {
+    solution_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/solutions.csv");
+    solution_file->AddFun(get_sol_update, "update");
+    solution_file->AddFun(get_sol_evaluations, "evaluations");
+    solution_file->AddFun(get_sol_id, "program_id");
+    solution_file->AddFun(get_sol_len, "program_len");
+    solution_file->AddFun(get_sol_program, "program");
+    solution_file->PrintHeaderKeys();
+    data_files.Add(*solution_file, DATA_DIRECTORY + "/solutions.csv");
+  }
 
+  snapshot_writer.SetCapacity(SNAPSHOT_QUEUE_SIZE);
   do_pop_snapshot_sig.AddAction([this]() {
     SnapshotPrograms();
     SnapshotTests();
   });
 
-  // Setup program/problem[X] fitness file.
-  prog_world->SetupFitnessFile(DATA_DIRECTORY + "program_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL);
-  // Setup test world fitness file (just don't look...)
-  if (prob_NumberIO_world != nullptr) { prob_NumberIO_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_SmallOrLarge_world != nullptr) { prob_SmallOrLarge_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_ForLoopIndex_world != nullptr) { prob_ForLoopIndex_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_CompareStringLengths_world != nullptr) { prob_CompareStringLengths_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_DoubleLetters_world != nullptr) { prob_DoubleLetters_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_CollatzNumbers_world != nullptr) { prob_CollatzNumbers_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_ReplaceSpaceWithNewline_world != nullptr) { prob_ReplaceSpaceWithNewline_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_StringDifferences_world != nullptr) { prob_StringDifferences_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_EvenSquares_world != nullptr) { prob_EvenSquares_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_WallisPi_world != nullptr) { prob_WallisPi_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_StringLengthsBackwards_world != nullptr) { prob_StringLengthsBackwards_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_LastIndexOfZero_world != nullptr) { prob_LastIndexOfZero_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_VectorAverage_world != nullptr) { prob_VectorAverage_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_CountOdds_world != nullptr) { prob_CountOdds_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_MirrorImage_world != nullptr) { prob_MirrorImage_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_SuperAnagrams_world != nullptr) { prob_SuperAnagrams_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_SumOfSquares_world != nullptr) { prob_SumOfSquares_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_VectorsSummed_world != nullptr) { prob_VectorsSummed_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_XWordLines_world != nullptr) { prob_XWordLines_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_PigLatin_world != nullptr) { prob_PigLatin_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_NegativeToZero_world != nullptr) { prob_NegativeToZero_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_ScrabbleScore_world != nullptr) { prob_ScrabbleScore_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_Checksum_world != nullptr) { prob_Checksum_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_Digits_world != nullptr) { prob_Digits_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_Grade_world != nullptr) { prob_Grade_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_Median_world != nullptr) { prob_Median_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_Smallest_world != nullptr) { prob_Smallest_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else if (prob_Syllables_world != nullptr) { prob_Syllables_world->SetupFitnessFile(DATA_DIRECTORY + "test_fitness.csv").SetTimingRepeat(SUMMARY_STATS_INTERVAL); }
-  else { std::cout << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
+  // Setup program/test fitness files and population stats file (from population stats gathered
+  // after evaluation; see GatherPopulationStats).
+  auto add_fitness_columns = [this, &get_update](emp::DataFile & file, const PopulationStats & stats) {
+    file.AddFun(get_update, "update", "Update");
+    file.AddFun<double>([&stats]() { return stats.Get(FITNESS_STAT).mean; }, "mean_fitness", "Average organism fitness in current population.");
+    file.AddFun<double>([&stats]() { return stats.Get(FITNESS_STAT).min; }, "min_fitness", "Minimum organism fitness in current population.");
+    file.AddFun<double>([&stats]() { return stats.Get(FITNESS_STAT).max; }, "max_fitness", "Maximum organism fitness in current population.");
+    file.AddFun<double>([&stats]() { return stats.Get(FITNESS_STAT).GetInferiority(); }, "inferiority", "Average fitness / maximum fitness in current population.");
+    file.SetTimingRepeat(SUMMARY_STATS_INTERVAL);
+    file.PrintHeaderKeys();
+  };
+  prog_fitness_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "program_fitness.csv");
+  add_fitness_columns(*prog_fitness_file, prog_pop_stats);
+  data_files.Add(*prog_fitness_file, DATA_DIRECTORY + "program_fitness.csv");
+  test_fitness_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "test_fitness.csv");
+  add_fitness_columns(*test_fitness_file, test_pop_stats);
+  data_files.Add(*test_fitness_file, DATA_DIRECTORY + "test_fitness.csv");
+
+  pop_stats_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/pop_stats.csv");
+  pop_stats_file->AddFun(get_update, "update");
+  pop_stats_file->AddFun(get_evaluations, "evaluations");
+  auto add_stat_columns = [this](const PopulationStats & stats, size_t col, const std::string & name) {
+    pop_stats_file->AddFun<double>([&stats, col]() { return stats.Get(col).min; }, "min_" + name);
+    pop_stats_file->AddFun<double>([&stats, col]() { return stats.Get(col).mean; }, "mean_" + name);
+    pop_stats_file->AddFun<double>([&stats, col]() { return stats.Get(col).max; }, "max_" + name);
+    pop_stats_file->AddFun<double>([&stats, col]() { return stats.Get(col).variance; }, "var_" + name);
+  };
+  add_stat_columns(prog_pop_stats, FITNESS_STAT, "prog_fitness");
+  add_stat_columns(prog_pop_stats, PASSES_STAT, "prog_passes");
+  add_stat_columns(prog_pop_stats, SIZE_STAT, "prog_size");
+  add_stat_columns(test_pop_stats, FITNESS_STAT, "test_fitness");
+  add_stat_columns(test_pop_stats, PASSES_STAT, "test_passes");
+  pop_stats_file->SetTimingRepeat(SUMMARY_STATS_INTERVAL);
+  pop_stats_file->PrintHeaderKeys();
+  data_files.Add(*pop_stats_file, DATA_DIRECTORY + "/pop_stats.csv");
 
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::COEVOLUTION || TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::STATIC_COEVO) {
     // Setup test world systematics
@@ -2275,7 +3356,7 @@ void ProgramSynthesisExperiment::SetupDataCollection() {
     else if (prob_Median_world != nullptr) { SetupTestSystematics(prob_Median_world, [this](std::ostream & out, const prob_Median_world_t::genome_t & genome) { prob_utils_Median.PrintTestCSV(out, genome); } ); }
     else if (prob_Smallest_world != nullptr) { SetupTestSystematics(prob_Smallest_world, [this](std::ostream & out, const prob_Smallest_world_t::genome_t & genome) { prob_utils_Smallest.PrintTestCSV(out, genome); } ); }
     // else if (prob_Syllables_world != nullptr) { SetupTestSystematics(prob_Syllables_world); }
-    else { std::cout << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
+    else { ExpLog() << "AHH! None of the worlds have been initialized. Exiting." << std::endl; exit(-1); }
 
   }
 
@@ -2322,7 +3403,7 @@ void ProgramSynthesisExperiment::SetupProgramStats() {
 
   // program_stats.get_validation_eval__num_tests
   program_stats.get_validation_eval__num_tests = [this]() {
-    return stats_util.current_program__validation__test_results.size();
+    return validation_num_tests;
   };
 
   // program_stats.get_validation_eval__passes_by_test
@@ -2349,48 +3430,184 @@ void ProgramSynthesisExperiment::SetupProgramStats() {
   };
 }
 
+emp::vector<std::string> ProgramSynthesisExperiment::GetInstNames() const {
+  emp::vector<std::string> names;
+  for (size_t i = 0; i < inst_lib->GetSize(); ++i) names.emplace_back(inst_lib->GetName(i));
+  return names;
+}
+
 /// Take a snapshot of the program population.
+/// - Validation (which runs programs) happens here; the snapshot writer formats and writes the
+///   captured population image in the background.
+/// - With sampled validation (VALIDATION_MODE), validation results are for a new stratified sample
+///   of the testing set (written to validation_sample_<update>.csv), and snapshots also include
+///   estimated testing set pass rates (with 95% confidence intervals).
 void ProgramSynthesisExperiment::SnapshotPrograms() {
-  std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-  mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-
-  emp::DataFile file(snapshot_dir + "/program_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-
-  // Add functions to data file.
-  file.AddFun(program_stats.get_id, "program_id", "Program ID");
-  
-  file.AddFun(program_stats.get_fitness, "fitness");
-  file.AddFun(program_stats.get_fitness_eval__total_score, "total_score__fitness_eval");
-  file.AddFun(program_stats.get_fitness_eval__num_passes, "num_passes__fitness_eval");
-  file.AddFun(program_stats.get_fitness_eval__num_fails, "num_fails__fitness_eval");
-  file.AddFun(program_stats.get_fitness_eval__num_tests, "num_tests__fitness_eval");
-  file.AddFun(program_stats.get_fitness_eval__passes_by_test, "passes_by_test__fitness_eval");
-
-  file.AddFun(program_stats.get_validation_eval__num_passes, "num_passes__validation_eval");
-  file.AddFun(program_stats.get_validation_eval__num_tests, "num_tests__validation_eval");
-  file.AddFun(program_stats.get_validation_eval__passes_by_test, "passes_by_test__validation_eval");
-
-  file.AddFun(program_stats.get_program_len, "program_len");
-  file.AddFun(program_stats.get_program, "program");
-
-  file.PrintHeaderKeys();
+  struct ProgramImage {
+    size_t id;
+    double fitness;
+    prog_org_t org;
+    emp::vector<uint8_t> test_passes;      ///< Copied out of the pass matrix (overwritten next evaluation).
+    emp::vector<bool> validation_passes;   ///< By test case.
+    size_t validation_num_passes;
+    size_t validation_num_tests;
+    ValidationSample::Estimate validation_estimate;
+  };
+  const size_t snapshot_update = prog_world->GetUpdate();
+  const std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(snapshot_update);
+  auto image = std::make_shared<emp::vector<ProgramImage>>();
+  image->reserve(prog_world->GetSize());
+
+  // New validation round (invalidates cached validation results; see SetupValidation).
+  ++validation_round;
+  const bool sampled = VALIDATION_MODE == (size_t)VALIDATION_MODE_TYPE::SAMPLED_VALIDATION;
+  if (sampled) {
+    // Sample with a dedicated generator so that sampling doesn't perturb evolution.
+    emp::Random sample_rnd(std::max(1, random->GetSeed() + (int)snapshot_update));
+    validation_sample.Draw(sample_rnd, validation_difficulty.GetSize(), VALIDATION_SAMPLE_SIZE, VALIDATION_SAMPLE_STRATA);
+  }
 
-  // For each program in the population, dump the program and anything we want to know about it.
+  // For each program in the population, capture the program and anything we want to know about it.
+  validation_num_tests = validation_sample.GetSize();
+  if (BeginTestingSetValidation) BeginTestingSetValidation();
   for (stats_util.cur_progID = 0; stats_util.cur_progID < prog_world->GetSize(); ++stats_util.cur_progID) {
     if (!prog_world->IsOccupied(stats_util.cur_progID)) continue;
-    DoTestingSetValidation(prog_world->GetOrg(stats_util.cur_progID)); // Do validation for program.
-    // Update snapshot file
-    file.Update();
+    prog_org_t & prog = prog_world->GetOrg(stats_util.cur_progID);
+    DoTestingSetValidation(prog); // Do validation for program.
+    image->emplace_back(ProgramImage{stats_util.cur_progID, prog_world->CalcFitnessID(stats_util.cur_progID), prog,
+                                     prog.GetPhenotype().test_passes.ToVector(), emp::vector<bool>(), stats_util.current_program__validation__total_passes,
+                                     validation_num_tests, ValidationSample::Estimate{0.0, 0.0, 0.0}});
+    for (const TestResult & result : stats_util.current_program__validation__test_results) {
+      image->back().validation_passes.emplace_back(result.pass);
+    }
+    if (sampled) image->back().validation_estimate = validation_sample.GetEstimate(image->back().validation_passes);
   }
+  validation_difficulty.Update();
   // Take diversity snapshot
   prog_phen_diversity_file->Update();
+
+  const bool columnar = OUTPUT_FORMAT == OUTPUT_FORMAT_TYPE::COLUMNAR_OUTPUT;
+  const emp::vector<std::string> inst_names(columnar ? GetInstNames() : emp::vector<std::string>());
+  const emp::vector<size_t> sample_ids(sampled ? validation_sample.GetTestIDs() : emp::vector<size_t>());
+  snapshot_writer.Submit([image, snapshot_dir, snapshot_update, columnar, inst_names, sampled, sample_ids]() {
+    SnapshotWriter::MakeDir(snapshot_dir);
+    if (sampled) {
+      std::ofstream sample_file(snapshot_dir + "/validation_sample_" + emp::to_string((int)snapshot_update) + ".csv");
+      sample_file << "test_id\n";
+      for (size_t id : sample_ids) sample_file << id << "\n";
+    }
+    const std::string fpath = snapshot_dir + "/program_pop_" + emp::to_string((int)snapshot_update);
+    if (columnar) {
+      ColumnarWriter file(fpath + ".col");
+      ProgramImage * row = nullptr;
+      file.AddUInt([&row]() { return row->id; }, "program_id");
+      file.AddDouble([&row]() { return row->fitness; }, "fitness");
+      file.AddDouble([&row]() { return row->org.GetPhenotype().total_score; }, "total_score__fitness_eval");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_passes; }, "num_passes__fitness_eval");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_fails; }, "num_fails__fitness_eval");
+      file.AddUInt([&row]() { return row->test_passes.size(); }, "num_tests__fitness_eval");
+      file.AddUIntList([&row]() { return MakeColumnarList(row->test_passes); }, "passes_by_test__fitness_eval");
+      file.AddUInt([&row]() { return row->validation_num_passes; }, "num_passes__validation_eval");
+      file.AddUInt([&row]() { return row->validation_num_tests; }, "num_tests__validation_eval");
+      file.AddUIntList([&row]() { return MakeColumnarList(row->validation_passes); }, "passes_by_test__validation_eval");
+      if (sampled) {
+        file.AddDouble([&row]() { return row->validation_estimate.pass_rate; }, "est_pass_rate__validation_eval");
+        file.AddDouble([&row]() { return row->validation_estimate.ci_low; }, "est_pass_rate_ci_low__validation_eval");
+        file.AddDouble([&row]() { return row->validation_estimate.ci_high; }, "est_pass_rate_ci_high__validation_eval");
+      }
+      file.AddUInt([&row]() { return row->org.GetGenome().GetSize(); }, "program_len");
+      file.AddProgram([&row]() { return MakeColumnarProgram(row->org.GetGenome()); }, "program", inst_names, TAG_WIDTH);
+      for (ProgramImage & cur : *image) { row = &cur; file.Update(); }
+      return;
+    }
+    std::ofstream file(fpath + ".csv");
+    file << "program_id,fitness,"
+         << "total_score__fitness_eval,num_passes__fitness_eval,num_fails__fitness_eval,num_tests__fitness_eval,passes_by_test__fitness_eval,"
+         << "num_passes__validation_eval,num_tests__validation_eval,passes_by_test__validation_eval,"
+         << (sampled ? "est_pass_rate__validation_eval,est_pass_rate_ci_low__validation_eval,est_pass_rate_ci_high__validation_eval," : "")
+         << "program_len,program\n";
+    for (ProgramImage & row : *image) {
+      const auto & phen = row.org.GetPhenotype();
+      file << row.id << "," << row.fitness << ","
+           << phen.total_score << "," << phen.num_passes << "," << phen.num_fails << "," << row.test_passes.size() << ",\"[";
+      for (size_t i = 0; i < row.test_passes.size(); ++i) file << (i ? "," : "") << (size_t)row.test_passes[i];
+      file << "]\"," << row.validation_num_passes << "," << row.validation_num_tests << ",\"[";
+      for (size_t i = 0; i < row.validation_passes.size(); ++i) file << (i ? "," : "") << (size_t)row.validation_passes[i];
+      file << "]\",";
+      if (sampled) {
+        file << row.validation_estimate.pass_rate << "," << row.validation_estimate.ci_low << "," << row.validation_estimate.ci_high << ",";
+      }
+      file << row.org.GetGenome().GetSize() << ",";
+      row.org.GetGenome().PrintCSVEntry(file);
+      file << "\n";
+    }
+  });
+
   // Snapshot phylogeny
-  prog_genotypic_systematics->Snapshot(snapshot_dir + "/program_phylogeny_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
+  // - Systematics are updated every generation, so this can't be deferred to the snapshot writer.
+  SnapshotWriter::MakeDir(snapshot_dir);
+  prog_genotypic_systematics->Snapshot(snapshot_dir + "/program_phylogeny_" + emp::to_string((int)snapshot_update) + ".csv");
+}
+
+/// Capture test orgs (genomes + phenotypes) and fitnesses; the snapshot writer formats and writes them.
+template<typename TEST_ORG_T>
+void ProgramSynthesisExperiment::SnapshotTestPop(emp::World<TEST_ORG_T> & world) {
+  struct TestImage {
+    size_t id;
+    double fitness;
+    TEST_ORG_T org;
+    emp::vector<uint8_t> test_passes;  ///< Copied out of the pass matrix (overwritten next evaluation).
+  };
+  const size_t snapshot_update = prog_world->GetUpdate();
+  const std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(snapshot_update);
+  auto image = std::make_shared<emp::vector<TestImage>>();
+  image->reserve(world.GetSize());
+  for (stats_util.cur_testID = 0; stats_util.cur_testID < world.GetSize(); ++stats_util.cur_testID) {
+    if (!world.IsOccupied(stats_util.cur_testID)) continue;
+    TEST_ORG_T & test = world.GetOrg(stats_util.cur_testID);
+    image->emplace_back(TestImage{stats_util.cur_testID, world.CalcFitnessID(stats_util.cur_testID), test, test.GetPhenotype().test_passes.ToVector()});
+  }
+
+  const bool columnar = OUTPUT_FORMAT == OUTPUT_FORMAT_TYPE::COLUMNAR_OUTPUT;
+  snapshot_writer.Submit([image, snapshot_dir, snapshot_update, columnar]() {
+    SnapshotWriter::MakeDir(snapshot_dir);
+    const std::string fpath = snapshot_dir + "/test_pop_" + emp::to_string((int)snapshot_update);
+    if (columnar) {
+      ColumnarWriter file(fpath + ".col");
+      TestImage * row = nullptr;
+      file.AddUInt([&row]() { return row->id; }, "test_id");
+      file.AddDouble([&row]() { return row->fitness; }, "fitness");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_passes; }, "num_passes");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_fails; }, "num_fails");
+      file.AddUInt([&row]() { return row->test_passes.size(); }, "num_programs_tested_against");
+      file.AddUIntList([&row]() { return MakeColumnarList(row->test_passes); }, "passes_by_program");
+      file.AddString([&row]() {
+        std::ostringstream stream;
+        stream << "\"";
+        row->org.Print(stream);
+        stream << "\"";
+        return stream.str();
+      }, "test");
+      for (TestImage & cur : *image) { row = &cur; file.Update(); }
+      return;
+    }
+    std::ofstream file(fpath + ".csv");
+    file << "test_id,fitness,num_passes,num_fails,num_programs_tested_against,passes_by_program,test\n";
+    for (TestImage & row : *image) {
+      test_org_phen_t & phen = row.org.GetPhenotype();
+      file << row.id << "," << row.fitness << "," << phen.num_passes << "," << phen.num_fails << ","
+           << row.test_passes.size() << ",\"[";
+      for (size_t i = 0; i < row.test_passes.size(); ++i) file << (i ? "," : "") << (size_t)row.test_passes[i];
+      file << "]\",\"";
+      row.org.Print(file);
+      file << "\"\n";
+    }
+  });
 }
 
 // ================= PROGRAM-RELATED FUNCTIONS ===========
 void ProgramSynthesisExperiment::InitProgPop_Random() {
-  std::cout << "Randomly initializing program population." << std::endl;
+  ExpLog() << "Randomly initializing program population." << std::endl;
   for (size_t i = 0; i < PROG_POP_SIZE; ++i) {
     prog_world->Inject(TagLGP::GenRandTagGPProgram(*random, inst_lib, MIN_PROG_SIZE, MAX_PROG_SIZE), 1);
   }
@@ -2517,7 +3734,7 @@ void ProgramSynthesisExperiment::AddDefaultInstructions(const std::unordered_set
 // ================= PROBLEM SETUPS ======================
 
 void ProgramSynthesisExperiment::SetupProblem_NumberIO() { 
-  std::cout << "NumberIO problem setup" << std::endl; 
+  ExpLog() << "NumberIO problem setup" << std::endl; 
 
   using test_org_t = TestOrg_NumberIO;
   
@@ -2526,11 +3743,12 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
   prob_utils_NumberIO.GetTrainingSet().LoadTestCases(training_examples_fpath);
-  prob_utils_NumberIO.GetTestingSet().LoadTestCases(testing_examples_fpath);
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_NumberIO.GetTestingSet().LoadTestCases(testing_examples_fpath);
   prob_utils_NumberIO.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_NumberIO.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_NumberIO.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_NumberIO.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_NumberIO.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_NumberIO.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_NumberIO.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_NumberIO.testingset_pop.size() << std::endl;
 
   // Setup world.
   NewTestCaseWorld(prob_NumberIO_world, *random, "NumberIO Test Case World");
@@ -2539,7 +3757,7 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
   SetupTestCasePop_Init(prob_NumberIO_world, 
                           prob_utils_NumberIO.training_set,
                           [this]() { return GenRandomTestInput_NumberIO(*random, {PROB_NUMBER_IO__INT_MIN, PROB_NUMBER_IO__INT_MAX}, {PROB_NUMBER_IO__DOUBLE_MIN, PROB_NUMBER_IO__DOUBLE_MAX}); } );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size = " << prob_NumberIO_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size = " << prob_NumberIO_world->GetSize() << std::endl; });
   
   // Tell world to calculate correct test output (given input) on placement.
   prob_NumberIO_world->OnPlacement([this](size_t pos) { prob_NumberIO_world->GetOrg(pos).CalcOut(); } );
@@ -2556,22 +3774,24 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) {
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_NumberIO.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_NumberIO.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_NumberIO.testingset_pop.size());
+    prob_utils_NumberIO.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_NumberIO.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_NumberIO.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_NumberIO.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_NumberIO.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_NumberIO.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_NumberIO).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_NumberIO.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -2579,25 +3799,11 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
   program_stats.get_prog_behavioral_diversity = [this]() { return emp::ShannonEntropy(prob_utils_NumberIO.population_validation_outputs); };
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_NumberIO.population_validation_outputs); };
 
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_NumberIO.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_NumberIO.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_NumberIO); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_NumberIO, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_NumberIO).submitted_val; });
+  SetupValidation(prob_utils_NumberIO);
 
   // Tell experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -2606,11 +3812,13 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
   };
 
   // Setup how test case world updates.  
-  SetupTestCaseWorldUpdate(prob_NumberIO_world);
+  SetupTestCaseWorldUpdate<test_org_t>(prob_NumberIO_world, [this](emp::vector<test_org_t::genome_t> & inputs) {
+    GenRandomTestInputs_NumberIO(*random, inputs, {PROB_NUMBER_IO__INT_MIN, PROB_NUMBER_IO__INT_MAX}, {PROB_NUMBER_IO__DOUBLE_MIN, PROB_NUMBER_IO__DOUBLE_MAX});
+  });
   
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_NumberIO.mutator.MIN_INT = PROB_NUMBER_IO__INT_MIN;
@@ -2625,7 +3833,7 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_NumberIO.mutator.MIN_INT = PROB_NUMBER_IO__INT_MIN;
@@ -2653,14 +3861,14 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
     // Reset eval stuff
     // Set current test org.
     // prob_utils_NumberIO.cur_eval_test_org = prob_NumberIO_world->GetOrgPtr(testID); // currently only place need testID for this?
-    prob_utils_NumberIO.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_NumberIO.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 2);
+    GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_NumberIO).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 2);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_NumberIO_input_t & input = prob_utils_NumberIO.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_NumberIO_input_t & input = GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input.first);
@@ -2673,13 +3881,13 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
     // std::cout << "Calc score on test!" << std::endl;
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_NumberIO.submitted) {
+    if (!GetEvalUtils(prob_utils_NumberIO).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
       double max_error = emp::Abs(PROB_NUMBER_IO__DOUBLE_MAX) * 2;
-      std::pair<double, bool> r(CalcScoreGradient_NumberIO(test_org.GetCorrectOut(), prob_utils_NumberIO.submitted_val, max_error));
+      std::pair<double, bool> r(CalcScoreGradient_NumberIO(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_NumberIO).submitted_val, max_error));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -2687,65 +3895,7 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
     return result;
   };
 
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_NumberIO_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_NumberIO_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_NumberIO_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_NumberIO_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-
-    //->Snapshot(snapshot_dir + "/test_phylogeny_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_NumberIO_world); };
   
   AddDefaultInstructions({"Add",
                           "Sub",
@@ -2811,7 +3961,7 @@ void ProgramSynthesisExperiment::SetupProblem_NumberIO() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() { 
-  std::cout << "Setup problem SmallOrLarge." << std::endl;
+  ExpLog() << "Setup problem SmallOrLarge." << std::endl;
 
   // A few useful aliases.
   using test_org_t = TestOrg_SmallOrLarge;
@@ -2827,11 +3977,12 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
   prob_utils_SmallOrLarge.GetTrainingSet().LoadTestCases(training_examples_fpath);
-  prob_utils_SmallOrLarge.GetTestingSet().LoadTestCases(testing_examples_fpath);
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_SmallOrLarge.GetTestingSet().LoadTestCases(testing_examples_fpath);
   prob_utils_SmallOrLarge.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_SmallOrLarge.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_SmallOrLarge.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_SmallOrLarge.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_SmallOrLarge.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_SmallOrLarge.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_SmallOrLarge.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_SmallOrLarge.testingset_pop.size() << std::endl;
 
   // Setup the world.
   NewTestCaseWorld(prob_SmallOrLarge_world, *random, "SmallOrLarge world");
@@ -2841,7 +3992,7 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
                         prob_utils_SmallOrLarge.training_set,
                         [this]() { return GenRandomTestInput_SmallOrLarge(*random, {PROB_SMALL_OR_LARGE__INT_MIN, PROB_SMALL_OR_LARGE__INT_MAX}); });
 
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_SmallOrLarge_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_SmallOrLarge_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_SmallOrLarge_world->OnPlacement([this](size_t pos) { prob_SmallOrLarge_world->GetOrg(pos).CalcOut(); });
@@ -2850,12 +4001,12 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_SmallOrLarge.submitted) {
+    if (!GetEvalUtils(prob_utils_SmallOrLarge).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_SmallOrLarge.CalcScorePassFail(test_org.GetCorrectOut(), prob_utils_SmallOrLarge.submitted_str));
+      std::pair<double, bool> r(prob_utils_SmallOrLarge.CalcScorePassFail(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_SmallOrLarge).submitted_str));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -2877,22 +4028,24 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_SmallOrLarge.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_SmallOrLarge.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_SmallOrLarge.testingset_pop.size());
+    prob_utils_SmallOrLarge.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_SmallOrLarge.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_SmallOrLarge.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_SmallOrLarge.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_SmallOrLarge.submitted_str;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_SmallOrLarge.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_SmallOrLarge).submitted_str;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_SmallOrLarge.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -2902,25 +4055,11 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_SmallOrLarge.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_SmallOrLarge.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_SmallOrLarge.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_SmallOrLarge); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_SmallOrLarge, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_SmallOrLarge).submitted_str; });
+  SetupValidation(prob_utils_SmallOrLarge);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -2929,11 +4068,13 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_SmallOrLarge_world);
+  SetupTestCaseWorldUpdate<test_org_t>(prob_SmallOrLarge_world, [this](emp::vector<test_org_t::genome_t> & inputs) {
+    GenRandomTestInputs_SmallOrLarge(*random, inputs, {PROB_SMALL_OR_LARGE__INT_MIN, PROB_SMALL_OR_LARGE__INT_MAX});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_SmallOrLarge.mutator.MIN_INT = PROB_SMALL_OR_LARGE__INT_MIN;
@@ -2945,7 +4086,7 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_SmallOrLarge.mutator.MIN_INT = PROB_SMALL_OR_LARGE__INT_MIN;
@@ -2969,14 +4110,14 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_SmallOrLarge.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_SmallOrLarge.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 1);
+    GetEvalUtils(prob_utils_SmallOrLarge).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_SmallOrLarge).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 1);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_SmallOrLarge_input_t & input = prob_utils_SmallOrLarge.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_SmallOrLarge_input_t & input = GetEvalUtils(prob_utils_SmallOrLarge).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -2984,62 +4125,7 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_SmallOrLarge_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_SmallOrLarge_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_SmallOrLarge_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_SmallOrLarge_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_SmallOrLarge_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -3111,7 +4197,7 @@ void ProgramSynthesisExperiment::SetupProblem_SmallOrLarge() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() { 
-  std::cout << "Setup problem - ForLoopIndex" << std::endl;
+  ExpLog() << "Setup problem - ForLoopIndex" << std::endl;
 
   // A few useful aliases.
   using test_org_t = TestOrg_ForLoopIndex;
@@ -3119,15 +4205,16 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_ForLoopIndex.GetTrainingSet().LoadTestCases(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_ForLoopIndex.GetTestingSet().LoadTestCases(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_ForLoopIndex.GetTestingSet().LoadTestCases(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_ForLoopIndex.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_ForLoopIndex.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_ForLoopIndex.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_ForLoopIndex.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_ForLoopIndex.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_ForLoopIndex.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_ForLoopIndex.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_ForLoopIndex.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_ForLoopIndex_world, *random, "ForLoopIndex world");
@@ -3142,7 +4229,7 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
                                                                          ); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_ForLoopIndex_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_ForLoopIndex_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_ForLoopIndex_world->OnPlacement([this](size_t pos) { prob_ForLoopIndex_world->GetOrg(pos).CalcOut(); });
@@ -3151,12 +4238,12 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_ForLoopIndex.submitted) {
+    if (!GetEvalUtils(prob_utils_ForLoopIndex).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_ForLoopIndex.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_ForLoopIndex.submitted_vec));
+      std::pair<double, bool> r(prob_utils_ForLoopIndex.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_ForLoopIndex).submitted_vec));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -3178,22 +4265,24 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_ForLoopIndex.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_ForLoopIndex.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_ForLoopIndex.testingset_pop.size());
+    prob_utils_ForLoopIndex.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_ForLoopIndex.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_ForLoopIndex.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_ForLoopIndex.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_ForLoopIndex.submitted_vec;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_ForLoopIndex.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_ForLoopIndex).submitted_vec;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_ForLoopIndex.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -3202,25 +4291,11 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_ForLoopIndex.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_ForLoopIndex.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_ForLoopIndex.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_ForLoopIndex); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_ForLoopIndex, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_ForLoopIndex).submitted_vec; });
+  SetupValidation(prob_utils_ForLoopIndex);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -3229,11 +4304,13 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_ForLoopIndex_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_ForLoopIndex_world, [this]() {
+    return GenRandomTestInput_ForLoopIndex(*random, {PROB_FOR_LOOP_INDEX__START_END_MIN, PROB_FOR_LOOP_INDEX__START_END_MAX}, {PROB_FOR_LOOP_INDEX__STEP_MIN, PROB_FOR_LOOP_INDEX__STEP_MAX}, PROB_FOR_LOOP_INDEX__PROMISE_MULTISTEP_TESTCASES);
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_ForLoopIndex.MIN_START_END = PROB_FOR_LOOP_INDEX__START_END_MIN;
@@ -3247,7 +4324,7 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_ForLoopIndex.MIN_START_END = PROB_FOR_LOOP_INDEX__START_END_MIN;
@@ -3273,14 +4350,14 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_ForLoopIndex.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_ForLoopIndex.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 1);
+    GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_ForLoopIndex).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 1);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_ForLoopIndex_input_t & input = prob_utils_ForLoopIndex.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_ForLoopIndex_input_t & input = GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input[0]);
@@ -3290,62 +4367,7 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_ForLoopIndex_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_ForLoopIndex_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_ForLoopIndex_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_ForLoopIndex_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_ForLoopIndex_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -3403,7 +4425,7 @@ void ProgramSynthesisExperiment::SetupProblem_ForLoopIndex() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() { 
-  std::cout << "Setting up problem - CompareStringLengths." << std::endl;
+  ExpLog() << "Setting up problem - CompareStringLengths." << std::endl;
 
   // A few useful aliases.
   using test_org_t = TestOrg_CompareStringLengths;
@@ -3412,15 +4434,16 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_CompareStringLengths.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_CompareStringLengths.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_CompareStringLengths.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_CompareStringLengths.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_CompareStringLengths.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_CompareStringLengths.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_CompareStringLengths.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_CompareStringLengths.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_CompareStringLengths.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_CompareStringLengths.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_CompareStringLengths.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_CompareStringLengths_world, *random, "CompareStringLengths world");
@@ -3432,7 +4455,7 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
                                                                                   {PROB_COMPARE_STRING_LENGTHS__MIN_STR_LEN, PROB_COMPARE_STRING_LENGTHS__MAX_STR_LEN}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_CompareStringLengths_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_CompareStringLengths_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_CompareStringLengths_world->OnPlacement([this](size_t pos) { prob_CompareStringLengths_world->GetOrg(pos).CalcOut(); });
@@ -3441,12 +4464,12 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_CompareStringLengths.submitted) {
+    if (!GetEvalUtils(prob_utils_CompareStringLengths).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_CompareStringLengths.CalcScorePassFail(test_org.GetCorrectOut(), prob_utils_CompareStringLengths.submitted_val));
+      std::pair<double, bool> r(prob_utils_CompareStringLengths.CalcScorePassFail(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_CompareStringLengths).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -3468,22 +4491,24 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_CompareStringLengths.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_CompareStringLengths.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_CompareStringLengths.testingset_pop.size());
+    prob_utils_CompareStringLengths.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_CompareStringLengths.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_CompareStringLengths.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_CompareStringLengths.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_CompareStringLengths.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_CompareStringLengths.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_CompareStringLengths).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_CompareStringLengths.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -3492,25 +4517,11 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_CompareStringLengths.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_CompareStringLengths.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_CompareStringLengths.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_CompareStringLengths); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_CompareStringLengths, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_CompareStringLengths).submitted_val; });
+  SetupValidation(prob_utils_CompareStringLengths);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -3519,11 +4530,13 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_CompareStringLengths_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_CompareStringLengths_world, [this]() {
+    return GenRandomTestInput_CompareStringLengths(*random, {PROB_COMPARE_STRING_LENGTHS__MIN_STR_LEN, PROB_COMPARE_STRING_LENGTHS__MAX_STR_LEN});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_CompareStringLengths_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -3532,7 +4545,7 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_CompareStringLengths.MIN_STR_LEN = PROB_COMPARE_STRING_LENGTHS__MIN_STR_LEN;
@@ -3559,14 +4572,16 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_CompareStringLengths.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_CompareStringLengths.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 1);
+    GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_CompareStringLengths).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 1);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_CompareStringLengths_input_t & input = prob_utils_CompareStringLengths.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      // - Inputs are loaded as shared string handles (no string copies).
+      const std::array<str_handle_t, 3> & input = GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org->GetInputHandles();
+      emp_assert(input[0] != nullptr, "Test input handles not set (CalcOut not called?)");
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input[0]);
@@ -3576,62 +4591,7 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_CompareStringLengths_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_CompareStringLengths_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_CompareStringLengths_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_CompareStringLengths_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_CompareStringLengths_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -3702,12 +4662,12 @@ void ProgramSynthesisExperiment::SetupProblem_CompareStringLengths() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_DoubleLetters() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() { 
-  std::cout << "Setting up problem - Collatz Numbers" << std::endl;
+  ExpLog() << "Setting up problem - Collatz Numbers" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_CollatzNumbers;
@@ -3716,15 +4676,16 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_CollatzNumbers.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_CollatzNumbers.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_CollatzNumbers.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_CollatzNumbers.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_CollatzNumbers.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_CollatzNumbers.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_CollatzNumbers.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_CollatzNumbers.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_CollatzNumbers.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_CollatzNumbers.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_CollatzNumbers.testingset_pop.size() << std::endl;
   
   prob_utils_CollatzNumbers.MAX_ERROR = 256; // Lazy, lazy. Problem-specific, magic number for max error...
 
@@ -3738,7 +4699,7 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
                                                                            {PROB_COLLATZ_NUMBERS__MIN_NUM, PROB_COLLATZ_NUMBERS__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_CollatzNumbers_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_CollatzNumbers_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_CollatzNumbers_world->OnPlacement([this](size_t pos) { 
@@ -3750,12 +4711,12 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_CollatzNumbers.submitted) {
+    if (!GetEvalUtils(prob_utils_CollatzNumbers).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_CollatzNumbers.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_CollatzNumbers.submitted_val));
+      std::pair<double, bool> r(prob_utils_CollatzNumbers.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_CollatzNumbers).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -3777,22 +4738,24 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_CollatzNumbers.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_CollatzNumbers.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_CollatzNumbers.testingset_pop.size());
+    prob_utils_CollatzNumbers.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_CollatzNumbers.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_CollatzNumbers.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_CollatzNumbers.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_CollatzNumbers.submitted_val; 
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_CollatzNumbers.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_CollatzNumbers).submitted_val; 
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_CollatzNumbers.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -3801,25 +4764,11 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_CollatzNumbers.population_validation_outputs); };
   
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_CollatzNumbers.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_CollatzNumbers.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_CollatzNumbers); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_CollatzNumbers, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_CollatzNumbers).submitted_val; });
+  SetupValidation(prob_utils_CollatzNumbers);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -3828,11 +4777,13 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_CollatzNumbers_world);
+  SetupTestCaseWorldUpdate<test_org_t>(prob_CollatzNumbers_world, [this](emp::vector<test_org_t::genome_t> & inputs) {
+    GenRandomTestInputs_CollatzNumbers(*random, inputs, {PROB_COLLATZ_NUMBERS__MIN_NUM, PROB_COLLATZ_NUMBERS__MAX_NUM});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_CollatzNumbers_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -3841,7 +4792,7 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_CollatzNumbers.MIN_NUM = PROB_COLLATZ_NUMBERS__MIN_NUM;
@@ -3865,14 +4816,14 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_CollatzNumbers.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_CollatzNumbers.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_CollatzNumbers).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_CollatzNumbers).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_CollatzNumbers_input_t & input = prob_utils_CollatzNumbers.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_CollatzNumbers_input_t & input = GetEvalUtils(prob_utils_CollatzNumbers).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -3880,62 +4831,7 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_CollatzNumbers_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_CollatzNumbers_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_CollatzNumbers_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_CollatzNumbers_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_CollatzNumbers_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -4014,27 +4910,27 @@ void ProgramSynthesisExperiment::SetupProblem_CollatzNumbers() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_ReplaceSpaceWithNewline() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_StringDifferences() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_EvenSquares() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_WallisPi() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() { 
-  std::cout << "Setting up problem - StringLengthsBackwards" << std::endl;
+  ExpLog() << "Setting up problem - StringLengthsBackwards" << std::endl;
 
   // A few useful aliases.
   using test_org_t = TestOrg_StringLengthsBackwards;
@@ -4043,15 +4939,16 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_StringLengthsBackwards.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_StringLengthsBackwards.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_StringLengthsBackwards.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_StringLengthsBackwards.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_StringLengthsBackwards.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_StringLengthsBackwards.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_StringLengthsBackwards.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_StringLengthsBackwards.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_StringLengthsBackwards.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_StringLengthsBackwards.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_StringLengthsBackwards.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_StringLengthsBackwards_world, *random, "StringLengthsBackwards world");
@@ -4064,7 +4961,7 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
                                                                                    {PROB_STRING_LENGTHS_BACKWARDS__MIN_STR_LEN, PROB_STRING_LENGTHS_BACKWARDS__MAX_STR_LEN}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_StringLengthsBackwards_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_StringLengthsBackwards_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_StringLengthsBackwards_world->OnPlacement([this](size_t pos) { prob_StringLengthsBackwards_world->GetOrg(pos).CalcOut(); });
@@ -4078,7 +4975,7 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
       // result.pass = false;
       // result.sub = false;
     // } else {
-    std::pair<double, bool> r(prob_utils_StringLengthsBackwards.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_StringLengthsBackwards.submitted_vec));
+    std::pair<double, bool> r(prob_utils_StringLengthsBackwards.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_StringLengthsBackwards).submitted_vec));
     result.score = r.first;
     result.pass = r.second;
     result.sub = true;
@@ -4100,22 +4997,24 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_StringLengthsBackwards.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_StringLengthsBackwards.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_StringLengthsBackwards.testingset_pop.size());
+    prob_utils_StringLengthsBackwards.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_StringLengthsBackwards.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_StringLengthsBackwards.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_StringLengthsBackwards.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_StringLengthsBackwards.submitted_vec;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_StringLengthsBackwards.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_StringLengthsBackwards).submitted_vec;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_StringLengthsBackwards.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -4124,25 +5023,11 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_StringLengthsBackwards.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_StringLengthsBackwards.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_StringLengthsBackwards.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_StringLengthsBackwards); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_StringLengthsBackwards, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_StringLengthsBackwards).submitted_vec; });
+  SetupValidation(prob_utils_StringLengthsBackwards);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -4151,11 +5036,13 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_StringLengthsBackwards_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_StringLengthsBackwards_world, [this]() {
+    return GenRandomTestInput_StringLengthsBackwards(*random, {PROB_STRING_LENGTHS_BACKWARDS__MIN_STR_CNT, PROB_STRING_LENGTHS_BACKWARDS__MAX_STR_CNT}, {PROB_STRING_LENGTHS_BACKWARDS__MIN_STR_LEN, PROB_STRING_LENGTHS_BACKWARDS__MAX_STR_LEN});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_StringLengthsBackwards_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -4165,7 +5052,7 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_StringLengthsBackwards.MIN_STR_LEN = PROB_STRING_LENGTHS_BACKWARDS__MIN_STR_LEN;
@@ -4196,14 +5083,16 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_StringLengthsBackwards.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_StringLengthsBackwards.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 1);
+    GetEvalUtils(prob_utils_StringLengthsBackwards).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_StringLengthsBackwards).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 1);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      const Problem_StringLengthsBackwards_input_t & input = prob_utils_StringLengthsBackwards.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      // - Inputs are loaded as shared string handles (no string copies).
+      const emp::vector<str_handle_t> & input = GetEvalUtils(prob_utils_StringLengthsBackwards).cur_eval_test_org->GetInputHandles();
+      emp_assert(input.size() == GetEvalUtils(prob_utils_StringLengthsBackwards).cur_eval_test_org->GetGenome().size(), "Test input handles out of date (CalcOut not called?)");
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -4211,62 +5100,7 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
   });  
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_StringLengthsBackwards_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_StringLengthsBackwards_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_StringLengthsBackwards_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_StringLengthsBackwards_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_StringLengthsBackwards_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions(); // Add them all!
@@ -4287,7 +5121,7 @@ void ProgramSynthesisExperiment::SetupProblem_StringLengthsBackwards() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() { 
-  std::cout << "Setting up problem - LastIndexOfZero" << std::endl;
+  ExpLog() << "Setting up problem - LastIndexOfZero" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_LastIndexOfZero;
@@ -4296,15 +5130,16 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_LastIndexOfZero.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_LastIndexOfZero.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_LastIndexOfZero.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_LastIndexOfZero.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_LastIndexOfZero.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_LastIndexOfZero.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_LastIndexOfZero.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_LastIndexOfZero.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_LastIndexOfZero.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_LastIndexOfZero.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_LastIndexOfZero.testingset_pop.size() << std::endl;
 
   prob_utils_LastIndexOfZero.MAX_ERROR = PROB_LAST_INDEX_OF_ZERO__MAX_VEC_LEN;
 
@@ -4319,7 +5154,7 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
                                                                              {PROB_LAST_INDEX_OF_ZERO__MIN_NUM, PROB_LAST_INDEX_OF_ZERO__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_LastIndexOfZero_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_LastIndexOfZero_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_LastIndexOfZero_world->OnPlacement([this](size_t pos) { prob_LastIndexOfZero_world->GetOrg(pos).CalcOut(); });
@@ -4328,12 +5163,12 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_LastIndexOfZero.submitted) {
+    if (!GetEvalUtils(prob_utils_LastIndexOfZero).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_LastIndexOfZero.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_LastIndexOfZero.submitted_val));
+      std::pair<double, bool> r(prob_utils_LastIndexOfZero.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_LastIndexOfZero).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -4355,22 +5190,24 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_LastIndexOfZero.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_LastIndexOfZero.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_LastIndexOfZero.testingset_pop.size());
+    prob_utils_LastIndexOfZero.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_LastIndexOfZero.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_LastIndexOfZero.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_LastIndexOfZero.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_LastIndexOfZero.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_LastIndexOfZero.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_LastIndexOfZero).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_LastIndexOfZero.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -4379,25 +5216,11 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_LastIndexOfZero.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_LastIndexOfZero.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_LastIndexOfZero.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_LastIndexOfZero); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  }; 
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_LastIndexOfZero, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_LastIndexOfZero).submitted_val; });
+  SetupValidation(prob_utils_LastIndexOfZero);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -4406,11 +5229,13 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_LastIndexOfZero_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_LastIndexOfZero_world, [this]() {
+    return GenRandomTestInput_LastIndexOfZero(*random, {PROB_LAST_INDEX_OF_ZERO__MIN_VEC_LEN, PROB_LAST_INDEX_OF_ZERO__MAX_VEC_LEN}, {PROB_LAST_INDEX_OF_ZERO__MIN_NUM, PROB_LAST_INDEX_OF_ZERO__MAX_NUM});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_LastIndexOfZero_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -4421,7 +5246,7 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_LastIndexOfZero.MIN_VEC_LEN = PROB_LAST_INDEX_OF_ZERO__MIN_VEC_LEN;
@@ -4450,15 +5275,15 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_LastIndexOfZero.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_LastIndexOfZero.ResetTestEval();
-    prob_utils_LastIndexOfZero.MAX_ERROR = prob_utils_LastIndexOfZero.cur_eval_test_org->GetGenome().size();
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_LastIndexOfZero).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_LastIndexOfZero).ResetTestEval();
+    prob_utils_LastIndexOfZero.MAX_ERROR = GetEvalUtils(prob_utils_LastIndexOfZero).cur_eval_test_org->GetGenome().size();
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_LastIndexOfZero_input_t & input = prob_utils_LastIndexOfZero.cur_eval_test_org->GetGenome();
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_LastIndexOfZero_input_t & input = GetEvalUtils(prob_utils_LastIndexOfZero).cur_eval_test_org->GetGenome();
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -4466,62 +5291,7 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_LastIndexOfZero_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_LastIndexOfZero_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_LastIndexOfZero_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_LastIndexOfZero_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_LastIndexOfZero_world); };
 
   AddDefaultInstructions({"Add",
                           "Sub",
@@ -4598,7 +5368,7 @@ void ProgramSynthesisExperiment::SetupProblem_LastIndexOfZero() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_VectorAverage() { 
-    std::cout << "Setting up problem - VectorAverage" << std::endl;
+    ExpLog() << "Setting up problem - VectorAverage" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_VectorAverage;
@@ -4607,15 +5377,16 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_VectorAverage.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_VectorAverage.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_VectorAverage.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_VectorAverage.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_VectorAverage.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_VectorAverage.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_VectorAverage.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_VectorAverage.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_VectorAverage.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_VectorAverage.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_VectorAverage.testingset_pop.size() << std::endl;
 
   // Setup epsilon
   prob_utils_VectorAverage.EPSILON = PROB_VECTOR_AVERAGE__EPSILON;
@@ -4631,7 +5402,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
                                                                            {PROB_VECTOR_AVERAGE__MIN_NUM, PROB_VECTOR_AVERAGE__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_VectorAverage_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_VectorAverage_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_VectorAverage_world->OnPlacement([this](size_t pos) { prob_VectorAverage_world->GetOrg(pos).CalcOut(); });
@@ -4640,12 +5411,12 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_VectorAverage.submitted) {
+    if (!GetEvalUtils(prob_utils_VectorAverage).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_VectorAverage.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_VectorAverage.submitted_val));
+      std::pair<double, bool> r(prob_utils_VectorAverage.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_VectorAverage).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -4667,22 +5438,24 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_VectorAverage.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_VectorAverage.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_VectorAverage.testingset_pop.size());
+    prob_utils_VectorAverage.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_VectorAverage.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_VectorAverage.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_VectorAverage.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_VectorAverage.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_VectorAverage.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_VectorAverage).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_VectorAverage.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -4691,25 +5464,11 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_VectorAverage.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_VectorAverage.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_VectorAverage.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_VectorAverage); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  }; 
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_VectorAverage, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_VectorAverage).submitted_val; });
+  SetupValidation(prob_utils_VectorAverage);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -4718,11 +5477,13 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_VectorAverage_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_VectorAverage_world, [this]() {
+    return GenRandomTestInput_VectorAverage(*random, {PROB_VECTOR_AVERAGE__MIN_VEC_LEN, PROB_VECTOR_AVERAGE__MAX_VEC_LEN}, {PROB_VECTOR_AVERAGE__MIN_NUM, PROB_VECTOR_AVERAGE__MAX_NUM});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_VectorAverage_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -4733,7 +5494,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_VectorAverage.MIN_VEC_LEN = PROB_VECTOR_AVERAGE__MIN_VEC_LEN;
@@ -4761,15 +5522,15 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_VectorAverage.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_VectorAverage.ResetTestEval();
-    prob_utils_VectorAverage.MAX_ERROR = prob_utils_VectorAverage.cur_eval_test_org->GetGenome().size() * PROB_VECTOR_AVERAGE__MAX_NUM;
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_VectorAverage).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_VectorAverage).ResetTestEval();
+    prob_utils_VectorAverage.MAX_ERROR = GetEvalUtils(prob_utils_VectorAverage).cur_eval_test_org->GetGenome().size() * PROB_VECTOR_AVERAGE__MAX_NUM;
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_VectorAverage_input_t & input = prob_utils_VectorAverage.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_VectorAverage_input_t & input = GetEvalUtils(prob_utils_VectorAverage).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -4777,62 +5538,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_VectorAverage_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_VectorAverage_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_VectorAverage_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_VectorAverage_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_VectorAverage_world); };
 
   AddDefaultInstructions({"Add",
                           "Sub",
@@ -4908,7 +5614,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorAverage() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_CountOdds() { 
-  std::cout << "Setting up problem - CountOdds" << std::endl;
+  ExpLog() << "Setting up problem - CountOdds" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_CountOdds;
@@ -4917,15 +5623,16 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_CountOdds.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_CountOdds.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_CountOdds.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_CountOdds.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_CountOdds.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_CountOdds.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_CountOdds.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_CountOdds.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_CountOdds.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_CountOdds.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_CountOdds.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_CountOdds_world, *random, "CountOdds world");
@@ -4938,7 +5645,7 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
                                                                              {PROB_COUNT_ODDS__MIN_NUM, PROB_COUNT_ODDS__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_CountOdds_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_CountOdds_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_CountOdds_world->OnPlacement([this](size_t pos) { prob_CountOdds_world->GetOrg(pos).CalcOut(); });
@@ -4947,12 +5654,12 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_CountOdds.submitted) {
+    if (!GetEvalUtils(prob_utils_CountOdds).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_CountOdds.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_CountOdds.submitted_val));
+      std::pair<double, bool> r(prob_utils_CountOdds.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_CountOdds).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -4974,22 +5681,24 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_CountOdds.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_CountOdds.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_CountOdds.testingset_pop.size());
+    prob_utils_CountOdds.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_CountOdds.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_CountOdds.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_CountOdds.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_CountOdds.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_CountOdds.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_CountOdds).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_CountOdds.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -4998,25 +5707,11 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_CountOdds.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_CountOdds.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_CountOdds.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_CountOdds); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  }; 
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_CountOdds, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_CountOdds).submitted_val; });
+  SetupValidation(prob_utils_CountOdds);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -5025,11 +5720,13 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_CountOdds_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_CountOdds_world, [this]() {
+    return GenRandomTestInput_CountOdds(*random, {PROB_COUNT_ODDS__MIN_VEC_LEN, PROB_COUNT_ODDS__MAX_VEC_LEN}, {PROB_COUNT_ODDS__MIN_NUM, PROB_COUNT_ODDS__MAX_NUM});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_CountOdds_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -5040,7 +5737,7 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_CountOdds.MIN_VEC_LEN = PROB_COUNT_ODDS__MIN_VEC_LEN;
@@ -5069,15 +5766,15 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_CountOdds.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_CountOdds.ResetTestEval();
-    prob_utils_CountOdds.MAX_ERROR = prob_utils_CountOdds.cur_eval_test_org->GetGenome().size();
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_CountOdds).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_CountOdds).ResetTestEval();
+    prob_utils_CountOdds.MAX_ERROR = GetEvalUtils(prob_utils_CountOdds).cur_eval_test_org->GetGenome().size();
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_CountOdds_input_t & input = prob_utils_CountOdds.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_CountOdds_input_t & input = GetEvalUtils(prob_utils_CountOdds).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -5085,62 +5782,7 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_CountOdds_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_CountOdds_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_CountOdds_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_CountOdds_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_CountOdds_world); };
 
   AddDefaultInstructions({"Add",
                           "Sub",
@@ -5216,7 +5858,7 @@ void ProgramSynthesisExperiment::SetupProblem_CountOdds() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_MirrorImage() { 
-  std::cout << "Setting up problem - MirrorImage" << std::endl;
+  ExpLog() << "Setting up problem - MirrorImage" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_MirrorImage;
@@ -5225,15 +5867,16 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_MirrorImage.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_MirrorImage.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_MirrorImage.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_MirrorImage.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_MirrorImage.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_MirrorImage.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_MirrorImage.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_MirrorImage.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_MirrorImage.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_MirrorImage.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_MirrorImage.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_MirrorImage_world, *random, "MirrorImage world");
@@ -5246,7 +5889,7 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
                                                                          {PROB_MIRROR_IMAGE__MIN_NUM, PROB_MIRROR_IMAGE__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_MirrorImage_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_MirrorImage_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_MirrorImage_world->OnPlacement([this](size_t pos) { prob_MirrorImage_world->GetOrg(pos).CalcOut(); });
@@ -5255,12 +5898,12 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_MirrorImage.submitted) {
+    if (!GetEvalUtils(prob_utils_MirrorImage).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_MirrorImage.CalcScorePassFail(test_org.GetCorrectOut(), prob_utils_MirrorImage.submitted_val));
+      std::pair<double, bool> r(prob_utils_MirrorImage.CalcScorePassFail(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_MirrorImage).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -5282,22 +5925,24 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_MirrorImage.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_MirrorImage.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_MirrorImage.testingset_pop.size());
+    prob_utils_MirrorImage.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_MirrorImage.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_MirrorImage.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_MirrorImage.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_MirrorImage.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_MirrorImage.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_MirrorImage).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_MirrorImage.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -5306,25 +5951,11 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_MirrorImage.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_MirrorImage.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_MirrorImage.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_MirrorImage); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  }; 
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_MirrorImage, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_MirrorImage).submitted_val; });
+  SetupValidation(prob_utils_MirrorImage);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -5333,11 +5964,13 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_MirrorImage_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_MirrorImage_world, [this]() {
+    return GenRandomTestInput_MirrorImage(*random, {PROB_MIRROR_IMAGE__MIN_VEC_LEN, PROB_MIRROR_IMAGE__MAX_VEC_LEN}, {PROB_MIRROR_IMAGE__MIN_NUM, PROB_MIRROR_IMAGE__MAX_NUM});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_MirrorImage_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -5348,7 +5981,7 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_MirrorImage.MIN_VEC_LEN = PROB_MIRROR_IMAGE__MIN_VEC_LEN;
@@ -5379,14 +6012,14 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_MirrorImage.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_MirrorImage.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_MirrorImage).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_MirrorImage_input_t & input = prob_utils_MirrorImage.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_MirrorImage_input_t & input = GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input[0]);
@@ -5395,62 +6028,7 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_MirrorImage_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_MirrorImage_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_MirrorImage_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_MirrorImage_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_MirrorImage_world); };
 
   AddDefaultInstructions({"Add",
                           "Sub",
@@ -5538,12 +6116,12 @@ void ProgramSynthesisExperiment::SetupProblem_MirrorImage() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_SuperAnagrams() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() { 
-  std::cout << "Setting up problem - SumOfSquares" << std::endl;
+  ExpLog() << "Setting up problem - SumOfSquares" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_SumOfSquares;
@@ -5552,15 +6130,16 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_SumOfSquares.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_SumOfSquares.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_SumOfSquares.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_SumOfSquares.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_SumOfSquares.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_SumOfSquares.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_SumOfSquares.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_SumOfSquares.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_SumOfSquares.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_SumOfSquares.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_SumOfSquares.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_SumOfSquares_world, *random, "SumOfSquares world");
@@ -5572,7 +6151,7 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
                                                                           {PROB_SUM_OF_SQUARES__MIN_NUM, PROB_SUM_OF_SQUARES__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_SumOfSquares_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_SumOfSquares_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_SumOfSquares_world->OnPlacement([this](size_t pos) { prob_SumOfSquares_world->GetOrg(pos).CalcOut(); });
@@ -5581,12 +6160,12 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_SumOfSquares.submitted) {
+    if (!GetEvalUtils(prob_utils_SumOfSquares).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_SumOfSquares.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_SumOfSquares.submitted_val));
+      std::pair<double, bool> r(prob_utils_SumOfSquares.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_SumOfSquares).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -5608,22 +6187,24 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_SumOfSquares.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_SumOfSquares.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_SumOfSquares.testingset_pop.size());
+    prob_utils_SumOfSquares.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_SumOfSquares.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_SumOfSquares.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_SumOfSquares.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_SumOfSquares.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_SumOfSquares.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_SumOfSquares).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_SumOfSquares.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -5632,25 +6213,11 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_SumOfSquares.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_SumOfSquares.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_SumOfSquares.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_SumOfSquares); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_SumOfSquares, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_SumOfSquares).submitted_val; });
+  SetupValidation(prob_utils_SumOfSquares);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -5659,13 +6226,15 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_SumOfSquares_world);
+  SetupTestCaseWorldUpdate<test_org_t>(prob_SumOfSquares_world, [this](emp::vector<test_org_t::genome_t> & inputs) {
+    GenRandomTestInputs_SumOfSquares(*random, inputs, {PROB_SUM_OF_SQUARES__MIN_NUM, PROB_SUM_OF_SQUARES__MAX_NUM});
+  });
 
   // todo - test that RANDOM is actually making random things every update..
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_SumOfSquares_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -5674,7 +6243,7 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_SumOfSquares.MIN_NUM = PROB_SUM_OF_SQUARES__MIN_NUM;
@@ -5698,15 +6267,15 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_SumOfSquares.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_SumOfSquares.ResetTestEval();
-    prob_utils_SumOfSquares.MAX_ERROR = (int)((double)GenCorrectOut_SumOfSquares(prob_utils_SumOfSquares.cur_eval_test_org->GetGenome()) * 0.5);
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_SumOfSquares).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_SumOfSquares).ResetTestEval();
+    prob_utils_SumOfSquares.MAX_ERROR = (int)((double)GenCorrectOut_SumOfSquares(GetEvalUtils(prob_utils_SumOfSquares).cur_eval_test_org->GetGenome()) * 0.5);
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_SumOfSquares_input_t & input = prob_utils_SumOfSquares.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_SumOfSquares_input_t & input = GetEvalUtils(prob_utils_SumOfSquares).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input);
@@ -5714,62 +6283,7 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_SumOfSquares_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_SumOfSquares_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_SumOfSquares_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_SumOfSquares_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_SumOfSquares_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -5848,7 +6362,7 @@ void ProgramSynthesisExperiment::SetupProblem_SumOfSquares() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() { 
-  std::cout << "Setting up problem - VectorsSummed" << std::endl;
+  ExpLog() << "Setting up problem - VectorsSummed" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_VectorsSummed;
@@ -5857,15 +6371,16 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_VectorsSummed.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_VectorsSummed.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_VectorsSummed.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_VectorsSummed.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_VectorsSummed.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_VectorsSummed.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_VectorsSummed.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_VectorsSummed.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_VectorsSummed.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_VectorsSummed.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_VectorsSummed.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_VectorsSummed_world, *random, "VectorsSummed world");
@@ -5878,7 +6393,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
                                                                            {PROB_VECTORS_SUMMED__MIN_NUM, PROB_VECTORS_SUMMED__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_VectorsSummed_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_VectorsSummed_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_VectorsSummed_world->OnPlacement([this](size_t pos) { prob_VectorsSummed_world->GetOrg(pos).CalcOut(); });
@@ -5887,12 +6402,12 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_VectorsSummed.submitted) {
+    if (!GetEvalUtils(prob_utils_VectorsSummed).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_VectorsSummed.CalcScoreGradient(test_org.GetCorrectOut(), prob_utils_VectorsSummed.submitted_vec));
+      std::pair<double, bool> r(prob_utils_VectorsSummed.CalcScoreGradient(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_VectorsSummed).submitted_vec));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -5914,22 +6429,24 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_VectorsSummed.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_VectorsSummed.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_VectorsSummed.testingset_pop.size());
+    prob_utils_VectorsSummed.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_VectorsSummed.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_VectorsSummed.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_VectorsSummed.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_VectorsSummed.submitted_vec;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_VectorsSummed.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_VectorsSummed).submitted_vec;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_VectorsSummed.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -5938,25 +6455,11 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_VectorsSummed.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_VectorsSummed.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_VectorsSummed.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_VectorsSummed); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  }; 
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_VectorsSummed, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_VectorsSummed).submitted_vec; });
+  SetupValidation(prob_utils_VectorsSummed);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -5965,11 +6468,13 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_VectorsSummed_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_VectorsSummed_world, [this]() {
+    return GenRandomTestInput_VectorsSummed(*random, {PROB_VECTORS_SUMMED__MIN_VEC_LEN, PROB_VECTORS_SUMMED__MAX_VEC_LEN}, {PROB_VECTORS_SUMMED__MIN_NUM, PROB_VECTORS_SUMMED__MAX_NUM});
+  });
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_VectorsSummed_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -5980,7 +6485,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_VectorsSummed.MIN_VEC_LEN = PROB_VECTORS_SUMMED__MIN_VEC_LEN;
@@ -6009,15 +6514,15 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_VectorsSummed.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_VectorsSummed.ResetTestEval();
-    prob_utils_VectorsSummed.MAX_ERROR = (2*PROB_VECTORS_SUMMED__MAX_NUM) * prob_utils_VectorsSummed.cur_eval_test_org->GetGenome().size();
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_VectorsSummed).ResetTestEval();
+    prob_utils_VectorsSummed.MAX_ERROR = (2*PROB_VECTORS_SUMMED__MAX_NUM) * GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org->GetGenome().size();
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_VectorsSummed_input_t & input = prob_utils_VectorsSummed.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_VectorsSummed_input_t & input = GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input[0]);
@@ -6026,62 +6531,7 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_VectorsSummed_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_VectorsSummed_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_VectorsSummed_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_VectorsSummed_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_VectorsSummed_world); };
 
   AddDefaultInstructions({"Add",
                           "Sub",
@@ -6161,37 +6611,37 @@ void ProgramSynthesisExperiment::SetupProblem_VectorsSummed() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_XWordLines() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_PigLatin() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_NegativeToZero() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_ScrabbleScore() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_Checksum() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_Digits() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
 void ProgramSynthesisExperiment::SetupProblem_Grade() { 
-  std::cout << "Setting up problem - Grade" << std::endl;
+  ExpLog() << "Setting up problem - Grade" << std::endl;
 
   // A few useful aliases.
   using test_org_t = TestOrg_Grade;
@@ -6200,15 +6650,16 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_Grade.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_Grade.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_Grade.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_Grade.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_Grade.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_Grade.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_Grade.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_Grade.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_Grade.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_Grade.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_Grade.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_Grade_world, *random, "Grade world");
@@ -6220,7 +6671,7 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
                                                                    {PROB_GRADE__MIN_NUM, PROB_GRADE__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_Grade_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_Grade_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_Grade_world->OnPlacement([this](size_t pos) { prob_Grade_world->GetOrg(pos).CalcOut(); });
@@ -6229,12 +6680,12 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_Grade.submitted) {
+    if (!GetEvalUtils(prob_utils_Grade).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_Grade.CalcScorePassFail(test_org.GetCorrectOut(), prob_utils_Grade.submitted_str));
+      std::pair<double, bool> r(prob_utils_Grade.CalcScorePassFail(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_Grade).submitted_str));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -6256,22 +6707,24 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_Grade.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_Grade.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_Grade.testingset_pop.size());
+    prob_utils_Grade.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_Grade.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_Grade.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_Grade.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_Grade.submitted_str;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_Grade.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_Grade).submitted_str;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_Grade.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -6280,25 +6733,11 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_Grade.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_Grade.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_Grade.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_Grade); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_Grade, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_Grade).submitted_str; });
+  SetupValidation(prob_utils_Grade);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -6307,13 +6746,15 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_Grade_world);
+  SetupTestCaseWorldUpdate_PerTestInputs<test_org_t>(prob_Grade_world, [this]() {
+    return GenRandomTestInput_Grade(*random, {PROB_GRADE__MIN_NUM, PROB_GRADE__MAX_NUM});
+  });
 
   // todo - test that RANDOM is actually making random things every update..
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_Grade_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -6322,7 +6763,7 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_Grade.MIN_NUM = PROB_GRADE__MIN_NUM;
@@ -6347,14 +6788,14 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_Grade.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_Grade.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 4);
+    GetEvalUtils(prob_utils_Grade).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_Grade).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 4);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_Grade_input_t & input = prob_utils_Grade.cur_eval_test_org->GetGenome(); 
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_Grade_input_t & input = GetEvalUtils(prob_utils_Grade).cur_eval_test_org->GetGenome(); 
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // std::cout << "Begin program test!" << std::endl;
       // std::cout << "  A thresh: " << input[0] << std::endl;
@@ -6372,62 +6813,7 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_Grade_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_Grade_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_Grade_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_Grade_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_Grade_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -6522,7 +6908,7 @@ void ProgramSynthesisExperiment::SetupProblem_Grade() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_Median() { 
-  std::cout << "Setting up problem - Median" << std::endl;
+  ExpLog() << "Setting up problem - Median" << std::endl;
 
   // A few useful aliases
   using test_org_t = TestOrg_Median;
@@ -6531,15 +6917,16 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_Median.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_Median.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_Median.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_Median.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_Median.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_Median.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_Median.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_Median.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_Median.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_Median.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_Median.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_Median_world, *random, "Median world");
@@ -6551,7 +6938,7 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
                                                                     {PROB_MEDIAN__MIN_NUM, PROB_MEDIAN__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_Median_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_Median_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_Median_world->OnPlacement([this](size_t pos) { prob_Median_world->GetOrg(pos).CalcOut(); });
@@ -6560,12 +6947,12 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_Median.submitted) {
+    if (!GetEvalUtils(prob_utils_Median).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_Median.CalcScorePassFail(test_org.GetCorrectOut(), prob_utils_Median.submitted_val));
+      std::pair<double, bool> r(prob_utils_Median.CalcScorePassFail(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_Median).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -6587,22 +6974,24 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_Median.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_Median.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_Median.testingset_pop.size());
+    prob_utils_Median.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_Median.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_Median.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_Median.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_Median.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_Median.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_Median).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_Median.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -6611,25 +7000,11 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_Median.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_Median.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_Median.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_Median); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_Median, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_Median).submitted_val; });
+  SetupValidation(prob_utils_Median);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -6638,13 +7013,15 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_Median_world);
+  SetupTestCaseWorldUpdate<test_org_t>(prob_Median_world, [this](emp::vector<test_org_t::genome_t> & inputs) {
+    GenRandomTestInputs_Median(*random, inputs, {PROB_MEDIAN__MIN_NUM, PROB_MEDIAN__MAX_NUM});
+  });
 
   // todo - test that RANDOM is actually making random things every update..
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_Median_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -6653,7 +7030,7 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_Median.MIN_NUM = PROB_MEDIAN__MIN_NUM;
@@ -6679,14 +7056,14 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_Median.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_Median.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 3);
+    GetEvalUtils(prob_utils_Median).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_Median).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 3);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_Median_input_t & input = prob_utils_Median.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_Median_input_t & input = GetEvalUtils(prob_utils_Median).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input[0]);
@@ -6696,62 +7073,7 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_Median_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_Median_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_Median_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_Median_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_Median_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -6827,7 +7149,7 @@ void ProgramSynthesisExperiment::SetupProblem_Median() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_Smallest() { 
-  std::cout << "Setting up problem - Smallest" << std::endl;
+  ExpLog() << "Setting up problem - Smallest" << std::endl;
 
   // A few useful aliases.
   using test_org_t = TestOrg_Smallest;
@@ -6836,15 +7158,16 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   if (BENCHMARK_DATA_DIR.back() != '/') BENCHMARK_DATA_DIR += '/';
   std::string training_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTrainingSetFilename();  
   std::string testing_examples_fpath = BENCHMARK_DATA_DIR + problems.at(PROBLEM).GetTestingSetFilename();  
-  std::cout << "Loading training examples." << std::endl;
+  ExpLog() << "Loading training examples." << std::endl;
   prob_utils_Smallest.GetTrainingSet().LoadTestCasesWithCSVReader(training_examples_fpath);
-  std::cout << "Loading testing examples." << std::endl;
-  prob_utils_Smallest.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
-  std::cout << "Generating testing set population." << std::endl;
+  ExpLog() << "Loading testing examples." << std::endl;
+  if (!TESTING_SET_STREAM_CHUNK_SIZE) prob_utils_Smallest.GetTestingSet().LoadTestCasesWithCSVReader(testing_examples_fpath);
+  ExpLog() << "Generating testing set population." << std::endl;
   prob_utils_Smallest.GenerateTestingSetPop();
-  std::cout << "Loaded training example set size = " << prob_utils_Smallest.GetTrainingSet().GetSize() << std::endl;
-  std::cout << "Loaded testing example set size = " << prob_utils_Smallest.GetTestingSet().GetSize() << std::endl;
-  std::cout << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_Smallest.testingset_pop.size() << std::endl;
+  validation_difficulty.Resize(prob_utils_Smallest.testingset_pop.size());
+  ExpLog() << "Loaded training example set size = " << prob_utils_Smallest.GetTrainingSet().GetSize() << std::endl;
+  ExpLog() << "Loaded testing example set size = " << prob_utils_Smallest.GetTestingSet().GetSize() << std::endl;
+  ExpLog() << "Testing set (non-training examples used to evaluate program accuracy) size = " << prob_utils_Smallest.testingset_pop.size() << std::endl;
 
   // Setup the world
   NewTestCaseWorld(prob_Smallest_world, *random, "Smallest world");
@@ -6856,7 +7179,7 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
                                                                       {PROB_SMALLEST__MIN_NUM, PROB_SMALLEST__MAX_NUM}); 
                                   }
                         );
-  end_setup_sig.AddAction([this]() { std::cout << "TestCase world size= " << prob_Smallest_world->GetSize() << std::endl; });
+  end_setup_sig.AddAction([this]() { ExpLog() << "TestCase world size= " << prob_Smallest_world->GetSize() << std::endl; });
 
   // Tell the world to calculate the correct test output (given input) on placement.
   prob_Smallest_world->OnPlacement([this](size_t pos) { prob_Smallest_world->GetOrg(pos).CalcOut(); });
@@ -6865,12 +7188,12 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   CalcProgramResultOnTest = [this](prog_org_t & prog_org, TestOrg_Base & test_org_base) {
     test_org_t & test_org = static_cast<test_org_t&>(test_org_base);
     TestResult result;
-    if (!prob_utils_Smallest.submitted) {
+    if (!GetEvalUtils(prob_utils_Smallest).submitted) {
       result.score = 0;
       result.pass = false;
       result.sub = false;
     } else {
-      std::pair<double, bool> r(prob_utils_Smallest.CalcScorePassFail(test_org.GetCorrectOut(), prob_utils_Smallest.submitted_val));
+      std::pair<double, bool> r(prob_utils_Smallest.CalcScorePassFail(test_org.GetCorrectOut(), GetEvalUtils(prob_utils_Smallest).submitted_val));
       result.score = r.first;
       result.pass = r.second;
       result.sub = true;
@@ -6892,22 +7215,24 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   DoTestingSetValidation = [this](prog_org_t & prog_org) { 
     // evaluate program on full testing set; update stats utils with results
     begin_program_eval.Trigger(prog_org);
-    stats_util.current_program__validation__test_results.resize(prob_utils_Smallest.testingset_pop.size());
+    stats_util.current_program__validation__test_results.resize(validation_sample.GetSize());
     stats_util.current_program__validation__total_score = 0;
     stats_util.current_program__validation__total_passes = 0;
     stats_util.current_program__validation__is_solution = false;
-    prob_utils_Smallest.population_validation_outputs[stats_util.cur_progID].resize(prob_utils_Smallest.testingset_pop.size());
+    prob_utils_Smallest.population_validation_outputs[stats_util.cur_progID].resize(validation_sample.GetSize());
     // For each test in validation set, evaluate program.
-    for (size_t testID = 0; testID < prob_utils_Smallest.testingset_pop.size(); ++testID) {
+    for (size_t i = 0; i < validation_sample.GetSize(); ++i) {
+      const size_t testID = validation_sample.GetTestIDs()[i];
       stats_util.cur_testID = testID;
       emp::Ptr<test_org_t> test_org_ptr = prob_utils_Smallest.testingset_pop[testID];
       begin_program_test.Trigger(prog_org, test_org_ptr);
       do_program_test.Trigger(prog_org, test_org_ptr);
       end_program_test.Trigger(prog_org, test_org_ptr);
-      stats_util.current_program__validation__test_results[testID] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[testID].score;
-      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[testID].pass;
-      prob_utils_Smallest.population_validation_outputs[stats_util.cur_progID][testID] = prob_utils_Smallest.submitted_val;
+      stats_util.current_program__validation__test_results[i] = CalcProgramResultOnTest(prog_org, *test_org_ptr);
+      stats_util.current_program__validation__total_score += stats_util.current_program__validation__test_results[i].score;
+      stats_util.current_program__validation__total_passes += (size_t)stats_util.current_program__validation__test_results[i].pass;
+      validation_difficulty.RecordPass(testID, stats_util.current_program__validation__test_results[i].pass);
+      prob_utils_Smallest.population_validation_outputs[stats_util.cur_progID][i] = GetEvalUtils(prob_utils_Smallest).submitted_val;
     }
     stats_util.current_program__validation__is_solution = stats_util.current_program__validation__total_passes == prob_utils_Smallest.testingset_pop.size();
     end_program_eval.Trigger(prog_org);
@@ -6916,25 +7241,11 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   program_stats.get_prog_unique_behavioral_phenotypes = [this]() { return emp::UniqueCount(prob_utils_Smallest.population_validation_outputs); };
 
   // How should we screen for a solution?
-  ScreenForSolution = [this](prog_org_t & prog_org) {
-    begin_program_eval.Trigger(prog_org);
-    for (size_t testID = 0; testID < prob_utils_Smallest.testingset_pop.size(); ++testID) {
-      stats_util.cur_testID = testID;
-      emp::Ptr<test_org_t> test_org_ptr = prob_utils_Smallest.testingset_pop[testID];
+  ScreenForSolution = [this](prog_org_t & prog_org) { return ScreenOnTestingSet(prog_org, prob_utils_Smallest); };
 
-      begin_program_test.Trigger(prog_org, test_org_ptr);
-      do_program_test.Trigger(prog_org, test_org_ptr);
-      end_program_test.Trigger(prog_org, test_org_ptr);
-      
-      TestResult result = CalcProgramResultOnTest(prog_org, *test_org_ptr);
-      if (!result.pass) {
-        end_program_eval.Trigger(prog_org);
-        return false;
-      }
-    }
-    end_program_eval.Trigger(prog_org);
-    return true;
-  };
+  // Optionally, stream testing set from disk (replaces validation/screening functions above).
+  if (TESTING_SET_STREAM_CHUNK_SIZE) SetupTestingSetStream<test_org_t>(prob_utils_Smallest, testing_examples_fpath, [this]() { return GetEvalUtils(prob_utils_Smallest).submitted_val; });
+  SetupValidation(prob_utils_Smallest);
 
   // Tell the experiment how to get test phenotypes.
   GetTestPhenotype = [this](size_t testID) -> test_org_phen_t & {
@@ -6943,13 +7254,15 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   };
 
   // Setup how test world updates.
-  SetupTestCaseWorldUpdate(prob_Smallest_world);
+  SetupTestCaseWorldUpdate<test_org_t>(prob_Smallest_world, [this](emp::vector<test_org_t::genome_t> & inputs) {
+    GenRandomTestInputs_Smallest(*random, inputs, {PROB_SMALLEST__MIN_NUM, PROB_SMALLEST__MAX_NUM});
+  });
 
   // todo - test that RANDOM is actually making random things every update..
 
   // Setup how test cases mutate.
   if (TRAINING_EXAMPLE_MODE == (size_t)TRAINING_EXAMPLE_MODE_TYPE::RANDOM) {
-    std::cout << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
+    ExpLog() << "RANDOM training mode detected, configuring mutation function to RANDOMIZE organisms." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Randomize organism genome on mutate.
       prob_Smallest_world->SetMutFun([this](test_org_t & test_org, emp::Random & rnd) {
@@ -6958,7 +7271,7 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
       });
     };
   } else {
-    std::cout << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
+    ExpLog() << "Non-RANDOM training mode detected, configuring mutation function normally." << std::endl;
     SetupTestMutation = [this]() {
       // (1) Configure mutator.
       prob_utils_Smallest.MIN_NUM = PROB_SMALLEST__MIN_NUM;
@@ -6983,14 +7296,14 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   begin_program_test.AddAction([this](prog_org_t & prog_org, emp::Ptr<TestOrg_Base> test_org_base_ptr) {
     // Reset eval stuff
     // Set current test org.
-    prob_utils_Smallest.cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
-    prob_utils_Smallest.ResetTestEval();
-    emp_assert(eval_hardware->GetMemSize() >= 4);
+    GetEvalUtils(prob_utils_Smallest).cur_eval_test_org = test_org_base_ptr.Cast<test_org_t>(); // currently only place need testID for this?
+    GetEvalUtils(prob_utils_Smallest).ResetTestEval();
+    emp_assert(GetEvalHardware().GetMemSize() >= 4);
     // Configure inputs.
-    if (eval_hardware->GetCallStackSize()) {
+    if (GetEvalHardware().GetCallStackSize()) {
       // Grab some useful references.
-      Problem_Smallest_input_t & input = prob_utils_Smallest.cur_eval_test_org->GetGenome(); // std::pair<int, double>
-      hardware_t::CallState & state = eval_hardware->GetCurCallState();
+      Problem_Smallest_input_t & input = GetEvalUtils(prob_utils_Smallest).cur_eval_test_org->GetGenome(); // std::pair<int, double>
+      hardware_t::CallState & state = GetEvalHardware().GetCurCallState();
       hardware_t::Memory & wmem = state.GetWorkingMem();
       // Set hardware input.
       wmem.Set(0, input[0]);
@@ -7001,62 +7314,7 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
   });
 
   // Tell experiment how to snapshot test population.
-  SnapshotTests = [this]() {
-    std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(prog_world->GetUpdate());
-    mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-    
-    emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)prog_world->GetUpdate()) + ".csv");
-    // Test file contents:
-    // - test id
-    std::function<size_t(void)> get_test_id = [this]() { return stats_util.cur_testID; };
-    file.AddFun(get_test_id, "test_id");
-
-    // - test fitness
-    std::function<double(void)> get_test_fitness = [this]() { return prob_Smallest_world->CalcFitnessID(stats_util.cur_testID); };
-    file.AddFun(get_test_fitness, "fitness");
-
-    // - num passes
-    std::function<size_t(void)> get_test_num_passes = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_passes; };
-    file.AddFun(get_test_num_passes, "num_passes");
-
-    // - num fails
-    std::function<size_t(void)> get_test_num_fails = [this]() { return GetTestPhenotype(stats_util.cur_testID).num_fails; };
-    file.AddFun(get_test_num_fails, "num_fails");
-
-    std::function<size_t(void)> get_num_tested = [this]() { return GetTestPhenotype(stats_util.cur_testID).test_passes.size(); };
-    file.AddFun(get_num_tested, "num_programs_tested_against");
-
-    // - test scores by program
-    std::function<std::string(void)> get_passes_by_program = [this]() {
-      std::string scores = "\"[";
-      test_org_phen_t & phen = GetTestPhenotype(stats_util.cur_testID);
-      for (size_t i = 0; i < phen.test_passes.size(); ++i) {
-        if (i) scores += ",";
-        scores += emp::to_string(phen.test_passes[i]);
-      }
-      scores += "]\"";
-      return scores;
-    };
-    file.AddFun(get_passes_by_program, "passes_by_program");
-
-    // - test
-    std::function<std::string(void)> get_test = [this]() {
-      std::ostringstream stream;
-      stream << "\"";
-      prob_Smallest_world->GetOrg(stats_util.cur_testID).Print(stream);
-      stream << "\"";
-      return stream.str();
-    };
-    file.AddFun(get_test, "test", "");
-
-    file.PrintHeaderKeys();
-
-    // Loop over tests, snapshotting each.
-    for (stats_util.cur_testID = 0; stats_util.cur_testID < prob_Smallest_world->GetSize(); ++stats_util.cur_testID) {
-      if (!prob_Smallest_world->IsOccupied(stats_util.cur_testID)) continue;
-      file.Update();
-    }
-  };
+  SnapshotTests = [this]() { SnapshotTestPop(*prob_Smallest_world); };
 
   // Add default instructions to instruction set.
   AddDefaultInstructions({"Add",
@@ -7135,7 +7393,7 @@ void ProgramSynthesisExperiment::SetupProblem_Smallest() {
 }
 
 void ProgramSynthesisExperiment::SetupProblem_Syllables() { 
-  std::cout << "Problem setup not yet implemented... Exiting." << std::endl;
+  ExpLog() << "Problem setup not yet implemented... Exiting." << std::endl;
   exit(-1); 
 }
 
@@ -7149,8 +7407,8 @@ void ProgramSynthesisExperiment::Inst_LoadInt_NumberIO(hardware_t & hw, const in
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_NumberIO.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_NumberIO.cur_eval_test_org->GetTestIntegerInput());
+  emp_assert(GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org->GetTestIntegerInput());
 }
 
 void ProgramSynthesisExperiment::Inst_LoadDouble_NumberIO(hardware_t & hw, const inst_t & inst) {
@@ -7161,8 +7419,8 @@ void ProgramSynthesisExperiment::Inst_LoadDouble_NumberIO(hardware_t & hw, const
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_NumberIO.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_NumberIO.cur_eval_test_org->GetTestDoubleInput());
+  emp_assert(GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org->GetTestDoubleInput());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_NumberIO(hardware_t & hw, const inst_t & inst) {
@@ -7173,8 +7431,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_NumberIO(hardware_t & hw, const
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_NumberIO.cur_eval_test_org != nullptr);
-  prob_utils_NumberIO.Submit(wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_NumberIO).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_NumberIO).Submit(wmem.AccessVal(posA).GetNum());
 }
 
 // ----- SmallOrLarge -----
@@ -7186,20 +7444,20 @@ void ProgramSynthesisExperiment::Inst_LoadInt_SmallOrLarge(hardware_t & hw, cons
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_SmallOrLarge.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_SmallOrLarge.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_SmallOrLarge).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_SmallOrLarge).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitSmall_SmallOrLarge(hardware_t & hw, const inst_t & inst) {
-  prob_utils_SmallOrLarge.Submit("small");
+  GetEvalUtils(prob_utils_SmallOrLarge).Submit("small");
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitLarge_SmallOrLarge(hardware_t & hw, const inst_t & inst) {
-  prob_utils_SmallOrLarge.Submit("large");
+  GetEvalUtils(prob_utils_SmallOrLarge).Submit("large");
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNone_SmallOrLarge(hardware_t & hw, const inst_t & inst) {
-  prob_utils_SmallOrLarge.Submit("");
+  GetEvalUtils(prob_utils_SmallOrLarge).Submit("");
 }
 
 // ----- ForLoopIndex -----
@@ -7211,8 +7469,8 @@ void ProgramSynthesisExperiment::Inst_LoadStart_ForLoopIndex(hardware_t & hw, co
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_ForLoopIndex.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_ForLoopIndex.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadEnd_ForLoopIndex(hardware_t & hw, const inst_t & inst) {
@@ -7223,8 +7481,8 @@ void ProgramSynthesisExperiment::Inst_LoadEnd_ForLoopIndex(hardware_t & hw, cons
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_ForLoopIndex.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_ForLoopIndex.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadStep_ForLoopIndex(hardware_t & hw, const inst_t & inst) {
@@ -7235,8 +7493,8 @@ void ProgramSynthesisExperiment::Inst_LoadStep_ForLoopIndex(hardware_t & hw, con
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_ForLoopIndex.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_ForLoopIndex.cur_eval_test_org->GetGenome()[2]);
+  emp_assert(GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org->GetGenome()[2]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_ForLoopIndex(hardware_t & hw, const inst_t & inst) {
@@ -7247,8 +7505,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_ForLoopIndex(hardware_t & hw, co
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_ForLoopIndex.cur_eval_test_org != nullptr);
-  prob_utils_ForLoopIndex.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_ForLoopIndex).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_ForLoopIndex).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- CompareStringLengths -----
@@ -7260,8 +7518,8 @@ void ProgramSynthesisExperiment::Inst_LoadStr1_CompareStringLengths(hardware_t &
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CompareStringLengths.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_CompareStringLengths.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadStr2_CompareStringLengths(hardware_t & hw, const inst_t & inst) {
@@ -7272,8 +7530,8 @@ void ProgramSynthesisExperiment::Inst_LoadStr2_CompareStringLengths(hardware_t &
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CompareStringLengths.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_CompareStringLengths.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadStr3_CompareStringLengths(hardware_t & hw, const inst_t & inst) {
@@ -7284,18 +7542,18 @@ void ProgramSynthesisExperiment::Inst_LoadStr3_CompareStringLengths(hardware_t &
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CompareStringLengths.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_CompareStringLengths.cur_eval_test_org->GetGenome()[2]);
+  emp_assert(GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org->GetGenome()[2]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitTrue_CompareStringLengths(hardware_t & hw, const inst_t & inst) {
-  emp_assert(prob_utils_CompareStringLengths.cur_eval_test_org != nullptr);
-  prob_utils_CompareStringLengths.Submit(true);
+  emp_assert(GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_CompareStringLengths).Submit(true);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitFalse_CompareStringLengths(hardware_t & hw, const inst_t & inst) {
-  emp_assert(prob_utils_CompareStringLengths.cur_eval_test_org != nullptr);
-  prob_utils_CompareStringLengths.Submit(false);
+  emp_assert(GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_CompareStringLengths).Submit(false);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitVal_CompareStringLengths(hardware_t & hw, const inst_t & inst) {
@@ -7306,8 +7564,8 @@ void ProgramSynthesisExperiment::Inst_SubmitVal_CompareStringLengths(hardware_t
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CompareStringLengths.cur_eval_test_org != nullptr);
-  prob_utils_CompareStringLengths.Submit((bool)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_CompareStringLengths).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_CompareStringLengths).Submit((bool)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- CollatzNumbers -----
@@ -7319,8 +7577,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum_CollatzNumbers(hardware_t & hw, co
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CollatzNumbers.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_CollatzNumbers.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_CollatzNumbers).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_CollatzNumbers).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_CollatzNumbers(hardware_t & hw, const inst_t & inst) {
@@ -7331,8 +7589,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_CollatzNumbers(hardware_t & hw,
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CollatzNumbers.cur_eval_test_org != nullptr);
-  prob_utils_CollatzNumbers.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_CollatzNumbers).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_CollatzNumbers).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- StringLengthsBackwards -----
@@ -7344,8 +7602,8 @@ void ProgramSynthesisExperiment::Inst_LoadStrVec_StringLengthsBackwards(hardware
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_StringLengthsBackwards.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_StringLengthsBackwards.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_StringLengthsBackwards).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_StringLengthsBackwards).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitVal_StringLengthsBackwards(hardware_t & hw, const inst_t & inst) {
@@ -7356,8 +7614,8 @@ void ProgramSynthesisExperiment::Inst_SubmitVal_StringLengthsBackwards(hardware_
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_StringLengthsBackwards.cur_eval_test_org != nullptr);
-  prob_utils_StringLengthsBackwards.Submit((size_t)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_StringLengthsBackwards).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_StringLengthsBackwards).Submit((size_t)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- LastIndexOfZero -----
@@ -7369,8 +7627,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec_LastIndexOfZero(hardware_t & hw, c
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_LastIndexOfZero.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_LastIndexOfZero.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_LastIndexOfZero).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_LastIndexOfZero).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_LastIndexOfZero(hardware_t & hw, const inst_t & inst) {
@@ -7381,8 +7639,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_LastIndexOfZero(hardware_t & hw,
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_LastIndexOfZero.cur_eval_test_org != nullptr);
-  prob_utils_LastIndexOfZero.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_LastIndexOfZero).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_LastIndexOfZero).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // ---- CountOdds -----
@@ -7394,8 +7652,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec_CountOdds(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CountOdds.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_CountOdds.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_CountOdds).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_CountOdds).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_CountOdds(hardware_t & hw, const inst_t & inst) {
@@ -7406,8 +7664,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_CountOdds(hardware_t & hw, const
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_CountOdds.cur_eval_test_org != nullptr);
-  prob_utils_CountOdds.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_CountOdds).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_CountOdds).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- Mirror Image -----
@@ -7419,8 +7677,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec1_MirrorImage(hardware_t & hw, cons
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_MirrorImage.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_MirrorImage.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadVec2_MirrorImage(hardware_t & hw, const inst_t & inst) {
@@ -7431,8 +7689,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec2_MirrorImage(hardware_t & hw, cons
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_MirrorImage.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_MirrorImage.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitVal_MirrorImage(hardware_t & hw, const inst_t & inst) {
@@ -7443,16 +7701,16 @@ void ProgramSynthesisExperiment::Inst_SubmitVal_MirrorImage(hardware_t & hw, con
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_MirrorImage.cur_eval_test_org != nullptr);
-  prob_utils_MirrorImage.Submit((bool)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_MirrorImage).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_MirrorImage).Submit((bool)wmem.AccessVal(posA).GetNum());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitTrue_MirrorImage(hardware_t & hw, const inst_t & inst) {
-  prob_utils_MirrorImage.Submit(true);
+  GetEvalUtils(prob_utils_MirrorImage).Submit(true);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitFalse_MirrorImage(hardware_t & hw, const inst_t & inst) {
-  prob_utils_MirrorImage.Submit(false);
+  GetEvalUtils(prob_utils_MirrorImage).Submit(false);
 }
 
 // ----- VectorsSummed -----
@@ -7464,8 +7722,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec1_VectorsSummed(hardware_t & hw, co
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_VectorsSummed.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_VectorsSummed.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadVec2_VectorsSummed(hardware_t & hw, const inst_t & inst) {
@@ -7476,8 +7734,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec2_VectorsSummed(hardware_t & hw, co
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_VectorsSummed.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_VectorsSummed.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitVec_VectorsSummed(hardware_t & hw, const inst_t & inst) {
@@ -7488,7 +7746,7 @@ void ProgramSynthesisExperiment::Inst_SubmitVec_VectorsSummed(hardware_t & hw, c
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::VEC);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_VectorsSummed.cur_eval_test_org != nullptr);
+  emp_assert(GetEvalUtils(prob_utils_VectorsSummed).cur_eval_test_org != nullptr);
   const emp::vector<hardware_t::MemoryValue> & vec = wmem.AccessVec(posA);
   emp::vector<int> output;
   for (size_t i = 0; i < vec.size(); ++i) {
@@ -7496,7 +7754,7 @@ void ProgramSynthesisExperiment::Inst_SubmitVec_VectorsSummed(hardware_t & hw, c
       output.emplace_back((int)vec[i].GetNum());
     }
   }
-  prob_utils_VectorsSummed.Submit(output); 
+  GetEvalUtils(prob_utils_VectorsSummed).Submit(output); 
 }
 
 // ----- Sum Of Squares -----
@@ -7508,8 +7766,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum_SumOfSquares(hardware_t & hw, cons
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_SumOfSquares.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_SumOfSquares.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_SumOfSquares).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_SumOfSquares).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_SumOfSquares(hardware_t & hw, const inst_t & inst) {
@@ -7520,8 +7778,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_SumOfSquares(hardware_t & hw, co
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_SumOfSquares.cur_eval_test_org != nullptr);
-  prob_utils_SumOfSquares.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_SumOfSquares).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_SumOfSquares).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- VectorAverage ------
@@ -7533,8 +7791,8 @@ void ProgramSynthesisExperiment::Inst_LoadVec_VectorAverage(hardware_t & hw, con
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_VectorAverage.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_VectorAverage.cur_eval_test_org->GetGenome());
+  emp_assert(GetEvalUtils(prob_utils_VectorAverage).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_VectorAverage).cur_eval_test_org->GetGenome());
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_VectorAverage(hardware_t & hw, const inst_t & inst) {
@@ -7545,8 +7803,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_VectorAverage(hardware_t & hw, c
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_VectorAverage.cur_eval_test_org != nullptr);
-  prob_utils_VectorAverage.Submit((double)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_VectorAverage).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_VectorAverage).Submit((double)wmem.AccessVal(posA).GetNum());
 }
 
 
@@ -7559,8 +7817,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum1_Median(hardware_t & hw, const ins
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Median.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Median.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_Median).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Median).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadNum2_Median(hardware_t & hw, const inst_t & inst) {
@@ -7571,8 +7829,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum2_Median(hardware_t & hw, const ins
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Median.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Median.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_Median).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Median).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadNum3_Median(hardware_t & hw, const inst_t & inst) {
@@ -7583,8 +7841,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum3_Median(hardware_t & hw, const ins
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Median.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Median.cur_eval_test_org->GetGenome()[2]);
+  emp_assert(GetEvalUtils(prob_utils_Median).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Median).cur_eval_test_org->GetGenome()[2]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_Median(hardware_t & hw, const inst_t & inst) {
@@ -7595,8 +7853,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_Median(hardware_t & hw, const in
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Median.cur_eval_test_org != nullptr);
-  prob_utils_Median.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_Median).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_Median).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // ----- Smallest -----
@@ -7608,8 +7866,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum1_Smallest(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Smallest.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Smallest.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_Smallest).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Smallest).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadNum2_Smallest(hardware_t & hw, const inst_t & inst) {
@@ -7620,8 +7878,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum2_Smallest(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Smallest.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Smallest.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_Smallest).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Smallest).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadNum3_Smallest(hardware_t & hw, const inst_t & inst) {
@@ -7632,8 +7890,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum3_Smallest(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Smallest.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Smallest.cur_eval_test_org->GetGenome()[2]);
+  emp_assert(GetEvalUtils(prob_utils_Smallest).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Smallest).cur_eval_test_org->GetGenome()[2]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadNum4_Smallest(hardware_t & hw, const inst_t & inst) {
@@ -7644,8 +7902,8 @@ void ProgramSynthesisExperiment::Inst_LoadNum4_Smallest(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Smallest.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Smallest.cur_eval_test_org->GetGenome()[3]);
+  emp_assert(GetEvalUtils(prob_utils_Smallest).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Smallest).cur_eval_test_org->GetGenome()[3]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitNum_Smallest(hardware_t & hw, const inst_t & inst) {
@@ -7656,8 +7914,8 @@ void ProgramSynthesisExperiment::Inst_SubmitNum_Smallest(hardware_t & hw, const
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity(), hardware_t::MemPosType::NUM);
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Smallest.cur_eval_test_org != nullptr);
-  prob_utils_Smallest.Submit((int)wmem.AccessVal(posA).GetNum());
+  emp_assert(GetEvalUtils(prob_utils_Smallest).cur_eval_test_org != nullptr);
+  GetEvalUtils(prob_utils_Smallest).Submit((int)wmem.AccessVal(posA).GetNum());
 }
 
 // --- Grade ---
@@ -7669,8 +7927,8 @@ void ProgramSynthesisExperiment::Inst_LoadThreshA_Grade(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Grade.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Grade.cur_eval_test_org->GetGenome()[0]);
+  emp_assert(GetEvalUtils(prob_utils_Grade).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Grade).cur_eval_test_org->GetGenome()[0]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadThreshB_Grade(hardware_t & hw, const inst_t & inst) {
@@ -7681,8 +7939,8 @@ void ProgramSynthesisExperiment::Inst_LoadThreshB_Grade(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Grade.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Grade.cur_eval_test_org->GetGenome()[1]);
+  emp_assert(GetEvalUtils(prob_utils_Grade).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Grade).cur_eval_test_org->GetGenome()[1]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadThreshC_Grade(hardware_t & hw, const inst_t & inst) {
@@ -7693,8 +7951,8 @@ void ProgramSynthesisExperiment::Inst_LoadThreshC_Grade(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Grade.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Grade.cur_eval_test_org->GetGenome()[2]);
+  emp_assert(GetEvalUtils(prob_utils_Grade).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Grade).cur_eval_test_org->GetGenome()[2]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadThreshD_Grade(hardware_t & hw, const inst_t & inst) {
@@ -7705,8 +7963,8 @@ void ProgramSynthesisExperiment::Inst_LoadThreshD_Grade(hardware_t & hw, const i
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Grade.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Grade.cur_eval_test_org->GetGenome()[3]);
+  emp_assert(GetEvalUtils(prob_utils_Grade).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Grade).cur_eval_test_org->GetGenome()[3]);
 }
 
 void ProgramSynthesisExperiment::Inst_LoadGrade_Grade(hardware_t & hw, const inst_t & inst) {
@@ -7717,28 +7975,28 @@ void ProgramSynthesisExperiment::Inst_LoadGrade_Grade(hardware_t & hw, const ins
   size_t posA = hw.FindBestMemoryMatch(wmem, inst.arg_tags[0], hw.GetMinTagSpecificity());
   if (!hw.IsValidMemPos(posA)) return;
 
-  emp_assert(prob_utils_Grade.cur_eval_test_org != nullptr);
-  wmem.Set(posA, prob_utils_Grade.cur_eval_test_org->GetGenome()[4]);
+  emp_assert(GetEvalUtils(prob_utils_Grade).cur_eval_test_org != nullptr);
+  wmem.Set(posA, GetEvalUtils(prob_utils_Grade).cur_eval_test_org->GetGenome()[4]);
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitA_Grade(hardware_t & hw, const inst_t & inst) {
-  prob_utils_Grade.Submit("A");
+  GetEvalUtils(prob_utils_Grade).Submit("A");
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitB_Grade(hardware_t & hw, const inst_t & inst) {
-  prob_utils_Grade.Submit("B");
+  GetEvalUtils(prob_utils_Grade).Submit("B");
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitC_Grade(hardware_t & hw, const inst_t & inst) {
-  prob_utils_Grade.Submit("C");
+  GetEvalUtils(prob_utils_Grade).Submit("C");
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitD_Grade(hardware_t & hw, const inst_t & inst) {
-  prob_utils_Grade.Submit("D");
+  GetEvalUtils(prob_utils_Grade).Submit("D");
 }
 
 void ProgramSynthesisExperiment::Inst_SubmitF_Grade(hardware_t & hw, const inst_t & inst) {
-  prob_utils_Grade.Submit("F");
+  GetEvalUtils(prob_utils_Grade).Submit("F");
 }
 
 // ------------------------
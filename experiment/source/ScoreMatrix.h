@@ -0,0 +1,101 @@
+#ifndef SCORE_MATRIX_H
+#define SCORE_MATRIX_H
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+/// Read-only view of one organism's scores against its antagonists: a row of a ScoreMatrix (for
+/// the population indexing its rows) or a strided column (for the antagonist population).
+template<typename T>
+class ScoreView {
+protected:
+  const T * data;
+  size_t count;
+  size_t stride;
+
+public:
+  ScoreView() : data(nullptr), count(0), stride(1) { ; }
+  ScoreView(const T * _data, size_t _count, size_t _stride=1)
+    : data(_data), count(_count), stride(_stride) { ; }
+
+  /// count zeros (e.g., for organisms left out of an evaluation).
+  static ScoreView Zeros(size_t count) {
+    static const T zero = T();
+    return ScoreView(&zero, count, 0);
+  }
+
+  size_t size() const { return count; }
+  bool empty() const { return !count; }
+
+  const T & operator[](size_t id) const {
+    emp_assert(id < count, id, count);
+    return data[id * stride];
+  }
+
+  T Sum() const {
+    T total = T();
+    for (size_t i = 0; i < count; ++i) total += data[i * stride];
+    return total;
+  }
+
+  /// Copy of the scores (for anything that outlives the current evaluation, e.g. snapshots).
+  emp::vector<T> ToVector() const {
+    emp::vector<T> vals(count);
+    for (size_t i = 0; i < count; ++i) vals[i] = data[i * stride];
+    return vals;
+  }
+};
+
+/// Scores of one population (rows) against another (columns), e.g., network pass counts against
+/// each test, stored row-major in one flat array owned by the experiment.
+/// - Phenotypes hold ScoreViews into the matrix instead of their own score vectors: births
+///   allocate nothing, and each evaluation is recorded once (the antagonist's scores are a column
+///   of the same matrix).
+/// - Views are bound when organisms are evaluated and stay valid until the matrix is resized.
+///   Rows are overwritten by the next evaluation, so anything that outlives the generation (e.g.,
+///   snapshots) should copy its scores (ScoreView::ToVector).
+template<typename T>
+class ScoreMatrix {
+protected:
+  size_t num_rows;
+  size_t num_cols;
+  emp::vector<T> scores;
+
+public:
+  ScoreMatrix() : num_rows(0), num_cols(0), scores() { ; }
+
+  size_t GetNumRows() const { return num_rows; }
+  size_t GetNumCols() const { return num_cols; }
+
+  /// Set dimensions (values are overwritten by the next evaluation). Does nothing (and keeps
+  /// views valid) if the dimensions are unchanged.
+  void Resize(size_t rows, size_t cols) {
+    if (rows == num_rows && cols == num_cols) return;
+    num_rows = rows;
+    num_cols = cols;
+    scores.assign(rows * cols, T());
+  }
+
+  T & operator()(size_t row, size_t col) {
+    emp_assert(row < num_rows && col < num_cols, row, col, num_rows, num_cols);
+    return scores[row * num_cols + col];
+  }
+  const T & operator()(size_t row, size_t col) const {
+    emp_assert(row < num_rows && col < num_cols, row, col, num_rows, num_cols);
+    return scores[row * num_cols + col];
+  }
+
+  ScoreView<T> GetRow(size_t row) const {
+    emp_assert(row < num_rows, row, num_rows);
+    return ScoreView<T>(scores.data() + row * num_cols, num_cols);
+  }
+
+  /// Column col, restricted to rows [row_begin, row_begin + count) (e.g., one cohort's rows).
+  ScoreView<T> GetColumn(size_t col, size_t row_begin, size_t count) const {
+    emp_assert(col < num_cols && row_begin + count <= num_rows, col, row_begin, count, num_rows);
+    return ScoreView<T>(scores.data() + row_begin * num_cols + col, count, num_cols);
+  }
+  ScoreView<T> GetColumn(size_t col) const { return GetColumn(col, 0, num_rows); }
+};
+
+#endif
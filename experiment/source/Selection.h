@@ -1,7 +1,10 @@
 #ifndef ALEX_SELECTION_H
 #define ALEX_SELECTION_H
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <utility>
 
 #include "base/assert.h"
 #include "base/vector.h"
@@ -12,18 +15,57 @@
 namespace emp {
   template<typename ORG> class World;
 
+  /// Weighted random permutation (weighted sampling without replacement). Higher-weight
+  /// indices tend to come earlier in the ordering. All weights must be positive.
+  inline emp::vector<size_t> GetWeightedPermutation(Random & rnd, const emp::vector<double> & weights) {
+    emp::vector<std::pair<double, size_t>> keys(weights.size());
+    for (size_t i = 0; i < weights.size(); ++i) {
+      emp_assert(weights[i] > 0, i, weights[i]);
+      keys[i] = {std::log(1.0 - rnd.GetDouble()) / weights[i], i};
+    }
+    std::sort(keys.begin(), keys.end(), [](const std::pair<double, size_t> & a, const std::pair<double, size_t> & b) {
+      return a.first > b.first;
+    });
+    emp::vector<size_t> order(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) order[i] = keys[i].second;
+    return order;
+  }
+
+  /// count random indices drawn with probability proportional to weight (weighted sampling with
+  /// replacement). All weights must be positive.
+  inline emp::vector<size_t> GetWeightedSample(Random & rnd, const emp::vector<double> & weights, size_t count) {
+    emp::vector<double> totals(weights.size());
+    double total = 0.0;
+    for (size_t i = 0; i < weights.size(); ++i) {
+      emp_assert(weights[i] > 0, i, weights[i]);
+      total += weights[i];
+      totals[i] = total;
+    }
+    emp::vector<size_t> sample(count);
+    for (size_t & id : sample) {
+      id = (size_t)(std::upper_bound(totals.begin(), totals.end(), rnd.GetDouble() * total) - totals.begin());
+      if (id == totals.size()) id = totals.size() - 1;
+    }
+    return sample;
+  }
+
   /// NOTE: This method was a copy-pasta version of the Empirical lexicase select.
   /// - Needed to modify internals to support experiment
+  /// - If case_weights is given (one per fitness function), case orderings are biased by
+  ///   weight (see GetWeightedPermutation) instead of uniformly shuffled. As with uniform
+  ///   orderings, limited orderings (max_funs) are sampled with replacement (GetWeightedSample).
   template<typename ORG>
   void LexicaseSelect_NAIVE(World<ORG> & world,
                       const emp::vector< std::function<double(ORG &)> > & fit_funs,
                       size_t repro_count=1,
                       size_t max_funs=0,
                       const std::function<void(size_t)> & on_lex_test_sel = [](size_t){ ; },
-                      const std::function<void(size_t)> & on_lex_repro = [](size_t) { ; })
+                      const std::function<void(size_t)> & on_lex_repro = [](size_t) { ; },
+                      const emp::vector<double> & case_weights = emp::vector<double>())
   {
     emp_assert(world.GetSize() > 0);
     emp_assert(fit_funs.size() > 0);
+    emp_assert(case_weights.size() == 0 || case_weights.size() == fit_funs.size(), case_weights.size(), fit_funs.size());
 
     // std::cout << "=======Lexicase selection! (update: "<< world.GetUpdate() <<")=======" << std::endl;
 
@@ -48,7 +90,10 @@ namespace emp {
       // Determine the current ordering of the functions.
       emp::vector<size_t> order;
 
-      if (max_funs == fit_funs.size()) {
+      if (case_weights.size()) {
+        if (max_funs == fit_funs.size()) order = GetWeightedPermutation(world.GetRandom(), case_weights);
+        else order = GetWeightedSample(world.GetRandom(), case_weights, max_funs);
+      } else if (max_funs == fit_funs.size()) {
         order = GetPermutation(world.GetRandom(), fit_funs.size());
       } else {
         order.resize(max_funs); // We want to limit the total numebr of tests done.
@@ -0,0 +1,67 @@
+#ifndef SITE_SAMPLER_H
+#define SITE_SAMPLER_H
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "tools/Random.h"
+
+/// Picks which sites (genes, instructions, bits, ...) a per-site mutation hits by skipping ahead
+/// geometrically distributed gaps, so a mutator draws random numbers per mutation rather than per site.
+/// - Each site is still hit independently with probability prob (the same distribution as calling
+///   rnd.P(prob) once per site), but the random number stream differs from per-site draws.
+/// - Sites are numbered by the caller and must be visited in increasing order. Sites the caller
+///   jumps over (e.g., deleted genes) are treated as if they were never there.
+class SiteSampler {
+public:
+  static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+protected:
+  double prob;
+  double log_miss;  ///< log(1 - prob)
+  size_t next;      ///< Next site to hit (NONE if there are no more hits).
+
+  /// Number of sites to skip before the next hit.
+  size_t Skip(emp::Random & rnd) const {
+    if (prob <= 0.0) return NONE;
+    if (prob >= 1.0) return 0;
+    const double gap = std::floor(std::log(1.0 - rnd.GetDouble()) / log_miss);
+    return (gap < (double)NONE) ? (size_t)gap : NONE;
+  }
+
+  /// Next hit at or after site from.
+  size_t Advance(emp::Random & rnd, size_t from) const {
+    const size_t skip = Skip(rnd);
+    return (skip >= NONE - from) ? NONE : from + skip;
+  }
+
+public:
+  SiteSampler() : prob(0.0), log_miss(0.0), next(NONE) { ; }
+
+  /// Start sampling (from site 0) with per-site probability _prob.
+  void Start(emp::Random & rnd, double _prob) {
+    prob = _prob;
+    log_miss = (prob > 0.0 && prob < 1.0) ? std::log1p(-prob) : 0.0;
+    next = Advance(rnd, 0);
+  }
+
+  /// Next site to hit (NONE if there are no more hits).
+  size_t Next() const { return next; }
+
+  /// Consume the current hit; returns the next site to hit.
+  size_t Take(emp::Random & rnd) { next = Advance(rnd, next + 1); return next; }
+
+  /// Jump to site pos (sites before pos are never hit).
+  void SkipTo(emp::Random & rnd, size_t pos) { if (next < pos) next = Advance(rnd, pos); }
+
+  /// Is site pos hit? (Consumes the hit.)
+  bool Hit(emp::Random & rnd, size_t pos) {
+    SkipTo(rnd, pos);
+    if (next != pos) return false;
+    Take(rnd);
+    return true;
+  }
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef SNAPSHOT_WRITER_H
+#define SNAPSHOT_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <utility>
+
+#include "Instrumentation.h"
+
+/// Runs snapshot jobs (formatting + writing population snapshots) on a background thread.
+/// - The main thread captures an immutable image of whatever it wants written and submits a
+///   job that owns (or shares) that image; the job does all of the formatting and file IO.
+/// - The job queue is bounded: Submit blocks while the queue is full (back-pressure), so a
+///   writer that can't keep up slows the run down rather than accumulating images in memory.
+/// - Jobs run in submission order.
+/// - A capacity of 0 runs jobs synchronously (on the calling thread) inside Submit.
+class SnapshotWriter {
+public:
+  using job_t = std::function<void(void)>;
+
+protected:
+  size_t capacity;
+
+  std::thread worker;
+  std::mutex mtx;
+  std::condition_variable cv;
+
+  std::deque<job_t> jobs;
+  bool busy;       ///< Is the worker currently running a job?
+  bool stopping;   ///< Has the worker been asked to exit (once the queue is drained)?
+
+  void Work() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+      cv.wait(lock, [this]() { return jobs.size() || stopping; });
+      if (jobs.empty()) break; // Stopping, and nothing left to do.
+      job_t job(std::move(jobs.front()));
+      jobs.pop_front();
+      busy = true;
+      cv.notify_all(); // Room in the queue.
+      lock.unlock();
+      job();
+      lock.lock();
+      busy = false;
+      cv.notify_all();
+    }
+  }
+
+  void Stop() {
+    if (!worker.joinable()) return;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stopping = true;
+    }
+    cv.notify_all();
+    worker.join();
+    stopping = false;
+  }
+
+public:
+  SnapshotWriter(size_t _capacity=2)
+    : capacity(_capacity), worker(), mtx(), cv(), jobs(), busy(false), stopping(false) { ; }
+
+  SnapshotWriter(const SnapshotWriter &) = delete;
+  SnapshotWriter & operator=(const SnapshotWriter &) = delete;
+
+  /// Finishes all queued jobs before returning.
+  ~SnapshotWriter() { Stop(); }
+
+  size_t GetCapacity() const { return capacity; }
+
+  /// Set maximum number of queued (not yet started) jobs. Waits for outstanding jobs first.
+  void SetCapacity(size_t _capacity) { Wait(); capacity = _capacity; }
+
+  /// Queue job to run in the background. Blocks while the queue is full.
+  void Submit(job_t && job) {
+    if (!capacity) { job(); return; }
+    if (!worker.joinable()) worker = std::thread(InstrumentThread([this]() { Work(); }));
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this]() { return jobs.size() < capacity; });
+    jobs.emplace_back(std::move(job));
+    cv.notify_all();
+  }
+
+  /// Block until every submitted job has finished.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this]() { return jobs.empty() && !busy; });
+  }
+
+  /// Create a snapshot directory (if it doesn't already exist). For use inside snapshot jobs.
+  static void MakeDir(const std::string & dir) { mkdir(dir.c_str(), ACCESSPERMS); }
+};
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef SOLUTION_SCREENER_H
+#define SOLUTION_SCREENER_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+#include "Instrumentation.h"
+
+/// Verifies solution candidates (exhaustive correctness checks) on background worker threads so
+/// that the generation loop never waits on verification.
+/// - The main thread submits candidate records (whatever it wants reported about a candidate,
+///   captured when the candidate is first seen) along with a genome hash. Each unique genome is
+///   queued for verification once.
+/// - The queue is bounded. Submit never blocks: when the queue is full, the candidate is dropped
+///   (and not marked as seen, so it is queued again if it shows up in a later generation).
+/// - Each worker verifies with its own verifier (from make_verifier), so verifiers may keep mutable
+///   state (e.g., test orderings) without locking.
+/// - Workers take every queued candidate at once. Batch verifiers (see ConfigureBatched) verify
+///   them together, e.g., in a single pass over a testing set streamed from disk.
+/// - The main thread collects confirmed solutions with Drain, which never waits: it returns
+///   whatever has been confirmed so far.
+/// - GetState/SetState save and restore what has been screened (for checkpoints).
+/// - With 0 threads, queued candidates are verified (as one batch) on the calling thread by the
+///   next Drain or Wait.
+template<typename RECORD_T>
+class SolutionScreener {
+public:
+  using record_t = RECORD_T;
+  using verify_t = std::function<bool(const record_t &)>;
+  using make_verifier_t = std::function<verify_t(void)>;
+  using verify_batch_t = std::function<emp::vector<bool>(const emp::vector<record_t> &)>;  ///< One result per record.
+  using make_batch_verifier_t = std::function<verify_batch_t(void)>;
+
+protected:
+  size_t num_threads;
+  size_t capacity;
+  size_t max_rejected;                    ///< Forget rejected hashes past this many (0 for no limit).
+  verify_batch_t sync_verifier;           ///< Used when num_threads is 0.
+
+  emp::vector<std::thread> workers;
+  std::mutex mtx;
+  std::condition_variable cv;
+
+  std::deque<std::pair<uint64_t, record_t>> queue;  ///< Queued candidates (and their hashes).
+  emp::vector<record_t> confirmed;        ///< Confirmed since last Drain.
+  std::unordered_set<uint64_t> queued;    ///< Hashes of queued/in-progress candidates.
+  std::unordered_set<uint64_t> accepted;  ///< Hashes of confirmed solutions.
+  std::unordered_set<uint64_t> rejected;  ///< Hashes of candidates that failed verification.
+  size_t busy;                            ///< Number of candidates being verified.
+  size_t dropped;                         ///< Number of candidates dropped because the queue was full.
+  bool stopping;
+
+  void Record(uint64_t hash, record_t && rec, bool correct) {
+    if (correct) {
+      accepted.insert(hash);
+      confirmed.emplace_back(std::move(rec));
+    } else {
+      if (max_rejected && rejected.size() >= max_rejected) rejected.clear();
+      rejected.insert(hash);
+    }
+  }
+
+  /// Verify every queued candidate as one batch. Called (and returns) with lock held.
+  void VerifyQueued(std::unique_lock<std::mutex> & lock, const verify_batch_t & verify) {
+    emp::vector<uint64_t> hashes;
+    emp::vector<record_t> batch;
+    hashes.reserve(queue.size());
+    batch.reserve(queue.size());
+    for (auto & job : queue) {
+      hashes.emplace_back(job.first);
+      batch.emplace_back(std::move(job.second));
+    }
+    queue.clear();
+    busy += batch.size();
+    lock.unlock();
+    const emp::vector<bool> correct(verify(batch));
+    emp_assert(correct.size() == batch.size());
+    lock.lock();
+    for (size_t i = 0; i < batch.size(); ++i) {
+      queued.erase(hashes[i]);
+      Record(hashes[i], std::move(batch[i]), correct[i]);
+    }
+    busy -= batch.size();
+  }
+
+  void Work(verify_batch_t verify) {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+      cv.wait(lock, [this]() { return queue.size() || stopping; });
+      if (queue.empty()) break; // Stopping, and nothing left to do.
+      VerifyQueued(lock, verify);
+      cv.notify_all();
+    }
+  }
+
+  void Clear() {
+    std::unique_lock<std::mutex> lock(mtx);
+    queue.clear();
+  }
+
+  void Stop() {
+    if (workers.empty()) return;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stopping = true;
+    }
+    cv.notify_all();
+    for (std::thread & worker : workers) worker.join();
+    workers.clear();
+    stopping = false;
+  }
+
+public:
+  SolutionScreener()
+    : num_threads(0), capacity(0), max_rejected(0), sync_verifier(), workers(), mtx(), cv(),
+      queue(), confirmed(), queued(), accepted(), rejected(), busy(0), dropped(0), stopping(false) { ; }
+
+  SolutionScreener(const SolutionScreener &) = delete;
+  SolutionScreener & operator=(const SolutionScreener &) = delete;
+
+  /// Discards queued candidates (waits for candidates already being verified).
+  ~SolutionScreener() { Shutdown(); }
+
+  /// Start _num_threads workers (each with a verifier from make_verifier) that verify up to
+  /// _capacity queued candidates. Discards previous results (and any still-queued candidates).
+  void Configure(size_t _num_threads, size_t _capacity, size_t _max_rejected, const make_verifier_t & make_verifier) {
+    ConfigureBatched(_num_threads, _capacity, _max_rejected, [make_verifier]() {
+      verify_t verify = make_verifier();
+      return [verify](const emp::vector<record_t> & batch) {
+        emp::vector<bool> correct(batch.size());
+        for (size_t i = 0; i < batch.size(); ++i) correct[i] = verify(batch[i]);
+        return correct;
+      };
+    });
+  }
+
+  /// Configure, with verifiers that verify a batch of candidates at a time.
+  void ConfigureBatched(size_t _num_threads, size_t _capacity, size_t _max_rejected, const make_batch_verifier_t & make_verifier) {
+    Clear();
+    Stop();
+    confirmed.clear();
+    queued.clear();
+    accepted.clear();
+    rejected.clear();
+    dropped = 0;
+    num_threads = _num_threads;
+    capacity = _capacity;
+    max_rejected = _max_rejected;
+    if (!num_threads) { sync_verifier = make_verifier(); return; }
+    sync_verifier = nullptr;
+    for (size_t i = 0; i < num_threads; ++i) {
+      workers.emplace_back(InstrumentThread([this](verify_batch_t verify) { Work(verify); }), make_verifier());
+    }
+  }
+
+  /// Discard queued candidates and stop the workers (waits for candidates already being verified),
+  /// e.g., before anything the verifiers use is destroyed.
+  void Shutdown() { Clear(); Stop(); }
+
+  size_t GetNumThreads() const { return num_threads; }
+  size_t GetNumDropped() const { return dropped; }
+
+  /// Queue a candidate for verification. Returns false if the candidate was not queued (already
+  /// seen, or the queue is full).
+  bool Submit(uint64_t hash, record_t rec) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (accepted.count(hash) || rejected.count(hash) || queued.count(hash)) return false;
+    if (queue.size() >= capacity) { ++dropped; return false; }
+    queued.insert(hash);
+    queue.emplace_back(hash, std::move(rec));
+    if (num_threads) cv.notify_one();
+    return true;
+  }
+
+  /// Take solutions confirmed since the last Drain (in the order they were confirmed). With 0
+  /// threads, verifies queued candidates first.
+  emp::vector<record_t> Drain() {
+    emp::vector<record_t> out;
+    std::unique_lock<std::mutex> lock(mtx);
+    if (!num_threads && queue.size()) VerifyQueued(lock, sync_verifier);
+    std::swap(out, confirmed);
+    return out;
+  }
+
+  /// Block until every queued candidate has been verified.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (!num_threads && queue.size()) VerifyQueued(lock, sync_verifier);
+    cv.wait(lock, [this]() { return queue.empty() && !busy; });
+  }
+
+  /// Hashes of accepted and rejected candidates (sorted), and solutions not yet drained. Waits for
+  /// queued candidates first.
+  void GetState(emp::vector<uint64_t> & _accepted, emp::vector<uint64_t> & _rejected, emp::vector<record_t> & _confirmed) {
+    Wait();
+    std::unique_lock<std::mutex> lock(mtx);
+    _accepted.assign(accepted.begin(), accepted.end());
+    _rejected.assign(rejected.begin(), rejected.end());
+    std::sort(_accepted.begin(), _accepted.end());
+    std::sort(_rejected.begin(), _rejected.end());
+    _confirmed = confirmed;
+  }
+
+  /// Restore state saved by GetState (after Configure; discards queued candidates).
+  void SetState(const emp::vector<uint64_t> & _accepted, const emp::vector<uint64_t> & _rejected, emp::vector<record_t> && _confirmed) {
+    Clear();
+    Wait();
+    std::unique_lock<std::mutex> lock(mtx);
+    queued.clear();
+    accepted = std::unordered_set<uint64_t>(_accepted.begin(), _accepted.end());
+    rejected = std::unordered_set<uint64_t>(_rejected.begin(), _rejected.end());
+    confirmed = std::move(_confirmed);
+  }
+};
+
+#endif
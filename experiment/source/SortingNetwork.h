@@ -5,13 +5,36 @@
 #include "base/vector.h"
 #include "tools/Random.h"
 
+#include "CopyOnWrite.h"
+#include "InlineVector.h"
+
+/// Compact genomes (build with -DEXP_COMPACT_GENOMES; see the compact-% make target):
+/// - Comparators are pairs of uint8_t indices, stored inline (up to EXP_COMPACT_NETWORK_CAPACITY
+///   comparators), so a network's storage is one fixed-size block (no separate buffer).
+/// - Sorting tests are binary, bit-packed into one word (up to 64 sites); see SortingTest.h.
+/// Print formats are the same either way.
+#ifndef EXP_COMPACT_NETWORK_CAPACITY
+#define EXP_COMPACT_NETWORK_CAPACITY 128
+#endif
+
 class SortingNetwork {
 public:
-  using op_t = emp::array<size_t, 2>;
+#ifdef EXP_COMPACT_GENOMES
+  using index_t = uint8_t;
+  using op_t = emp::array<index_t, 2>;
+  using network_t = InlineVector<op_t, EXP_COMPACT_NETWORK_CAPACITY>;
+  static constexpr size_t MAX_NETWORK_SIZE = EXP_COMPACT_NETWORK_CAPACITY;
+  static constexpr size_t MAX_INPUT_SIZE = 256;
+#else
+  using index_t = size_t;
+  using op_t = emp::array<index_t, 2>;
   using network_t = emp::vector<op_t>;
+  static constexpr size_t MAX_NETWORK_SIZE = (size_t)-1;
+  static constexpr size_t MAX_INPUT_SIZE = (size_t)-1;
+#endif
 
 protected:
-  network_t network;
+  CopyOnWrite<network_t> network;   ///< Shared between copies until one of them is edited.
 
 public:
   SortingNetwork() 
@@ -26,10 +49,11 @@ public:
   { RandomizeNetwork(rnd, input_size, network_size); }
 
   SortingNetwork(size_t network_size) 
-    : network(network_size) 
+    : network(network_t(network_size)) 
   { 
-    for (size_t i = 0; i < network.size(); ++i) {
-      network[i][0] = 0; network[i][1] = 0;
+    network_t & ops = network.Edit();
+    for (size_t i = 0; i < ops.size(); ++i) {
+      ops[i][0] = 0; ops[i][1] = 0;
     }
   }
 
@@ -37,23 +61,32 @@ public:
   SortingNetwork(const SortingNetwork &) = default;
 
   SortingNetwork & operator=(const SortingNetwork & in) { network = in.network; return *this; }
+  SortingNetwork & operator=(SortingNetwork && in) { network = std::move(in.network); return *this; }
 
   bool operator==(const SortingNetwork & in) const { return in.network == network; }
   bool operator!=(const SortingNetwork & in) const { return !(in == *this); }
   bool operator<(const SortingNetwork & in) const { return network < in.network; }
 
+  /// Writable comparator (copies the network first if it's shared; read through a const network
+  /// to avoid that).
   op_t & operator[](size_t id) {
-    emp_assert(id < network.size());
-    return network[id];
+    emp_assert(id < GetSize());
+    return network.Edit()[id];
   }
 
   const op_t & operator[](size_t id) const {
-    emp_assert(id < network.size());
-    return network[id];
+    emp_assert(id < GetSize());
+    return network.Get()[id];
   }
 
-  size_t GetSize() const { return network.size(); }
-  network_t & GetNetwork() { return network; }
+  size_t GetSize() const { return network.Get().size(); }
+  const network_t & GetNetwork() const { return network.Get(); }
+  /// Writable network (copied first if it's shared).
+  network_t & GetNetwork() { return network.Edit(); }
+  /// Writable network for the caller to overwrite (contents are unspecified; never copied).
+  network_t & ReplaceNetwork() { return network.Replace(); }
+  /// Do we share storage with in?
+  bool SharesNetwork(const SortingNetwork & in) const { return network.SharesWith(in.network); }
 
   void RandomizeNetwork(emp::Random & rnd, size_t input_size, size_t network_size);
   void RandomizeNetwork(emp::Random & rnd, size_t input_size, size_t min_network_size, size_t max_network_size);
@@ -67,10 +100,11 @@ public:
 
 void SortingNetwork::RandomizeNetwork(emp::Random & rnd, size_t input_size, 
                                         size_t network_size) {
-  network.resize(network_size);
-  for (size_t i = 0; i < network.size(); ++i) {
-    network[i][0] = rnd.GetUInt(0, input_size);
-    network[i][1] = rnd.GetUInt(0, input_size);
+  network_t & ops = network.Replace();
+  ops.resize(network_size);
+  for (size_t i = 0; i < ops.size(); ++i) {
+    ops[i][0] = rnd.GetUInt(0, input_size);
+    ops[i][1] = rnd.GetUInt(0, input_size);
   }
 }
 
@@ -83,25 +117,28 @@ void SortingNetwork::RandomizeNetwork(emp::Random & rnd, size_t input_size,
 bool SortingNetwork::Validate(size_t input_size, size_t min_network_size, 
                                      size_t max_network_size) const {
   if (GetSize() > max_network_size || GetSize() < min_network_size) return false;
-  for (size_t i = 0; i < network.size(); ++i) {
-    if (network[i][0] >= input_size || network[i][1] >= input_size) return false;
+  const network_t & ops = network.Get();
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (ops[i][0] >= input_size || ops[i][1] >= input_size) return false;
   }
   return true;
 }
 
 void SortingNetwork::Print(std::ostream & out, std::string op_sep) const {
+  const network_t & ops = network.Get();
   out << "[";
-  for (size_t i=0; i < network.size(); ++i) {
+  for (size_t i=0; i < ops.size(); ++i) {
     if (i) out << ",";
-    out << "(" << network[i][0] << op_sep << network[i][1] << ")";
+    out << "(" << (size_t)ops[i][0] << op_sep << (size_t)ops[i][1] << ")";
   }
   out << "]";
 }
 
 void SortingNetwork::PrintVert(std::ostream & out) const {
-  for (size_t i=0; i < network.size(); ++i) {
+  const network_t & ops = network.Get();
+  for (size_t i=0; i < ops.size(); ++i) {
     if (i) out << "\n";
-    out << network[i][0] << " <=> " << network[i][1];
+    out << (size_t)ops[i][0] << " <=> " << (size_t)ops[i][1];
   }
 } 
 
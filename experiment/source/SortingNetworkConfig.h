@@ -29,9 +29,12 @@ EMP_BUILD_CONFIG(SortingNetworkConfig,
   VALUE(PER_PAIR_INS, double, 0.0005, "Per-operation operation insertion rate"),
   VALUE(PER_PAIR_DEL, double, 0.001, "Per-operation operation deletion rate"),
   VALUE(PER_PAIR_SWAP, double, 0.001, "Per-operation operation swap rate"),
-  VALUE(NETWORK_CROSSOVER_MODE, size_t, 0, "What kind of crossover do we do? \n0: None\n1: 1 point\n2: 2 point"),
+  VALUE(NETWORK_CROSSOVER_MODE, size_t, 0, "What kind of crossover do we do? \n0: None\n1: 1 point\n2: 2 point\n3: Uniform (each gene of the shorter network's length swapped with probability 0.5)"),
   VALUE(PER_ORG_CROSSOVER, double, 0.25, "Per-organism crossover rate"),
+  VALUE(NETWORK_CROSSOVER_PAIRING, size_t, 0, "How are organisms chosen for crossover paired up? \n0: Chained (each crosses with the next, serially; reproduces earlier runs)\n1: Disjoint pairs (all crossovers planned up front, then run in parallel on REPRODUCTION_THREADS; each chosen organism crosses once)"),
+  VALUE(REPRODUCTION_THREADS, size_t, 0, "Number of worker threads for batched crossover (in addition to the main thread). Results do not depend on the number of threads."),
   VALUE(PER_ORG_MUTATION, double, 0.9, "Per-organism rate at which mutation will occur"),
+  VALUE(MUTATION_SAMPLING_MODE, size_t, 1, "How are per-site mutations placed? \n0: One random draw per site (legacy random number stream; reproduces earlier runs)\n1: Skip ahead to the next mutated site (geometric gaps; same rates, fewer random draws)"),
   
   GROUP(SORTING_TESTS, "Sorting test settings"),
   VALUE(SORT_SIZE, size_t, 16, "Size of sequences being sorted by sorting networks"),
@@ -45,11 +48,21 @@ EMP_BUILD_CONFIG(SortingNetworkConfig,
   GROUP(DATA_COLLECTION, "Settings specific to data collection"),
   VALUE(DATA_DIRECTORY, std::string, "./output", "Where to dump experiment data files"),
   VALUE(SNAPSHOT_INTERVAL, size_t, 100, "Interval to take snapshots"),
+  VALUE(SNAPSHOT_QUEUE_SIZE, size_t, 2, "How many population snapshots can be queued for the background writer? (0 to write snapshots synchronously)"),
+  VALUE(OUTPUT_FORMAT, size_t, 0, "Format for population snapshots and solution files: \n0: CSV\n1: Columnar binary (.col; export with columnar_export)"),
   VALUE(DOMINANT_STATS_INTERVAL, size_t, 100, "Interval to output stats about dominant organism"),
   VALUE(AGGREGATE_STATS_INTERVAL, size_t, 100, "Interval to output aggregate stats"),
   VALUE(CORRECTNESS_SAMPLE_SIZE, size_t, 4096, "How many tests do we use to 'test' accuracy of a sorting network (in data collection)?"),
   VALUE(SOLUTION_SCREEN_INTERVAL, size_t, 100, "Interval to screen networks for correct solutions"),
-  VALUE(COLLECT_TEST_PHYLOGENIES, bool, false, "Collect test phylogenies?")
+  VALUE(SOLUTION_SCREEN_THREADS, size_t, 1, "Number of background threads verifying solution candidates (0 to verify queued candidates on the main thread, after evaluation). Every unique verified solution goes to solutions, and smaller-than-known solutions go to small_solutions."),
+  VALUE(SOLUTION_SCREEN_QUEUE_SIZE, size_t, 1024, "Maximum number of solution candidates waiting for verification (candidates past this are dropped, and resubmitted if seen again)."),
+  VALUE(SOLUTION_SCREEN_CACHE_SIZE, size_t, 1000000, "Maximum number of rejected solution candidates remembered (by genome hash) to avoid re-verifying them (0 for no limit)."),
+  VALUE(COLLECT_TEST_PHYLOGENIES, bool, false, "Collect test phylogenies?"),
+  VALUE(SYSTEMATICS_MODE, size_t, 0, "How are test phylogenies stored? \n0: Full (every taxon stores its genome; phylogeny metrics recalculated every update)\n1: Compact (taxa store genome hashes + diffs against their parent; phylogeny metrics only calculated when test_gen_sys.csv is written)"),
+  VALUE(SYSTEMATICS_KEYFRAME_INTERVAL, size_t, 16, "Compact systematics: maximum number of diffs between a taxon and a full stored genome (bounds genome decoding cost)."),
+  VALUE(SYSTEMATICS_MAX_MB, size_t, 1024, "Compact systematics: hard memory cap (in MB; 0 for no cap), checked every update. Past the cap, genomes of the oldest extinct ancestors are dropped, then genomes of the oldest living taxa (hash-only)."),
+  VALUE(CHECKPOINT_INTERVAL, size_t, 0, "How often should we checkpoint experiment state? (0 to only checkpoint on SIGTERM/SIGUSR1)"),
+  VALUE(CHECKPOINT_FILE, std::string, "checkpoint.bin", "Checkpoint file name (in DATA_DIRECTORY). Resume with --resume <file>.")
 
 )
 
@@ -5,6 +5,8 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <utility>
@@ -24,8 +26,20 @@
 #include "SortingNetworkConfig.h"
 #include "SortingNetworkOrg.h"
 #include "SortingTestOrg.h"
+#include "ScoreMatrix.h"
+#include "UniqueTestIndex.h"
 #include "Selection.h"
 #include "Mutators.h"
+#include "BatchCrossover.h"
+#include "WorkerPool.h"
+#include "CompactSystematics.h"
+#include "Checkpoint.h"
+#include "ExperimentLog.h"
+#include "SystematicsCheckpoint.h"
+#include "SnapshotWriter.h"
+#include "SolutionScreener.h"
+#include "ColumnarFile.h"
+#include "Instrumentation.h"
 
 /*
 
@@ -60,6 +74,88 @@ Experiment execution flow:
 
 */
 
+/// Checkpoint networks as sequences of comparator index pairs.
+template<>
+struct CheckpointIO<SortingNetwork> {
+  static void Write(std::ostream & out, const SortingNetwork & network) {
+    CheckpointWrite(out, (uint64_t)network.GetSize());
+    for (size_t i = 0; i < network.GetSize(); ++i) {
+      CheckpointWrite(out, (uint64_t)network[i][0]);
+      CheckpointWrite(out, (uint64_t)network[i][1]);
+    }
+  }
+  static void Read(std::istream & in, SortingNetwork & network) {
+    uint64_t size = 0, a = 0, b = 0;
+    CheckpointRead(in, size);
+    SortingNetwork::network_t & ops = network.ReplaceNetwork();
+    ops.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+      CheckpointRead(in, a);
+      CheckpointRead(in, b);
+      ops[i][0] = (size_t)a;
+      ops[i][1] = (size_t)b;
+    }
+  }
+};
+
+/// Checkpoint test org genomes as (test size, test sequences).
+template<>
+struct CheckpointIO<SortingTestOrg::Genome> {
+  static void Write(std::ostream & out, const SortingTestOrg::Genome & genome) {
+    CheckpointWrite(out, (uint64_t)genome.test_size);
+    CheckpointWrite(out, (uint64_t)genome.test_set.Get().size());
+    for (const SortingTest & test : genome.test_set.Get()) {
+      for (size_t i = 0; i < test.GetSize(); ++i) CheckpointWrite(out, (int)test[i]);
+    }
+  }
+  static void Read(std::istream & in, SortingTestOrg::Genome & genome) {
+    uint64_t test_size = 0, num_tests = 0;
+    CheckpointRead(in, test_size);
+    CheckpointRead(in, num_tests);
+    genome.test_size = (size_t)test_size;
+    emp::vector<SortingTest> & tests = genome.test_set.Replace();
+    tests.assign((size_t)num_tests, SortingTest((size_t)test_size));
+    int val = 0;
+    for (SortingTest & test : tests) {
+      for (size_t i = 0; i < test.GetSize(); ++i) { CheckpointRead(in, val); test[i] = val; }
+    }
+  }
+};
+
+/// Compact systematics store test org genomes as sequences of tests.
+template<>
+struct CompactGenomeTraits<SortingTestOrg::Genome> {
+  using elem_t = SortingTest;
+  static const emp::vector<SortingTest> & GetSeq(const SortingTestOrg::Genome & genome) { return genome.test_set.Get(); }
+  static void SetSeq(SortingTestOrg::Genome & genome, emp::vector<SortingTest> && seq) { genome.test_set.Replace() = std::move(seq); }
+  static void Hash(uint64_t & hash, const SortingTest & test) {
+    for (size_t i = 0; i < test.GetSize(); ++i) CompactGenomeHash(hash, (uint64_t)test[i]);
+  }
+  static size_t GetBytes(const SortingTest & test) { return test.GetBytes(); }
+};
+
+/// Network as a flat list of comparator indices (for columnar output; exported as "[(a,b),(c,d),...]").
+inline emp::vector<uint64_t> MakeNetworkList(const SortingNetwork & network) {
+  emp::vector<uint64_t> ops;
+  ops.reserve(2 * network.GetSize());
+  for (size_t i = 0; i < network.GetSize(); ++i) {
+    ops.emplace_back(network[i][0]);
+    ops.emplace_back(network[i][1]);
+  }
+  return ops;
+}
+
+/// Hash of a network's comparators (for deduplicating solution candidates).
+inline uint64_t HashNetwork(const SortingNetwork & network) {
+  uint64_t hash = 14695981039346656037ull;
+  CompactGenomeHash(hash, (uint64_t)network.GetSize());
+  for (size_t i = 0; i < network.GetSize(); ++i) {
+    CompactGenomeHash(hash, (uint64_t)network[i][0]);
+    CompactGenomeHash(hash, (uint64_t)network[i][1]);
+  }
+  return hash;
+}
+
 class SortingNetworkExperiment {
 public:
 
@@ -69,6 +165,8 @@ public:
   
   using test_org_t = SortingTestOrg;
   using test_genome_t = SortingTestOrg::genome_t;
+  using test_sys_info_t = CompactGenome<test_genome_t>;
+  using test_systematics_t = emp::Systematics<test_org_t, test_sys_info_t>;
   
   using network_world_t = emp::World<network_org_t>;
   using test_world_t = emp::World<test_org_t>;
@@ -76,7 +174,11 @@ public:
   // Experiment toggles
   enum SELECTION_METHODS { LEXICASE=0, COHORT_LEXICASE=1, TOURNAMENT=2 };
   enum TEST_MODES { COEVOLVE=0, STATIC=1, RANDOM=2, DRIFT=3 };
-  enum NETWORK_CROSSOVER_MODES { NONE=0, SINGLE_PT=1, TWO_PT=2 };
+  enum OUTPUT_FORMATS { CSV_OUTPUT=0, COLUMNAR_OUTPUT=1 };
+  enum NETWORK_CROSSOVER_MODES { NONE=0, SINGLE_PT=1, TWO_PT=2, UNIFORM=3 };
+  enum NETWORK_CROSSOVER_PAIRINGS { CHAINED_PAIRS=0, DISJOINT_PAIRS=1 };
+  enum SYSTEMATICS_MODES { FULL_SYSTEMATICS=0, COMPACT_SYSTEMATICS=1 };
+  enum MUTATION_SAMPLING_MODES { PER_SITE_SAMPLING=0, SKIP_SAMPLING=1 };
   
 protected:
 
@@ -104,7 +206,10 @@ protected:
   double PER_PAIR_SWAP;
   size_t NETWORK_CROSSOVER_MODE;
   double PER_ORG_CROSSOVER;
+  size_t NETWORK_CROSSOVER_PAIRING;
+  size_t REPRODUCTION_THREADS;
   double PER_ORG_MUTATION;
+  size_t MUTATION_SAMPLING_MODE;
 
   size_t SORT_SIZE;
   size_t SORTS_PER_TEST;
@@ -115,15 +220,26 @@ protected:
 
   std::string DATA_DIRECTORY;
   size_t SNAPSHOT_INTERVAL;
+  size_t SNAPSHOT_QUEUE_SIZE;
+  size_t OUTPUT_FORMAT;
   size_t DOMINANT_STATS_INTERVAL;
   size_t AGGREGATE_STATS_INTERVAL;
   size_t CORRECTNESS_SAMPLE_SIZE;
   size_t SOLUTION_SCREEN_INTERVAL;
+  size_t SOLUTION_SCREEN_THREADS;
+  size_t SOLUTION_SCREEN_QUEUE_SIZE;
+  size_t SOLUTION_SCREEN_CACHE_SIZE;
   bool COLLECT_TEST_PHYLOGENIES;
+  size_t SYSTEMATICS_MODE;
+  size_t SYSTEMATICS_KEYFRAME_INTERVAL;
+  size_t SYSTEMATICS_MAX_MB;
+  size_t CHECKPOINT_INTERVAL;
+  std::string CHECKPOINT_FILE;
 
   // Experiment variables
   bool setup;                 ///< Has setup been run?
   size_t update;
+  size_t test_eval_cnt;       ///< Total number of network-test evaluations run (used for benchmarking).
   size_t dominant_network_id;
   size_t dominant_test_id;
   size_t smallest_known_sol_size;
@@ -135,7 +251,8 @@ protected:
   emp::Ptr<test_world_t> test_world;
 
   // emp::Ptr<emp::Systematics<network_org_t, network_genome_t>> network_genotypic_systematics;
-  emp::Ptr<emp::Systematics<test_org_t, test_genome_t>> test_genotypic_systematics;
+  emp::Ptr<test_systematics_t> test_genotypic_systematics;
+  SystematicsCompactor<test_org_t, test_genome_t> test_sys_compactor; ///< Used when SYSTEMATICS_MODE is compact.
 
 
   struct Cohorts {
@@ -206,6 +323,13 @@ protected:
   Cohorts network_cohorts;
   Cohorts test_cohorts;
 
+  /// Network pass counts (rows: networks, or network cohort slots in cohort mode) against tests
+  /// (columns: tests, or test cohort slots). Network phenotypes view rows; test phenotypes view
+  /// columns.
+  ScoreMatrix<size_t> network_scores;
+  UniqueTestIndex<test_genome_t> test_index;        ///< Distinct tests in the test world (this generation).
+  UniqueTestResults<size_t> network_test_results;   ///< Network being evaluated against distinct tests.
+
   emp::vector<std::function<double(network_org_t &)>> lexicase_network_fit_set;
   emp::vector<std::function<double(test_org_t &)>> lexicase_test_fit_set;
 
@@ -213,6 +337,10 @@ protected:
   SortingNetworkMutator network_mutator;
   SortingTestMutator test_mutator;
 
+  CheckpointWriter checkpoint_writer;
+  CheckpointDataFiles data_files;   ///< Summary data files (appended to over the course of a run).
+  SnapshotWriter snapshot_writer;   ///< Formats/writes population snapshots in the background.
+
   struct StatID {
     size_t networkID;
     size_t testID;
@@ -232,11 +360,13 @@ protected:
   } network_pop_ids;
 
   emp::Ptr<emp::Binomial> network_cross_binomial;
+  BatchCrossover network_batch_crossover;   ///< Used for NETWORK_CROSSOVER_PAIRING = DISJOINT_PAIRS.
+  WorkerPool reproduction_pool;             ///< REPRODUCTION_THREADS workers (batched crossover).
 
   struct CompleteTestSet {
     emp::vector<size_t> testIDs;
     emp::vector<SortingTest> tests;
-    size_t swap_id;
+    emp::vector<size_t> fail_counts; ///< Number of times each test has caught an incorrect network.
 
     size_t GetSize() const { return tests.size(); }
 
@@ -265,6 +395,8 @@ protected:
       //   set.insert(emp::to_string(tests[tID].GetTest()));
       // }
       for (size_t i = 0; i < tests.size(); ++i) testIDs.emplace_back(i);
+      fail_counts.clear();
+      fail_counts.resize(tests.size(), 0);
     }
 
     void SuffleTestIDs(emp::Random & rnd) {
@@ -287,13 +419,18 @@ protected:
       return sort_cnt;
     }
 
-    // TODO - push up tests likely to cause failure
+    /// Check network against all tests. Tests are kept ordered by how often they have caused
+    /// a failure (most-often-failed first) so that incorrect networks fail fast.
     bool Correct(const SortingNetwork & network) {
       for (size_t i = 0; i < tests.size(); ++i) {
         if (!tests[i].Evaluate(network)) {
-          std::swap(tests[i], tests[swap_id]);
-          ++swap_id; 
-          if (swap_id >= tests.size()) swap_id = 0;
+          ++fail_counts[i];
+          // Bubble failing test up past any tests that have failed less often.
+          while (i > 0 && fail_counts[i] > fail_counts[i-1]) {
+            std::swap(tests[i], tests[i-1]);
+            std::swap(fail_counts[i], fail_counts[i-1]);
+            --i;
+          }
           return false;
         }
       }
@@ -302,6 +439,18 @@ protected:
 
   } complete_test_set;
 
+  /// Solution candidate, captured when first seen (for background solution screening).
+  struct SolutionCandidate {
+    size_t update;
+    size_t networkID;
+    double fitness;
+    size_t pass_total;
+    size_t antagonist_cnt;
+    network_genome_t genome;
+  };
+  SolutionScreener<SolutionCandidate> sol_screener;  ///< Verifies solution candidates (on SOLUTION_SCREEN_THREADS workers).
+  const SolutionCandidate * cur_solution;            ///< Solution being written to solution files.
+
   // Network stats
   std::function<size_t(void)> get_networkID;
   std::function<double(void)> get_network_fitness;
@@ -327,6 +476,11 @@ protected:
 
   emp::Ptr<emp::DataFile> sol_file;
   emp::Ptr<emp::DataFile> small_sol_file;
+  emp::Ptr<ColumnarWriter> sol_col_file;        ///< Used instead of sol_file for columnar output.
+  emp::Ptr<ColumnarWriter> small_sol_col_file;  ///< Used instead of small_sol_file for columnar output.
+#ifdef EXP_INSTRUMENT
+  emp::Ptr<InstrumentationFile> timing_file;    ///< Phase timing + counters (timing.csv).
+#endif
 
   // Experiment signals
   emp::Signal<void(void)> do_evaluation_sig;  ///< Trigger network/test evaluations.
@@ -335,7 +489,6 @@ protected:
 
   emp::Signal<void(void)> do_pop_snapshot_sig; ///< Trigger population snapshot
   emp::Signal<void(void)> do_sol_screen_sig;  ///< Trigger a screen for solutions
-  emp::Signal<void(size_t)> do_small_sol_screen_sig;
 
   emp::Signal<void(void)> end_setup_sig;    ///< Triggered at beginning of a run.
 
@@ -366,18 +519,26 @@ protected:
   void SnapshotTests();     ///< Output a snapshot of test population.
 
   void SetupSolutionsFile();
+  void SubmitSolutionCandidate(size_t nID);  ///< Submit network for solution screening.
+  void WriteScreenedSolutions();             ///< Write solutions confirmed by background screening.
+
+  void WriteCheckpoint(std::ostream & out);             ///< Serialize experiment state (between generations).
+  void ReadCheckpoint(std::istream & in);               ///< Restore experiment state written by WriteCheckpoint.
+  bool DoCheckpoint();                                  ///< Checkpoint if scheduled/requested. Return true if experiment should stop.
 
   /// Evaluate SortingNetworkOrg network against SortingTestOrg test,
   /// return number of passes.
   size_t EvaluateNetworkOrg(const SortingNetworkOrg & network, const SortingTestOrg & test) const;
+  size_t EvaluateNetworkOrgOnTest(const SortingNetworkOrg & network, size_t testID);  ///< Network (begun in network_test_results) vs. test world position testID.
 
 public:
 
   SortingNetworkExperiment() 
-    : setup(false), update(0), 
-      network_cohorts(), test_cohorts(),
-      network_mutator(), test_mutator(),
-      curIDs(0, 0)
+    : setup(false), update(0), test_eval_cnt(0),
+      network_cohorts(), test_cohorts(), network_scores(),
+      test_index(), network_test_results(),
+      network_mutator(), test_mutator(), data_files(),
+      curIDs(0, 0), cur_solution(nullptr)
     { ; }
 
   ~SortingNetworkExperiment() {
@@ -385,9 +546,14 @@ public:
       network_cross_binomial.Delete();
 
       #ifndef EMSCRIPTEN
-      sol_file.Delete();
-      small_sol_file.Delete();
+      if (sol_file != nullptr) sol_file.Delete();
+      if (small_sol_file != nullptr) small_sol_file.Delete();
+      if (sol_col_file != nullptr) sol_col_file.Delete();
+      if (small_sol_col_file != nullptr) small_sol_col_file.Delete();
       #endif 
+      #ifdef EXP_INSTRUMENT
+      if (timing_file != nullptr) timing_file.Delete();
+      #endif
 
       network_world.Delete();
       test_world.Delete();
@@ -398,9 +564,14 @@ public:
   /// Configure the experiment
   void Setup(const SortingNetworkConfig & config);
 
-  /// Run the experiment start->finish
+  /// Configure the experiment, then restore its state from a checkpoint file (written by a previous
+  /// run with the same configuration).
+  void Resume(const SortingNetworkConfig & config, const std::string & checkpoint_fpath);
+
+  /// Run the experiment start->finish (or from the resumed update to finish)
   /// - Initialize population
   /// - For each generation: RunStep()
+  /// - Checkpoints every CHECKPOINT_INTERVAL generations and on SIGUSR1; checkpoints and stops on SIGTERM.
   void Run();     
 
   /// Progress experiment by single time step (generation):
@@ -413,15 +584,28 @@ public:
   emp::Random & GetRandom() { return *random; }
   network_world_t & GetNetworkWorld() { return *network_world; }
   test_world_t & GetTestWorld() { return *test_world; }
+  size_t GetUpdate() const { return update; }
+  void SetUpdate(size_t u) { update = u; }
+  size_t GetTestEvalCount() const { return test_eval_cnt; }
 
 };
 
 /// Setup is, in theory (but untested), able to be called multiple times.
 void SortingNetworkExperiment::Setup(const SortingNetworkConfig & config) {
-  std::cout << "Running SortingNetworkExperiment setup." << std::endl;
+  ExpLog() << "Running SortingNetworkExperiment setup." << std::endl;
   // Initialize localized configs
   InitConfigs(config);
 
+  // Compact genomes (EXP_COMPACT_GENOMES) have fixed limits.
+  if (MAX_NETWORK_SIZE > SortingNetwork::MAX_NETWORK_SIZE) {
+    ExpLog() << "MAX_NETWORK_SIZE (" << MAX_NETWORK_SIZE << ") exceeds compact network capacity (" << (size_t)SortingNetwork::MAX_NETWORK_SIZE << "; see EXP_COMPACT_NETWORK_CAPACITY). Exiting." << std::endl;
+    exit(-1);
+  }
+  if (SORT_SIZE > SortingTest::MAX_TEST_SIZE || SORT_SIZE > SortingNetwork::MAX_INPUT_SIZE) {
+    ExpLog() << "SORT_SIZE (" << SORT_SIZE << ") exceeds compact test size limit (" << (size_t)SortingTest::MAX_TEST_SIZE << "). Exiting." << std::endl;
+    exit(-1);
+  }
+
   if (!setup) {
     // Create a random number generator
     random = emp::NewPtr<emp::Random>(SEED);
@@ -438,14 +622,18 @@ void SortingNetworkExperiment::Setup(const SortingNetworkConfig & config) {
     do_update_sig.Clear();
     do_pop_snapshot_sig.Clear();
     do_sol_screen_sig.Clear();
-    do_small_sol_screen_sig.Clear();
     end_setup_sig.Clear();
 
     network_cross_binomial.Delete();
     #ifndef EMSCRIPTEN
-    sol_file.Delete();
-    small_sol_file.Delete();
+    if (sol_file != nullptr) sol_file.Delete();
+    if (small_sol_file != nullptr) small_sol_file.Delete();
+    if (sol_col_file != nullptr) sol_col_file.Delete();
+    if (small_sol_col_file != nullptr) small_sol_col_file.Delete();
     #endif 
+    #ifdef EXP_INSTRUMENT
+    if (timing_file != nullptr) timing_file.Delete();
+    #endif
   }
 
   network_world->SetPopStruct_Mixed(true);
@@ -453,18 +641,22 @@ void SortingNetworkExperiment::Setup(const SortingNetworkConfig & config) {
 
   network_pop_ids.Init(NETWORK_POP_SIZE);
   network_cross_binomial = emp::NewPtr<emp::Binomial>(PER_ORG_CROSSOVER, NETWORK_POP_SIZE);
+  reproduction_pool.Start(REPRODUCTION_THREADS);
 
   complete_test_set.Generate(SORT_SIZE);
   smallest_known_sol_size = MAX_NETWORK_SIZE + 1;
 
   // Add network world updates
   do_update_sig.AddAction([this]() {
-    std::cout << "Update: " << update << ", ";
-    std::cout << "best-network (size=" << network_world->GetOrg(dominant_network_id).GetSize() << "): " << network_world->CalcFitnessID(dominant_network_id) << ", ";
+    ExpLog() << "Update: " << update << ", ";
+    ExpLog() << "best-network (size=" << network_world->GetOrg(dominant_network_id).GetSize() << "): " << network_world->CalcFitnessID(dominant_network_id) << ", ";
     // std::cout << "best-test: " << test_world->CalcFitnessID(dominant_test_id) << std::endl;
-    std::cout << "solution found? " << (smallest_known_sol_size < (MAX_NETWORK_SIZE + 1)) << "; Solution size: " << smallest_known_sol_size << std::endl;
+    ExpLog() << "solution found? " << (smallest_known_sol_size < (MAX_NETWORK_SIZE + 1)) << "; Solution size: " << smallest_known_sol_size << std::endl;
     
-    if (update % SNAPSHOT_INTERVAL == 0) do_pop_snapshot_sig.Trigger();
+    if (update % SNAPSHOT_INTERVAL == 0) {
+      EXP_INSTRUMENT_PHASE(SNAPSHOT);
+      do_pop_snapshot_sig.Trigger();
+    }
     // if (update % SOLUTION_SCREEN_INTERVAL == 0) do_sol_screen_sig.Trigger();
 
     network_world->Update();
@@ -504,11 +696,11 @@ void SortingNetworkExperiment::Setup(const SortingNetworkConfig & config) {
   
   end_setup_sig.Trigger();
   setup = true;
-  std::cout << "Done with experiment setup." << std::endl;
+  ExpLog() << "Done with experiment setup." << std::endl;
 }
 
 void SortingNetworkExperiment::SetupDataCollection() {
-  std::cout << "Setting up data collection!" << std::endl;
+  ExpLog() << "Setting up data collection!" << std::endl;
   // Make a data directory
   mkdir(DATA_DIRECTORY.c_str(), ACCESSPERMS);
   if (DATA_DIRECTORY.back() != '/') DATA_DIRECTORY += '/';  
@@ -520,6 +712,12 @@ void SortingNetworkExperiment::SetupDataCollection() {
   // Setup solutions file
   SetupSolutionsFile();
 
+  #ifdef EXP_INSTRUMENT
+  // Setup timing file (phase timing + counters; see Instrumentation.h)
+  timing_file = emp::NewPtr<InstrumentationFile>(DATA_DIRECTORY + "timing.csv", AGGREGATE_STATS_INTERVAL);
+  data_files.Add(*timing_file);
+  #endif
+
   // Setup fitness files
   // SetupFitnessFile
   auto & network_fit_file = network_world->SetupFitnessFile(DATA_DIRECTORY + "network_stats.csv", false);
@@ -531,6 +729,7 @@ void SortingNetworkExperiment::SetupDataCollection() {
     return emp::ShannonEntropy(vec);
   }, "diversity", "Shannon diversity of genotypes in population.");
   network_fit_file.PrintHeaderKeys();
+  data_files.Add(network_fit_file, DATA_DIRECTORY + "network_stats.csv");
 
   auto & test_fit_file = test_world->SetupFitnessFile(DATA_DIRECTORY + "test_stats.csv", false);
   test_fit_file.SetTimingRepeat(AGGREGATE_STATS_INTERVAL);
@@ -539,7 +738,9 @@ void SortingNetworkExperiment::SetupDataCollection() {
     auto vec = emp::ApplyFunction(get_test_org_genome, test_world->GetFullPop());
     return emp::ShannonEntropy(vec);
   }, "diversity", "Shannon diversity of genotypes in population.");
+  test_fit_file.template AddFun<size_t>([this]() { return test_index.GetNumUnique(); }, "distinct_tests", "Number of distinct test genomes in population (this generation's evaluation).");
   test_fit_file.PrintHeaderKeys();
+  data_files.Add(test_fit_file, DATA_DIRECTORY + "test_stats.csv");
 
   // Setup systematics managers
   // - Network systematics manager
@@ -569,34 +770,53 @@ void SortingNetworkExperiment::SetupDataCollection() {
   // }, "network", "sorting network");
 
   if (COLLECT_TEST_PHYLOGENIES) {
-    std::cout << "Collecting test phylogenies!" << std::endl;
-    test_genotypic_systematics = emp::NewPtr<emp::Systematics<test_org_t, test_genome_t>>([](const test_org_t & org) { return org.GetGenome(); });
-    test_genotypic_systematics->AddEvolutionaryDistinctivenessDataNode();
-    test_genotypic_systematics->AddPairwiseDistanceDataNode();
-    test_genotypic_systematics->AddPhylogeneticDiversityDataNode();
+    ExpLog() << "Collecting test phylogenies!" << std::endl;
+    // - Compact mode: taxa store genome hashes + diffs (compacted whenever test_gen_sys.csv is written, or sooner to hold the memory cap; see
+    //   CompactSystematics.h), and phylogeny metrics are only calculated when test_gen_sys.csv is written.
+    const bool compact_systematics = SYSTEMATICS_MODE == (size_t)SYSTEMATICS_MODES::COMPACT_SYSTEMATICS;
+    test_genotypic_systematics = emp::NewPtr<test_systematics_t>([](const test_org_t & org) { return test_sys_info_t(org.GetGenome()); });
+    if (!compact_systematics) {
+      test_genotypic_systematics->AddEvolutionaryDistinctivenessDataNode();
+      test_genotypic_systematics->AddPairwiseDistanceDataNode();
+      test_genotypic_systematics->AddPhylogeneticDiversityDataNode();
+    }
     test_world->AddSystematics(test_genotypic_systematics, "test_genotype");
     auto & test_gen_sys_file = test_world->SetupSystematicsFile("test_genotype", DATA_DIRECTORY + "/test_gen_sys.csv", false);
     test_gen_sys_file.SetTimingRepeat(AGGREGATE_STATS_INTERVAL);
     // Functions to add:
-    test_gen_sys_file.AddStats(*test_genotypic_systematics->GetDataNode("evolutionary_distinctiveness") , "evolutionary_distinctiveness", "evolutionary distinctiveness for a single update", true, true);
-    test_gen_sys_file.AddStats(*test_genotypic_systematics->GetDataNode("pairwise_distances"), "pairwise_distance", "pairwise distance for a single update", true, true);
-    // - GetPhylogeneticDiversity
-    test_gen_sys_file.AddCurrent(*test_genotypic_systematics->GetDataNode("phylogenetic_diversity"), "current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
+    if (compact_systematics) {
+      test_sys_compactor.Configure(SYSTEMATICS_KEYFRAME_INTERVAL, SYSTEMATICS_MAX_MB * 1024 * 1024);
+      test_gen_sys_file.AddPreFun([this]() { test_sys_compactor.Compact(*test_genotypic_systematics); });
+      // Hold the memory cap between file writes (after the test world update adds new taxa).
+      do_update_sig.AddAction([this]() { test_sys_compactor.Enforce(*test_genotypic_systematics); });
+      AddCompactSystematicsMetrics(test_gen_sys_file, test_genotypic_systematics, [this]() { return test_world->GetUpdate(); });
+      AddCompactSystematicsStats(test_gen_sys_file, test_sys_compactor);
+    } else {
+      test_gen_sys_file.AddStats(*test_genotypic_systematics->GetDataNode("evolutionary_distinctiveness") , "evolutionary_distinctiveness", "evolutionary distinctiveness for a single update", true, true);
+      test_gen_sys_file.AddStats(*test_genotypic_systematics->GetDataNode("pairwise_distances"), "pairwise_distance", "pairwise distance for a single update", true, true);
+      // - GetPhylogeneticDiversity
+      test_gen_sys_file.AddCurrent(*test_genotypic_systematics->GetDataNode("phylogenetic_diversity"), "current_phylogenetic_diversity", "current phylogenetic_diversity", true, true);
+    }
     // - GetTreeSize
     test_gen_sys_file.template AddFun<size_t>([this]() { return test_genotypic_systematics->GetTreeSize(); }, "tree_size", "Phylogenetic tree size");
     test_gen_sys_file.PrintHeaderKeys();
+    data_files.Add(test_gen_sys_file, DATA_DIRECTORY + "/test_gen_sys.csv");
     // Add function(s) to program systematics snapshot
-    using test_taxon_t = typename emp::Systematics<test_org_t, test_genome_t>::taxon_t;
+    // - Taxa whose genome was dropped (compact mode memory cap) get an empty test.
+    using test_taxon_t = typename test_systematics_t::taxon_t;
     test_genotypic_systematics->AddSnapshotFun([](const test_taxon_t & t) {
+      if (!t.GetInfo().HasGenome()) return std::string("\"\"");
       std::ostringstream stream;
       // t.GetInfo().PrintCSVEntry(stream);
-      const test_genome_t & test_genome = t.GetInfo();
-      stream << "\"[";
-      for (size_t i = 0; i < test_genome.test_set.size(); ++i) {
-        if (i) stream << ",";
-        test_genome.test_set[i].Print(stream);
-      }
-      stream << "]\"";
+      t.GetInfo().WithGenome([&stream](const test_genome_t & test_genome) {
+        stream << "\"[";
+        const emp::vector<SortingTest> & tests = test_genome.test_set.Get();
+        for (size_t i = 0; i < tests.size(); ++i) {
+          if (i) stream << ",";
+          tests[i].Print(stream);
+        }
+        stream << "]\"";
+      });
 
       return stream.str();
     }, "test", "Test org");
@@ -605,11 +825,14 @@ void SortingNetworkExperiment::SetupDataCollection() {
 
   
   // Setup network/test snapshots
+  snapshot_writer.SetCapacity(SNAPSHOT_QUEUE_SIZE);
   do_pop_snapshot_sig.AddAction([this]() { 
     SnapshotNetworks(); 
     SnapshotTests();
     // network_genotypic_systematics->Snapshot(DATA_DIRECTORY + "pop_" + emp::to_string(network_world->GetUpdate()) + "/network_phylogeny_" + emp::to_string((int)network_world->GetUpdate()) + ".csv");
     if (TEST_MODE == (size_t)TEST_MODES::COEVOLVE && COLLECT_TEST_PHYLOGENIES) {
+      // Systematics are updated every generation, so this can't be deferred to the snapshot writer.
+      SnapshotWriter::MakeDir(DATA_DIRECTORY + "pop_" + emp::to_string(network_world->GetUpdate()));
       test_genotypic_systematics->Snapshot(DATA_DIRECTORY + "pop_" + emp::to_string(network_world->GetUpdate()) + "/test_phylogeny_" + emp::to_string((int)network_world->GetUpdate()) + ".csv");
     }
   });
@@ -714,6 +937,13 @@ void SortingNetworkExperiment::SetupTestStats() {
 }
 
 void SortingNetworkExperiment::SetupEvaluation() {
+  // Group identical tests before evaluating: duplicates accumulate under coevolution, and each
+  // network evaluates a distinct test once (see EvaluateNetworkOrgOnTest).
+  do_evaluation_sig.AddAction([this]() {
+    test_index.Build(test_world->GetSize(),
+                     [this](size_t tID) -> const test_genome_t & { return test_world->GetOrg(tID).GetGenome(); },
+                     [](const test_genome_t & test) { return test_sys_info_t::CalcHash(test); });
+  });
   // Setup population evaluation.
   const bool cohort_eval = SELECTION_MODE == SELECTION_METHODS::COHORT_LEXICASE;
   if (cohort_eval) {  // We're evaluating networks with tests in cohorts.
@@ -724,9 +954,9 @@ void SortingNetworkExperiment::SetupEvaluation() {
     network_cohorts.Init(NETWORK_POP_SIZE, COHORT_SIZE);
     test_cohorts.Init(TEST_POP_SIZE, COHORT_SIZE);
     MAX_PASSES = SORTS_PER_TEST * COHORT_SIZE;
-    // Setup world to reset phenotypes on organism placement      
-    network_world->OnPlacement([this](size_t pos){ network_world->GetOrg(pos).GetPhenotype().Reset(COHORT_SIZE); });
-    test_world->OnPlacement([this](size_t pos){ test_world->GetOrg(pos).GetPhenotype().Reset(COHORT_SIZE); });
+    // Scores are stored by cohort slot: row (cID * COHORT_SIZE + nID), column tID. Each test's
+    // scores are its column within its cohort's rows.
+    network_scores.Resize(NETWORK_POP_SIZE, COHORT_SIZE);
     // What should happen on evaluation?
     do_evaluation_sig.AddAction([this]() {
       // Randomize the cohorts.
@@ -734,34 +964,37 @@ void SortingNetworkExperiment::SetupEvaluation() {
       test_cohorts.Randomize(*random);
       // For each cohort, evaluate all networks in cohort against all tests in cohort.
       for (size_t cID = 0; cID < network_cohorts.GetNumCohorts(); ++cID) {
+        const size_t row_begin = cID * COHORT_SIZE;
+        for (size_t tID = 0; tID < COHORT_SIZE; ++tID) {
+          test_world->GetOrg(test_cohorts.GetWorldID(cID, tID)).GetPhenotype().Reset(network_scores.GetColumn(tID, row_begin, COHORT_SIZE));
+        }
         for (size_t nID = 0; nID < COHORT_SIZE; ++nID) {
           network_org_t & network = network_world->GetOrg(network_cohorts.GetWorldID(cID, nID));
+          network.GetPhenotype().Reset(network_scores.GetRow(row_begin + nID));
+          network_test_results.Begin(test_index.GetNumUnique());
           for (size_t tID = 0; tID < COHORT_SIZE; ++tID) {
-            test_org_t & test = test_world->GetOrg(test_cohorts.GetWorldID(cID, tID));
             // Evaluate network, nID, on test, tID.
-            const size_t passes = EvaluateNetworkOrg(network, test);
-            network.GetPhenotype().test_results[tID] = passes;
-            test.GetPhenotype().test_results[nID] = passes;
+            network_scores(row_begin + nID, tID) = EvaluateNetworkOrgOnTest(network, test_cohorts.GetWorldID(cID, tID));
           }
         }
       }
     });
   } else { // Evaluate all networks on all tests.
-    // Setup world to reset phenotypes on organism placement (each phenotype will need spots to store scores against antagonist's pop size)
-    network_world->OnPlacement([this](size_t pos){ network_world->GetOrg(pos).GetPhenotype().Reset(TEST_POP_SIZE); });
-    test_world->OnPlacement([this](size_t pos){ test_world->GetOrg(pos).GetPhenotype().Reset(NETWORK_POP_SIZE); });
     MAX_PASSES = SORTS_PER_TEST * TEST_POP_SIZE;
     // What should happen on evaluation?
     do_evaluation_sig.AddAction([this]() {
+      // Scores are stored by world position: row nID, column tID.
+      network_scores.Resize(network_world->GetSize(), test_world->GetSize());
+      for (size_t tID = 0; tID < test_world->GetSize(); ++tID) {
+        test_world->GetOrg(tID).GetPhenotype().Reset(network_scores.GetColumn(tID));
+      }
       for (size_t nID = 0; nID < network_world->GetSize(); ++nID) {
         network_org_t & network = network_world->GetOrg(nID);
+        network.GetPhenotype().Reset(network_scores.GetRow(nID));
+        network_test_results.Begin(test_index.GetNumUnique());
         for (size_t tID = 0; tID < test_world->GetSize(); ++tID) {
-          test_org_t & test = test_world->GetOrg(tID);
           // Evaluate network, nID, on test, tID.
-          const size_t passes = EvaluateNetworkOrg(network, test);
-          network.GetPhenotype().test_results[tID] = passes;
-
-          test.GetPhenotype().test_results[nID] = passes;
+          network_scores(nID, tID) = EvaluateNetworkOrgOnTest(network, tID);
         }
       }
     });
@@ -772,11 +1005,10 @@ void SortingNetworkExperiment::SetupEvaluation() {
     // Sum pass totals for networks.
     dominant_network_id = 0;
     double cur_best = 0;
-    complete_test_set.swap_id = 0;
     for (size_t nID = 0; nID < network_world->GetSize(); ++nID) {
       if (!network_world->IsOccupied(nID)) continue;
       network_org_t & network = network_world->GetOrg(nID);
-      const size_t pass_total = emp::Sum(network.GetPhenotype().test_results);
+      const size_t pass_total = network.GetPhenotype().test_results.Sum();
       network.GetPhenotype().num_passes = pass_total;
       // Is this highest fitness network this generation?
       if (pass_total > cur_best || nID == 0) {
@@ -784,18 +1016,20 @@ void SortingNetworkExperiment::SetupEvaluation() {
         cur_best = pass_total;
       }
       // At this point, network has been evaluated against all tests. Screen
-      // for possible smallest known solution.
-      if (pass_total == MAX_PASSES && network.GetSize() < smallest_known_sol_size) {
-        do_small_sol_screen_sig.Trigger(nID);
+      // for possible solutions.
+      if (pass_total == MAX_PASSES) {
+        EXP_INSTRUMENT_PHASE(SCREEN);
+        SubmitSolutionCandidate(nID);
       }
     }
+    WriteScreenedSolutions();
     // Sum pass totals for tests.
     dominant_test_id = 0;
     cur_best = 0;
     for (size_t tID = 0; tID < test_world->GetSize(); ++tID) {
       if (!test_world->IsOccupied(tID)) continue;
       test_org_t & test = test_world->GetOrg(tID);
-      const size_t pass_total = emp::Sum(test.GetPhenotype().test_results);
+      const size_t pass_total = test.GetPhenotype().test_results.Sum();
       const size_t fail_total = (test.GetPhenotype().test_results.size() * SORTS_PER_TEST) - pass_total;
       test.GetPhenotype().num_passes = pass_total;
       test.GetPhenotype().num_fails = fail_total;
@@ -892,7 +1126,7 @@ void SortingNetworkExperiment::SetupNetworkSelection() {
     }
 
     default: {
-      std::cout << "Unrecognized SELECTION_MODE(" << SELECTION_MODE << "). Exiting..." << std::endl;
+      ExpLog() << "Unrecognized SELECTION_MODE(" << SELECTION_MODE << "). Exiting..." << std::endl;
       exit(-1);
     }
   }
@@ -901,37 +1135,54 @@ void SortingNetworkExperiment::SetupNetworkSelection() {
   // GetRandBinomial(const double n, const double p)
   switch (NETWORK_CROSSOVER_MODE) {
     case NETWORK_CROSSOVER_MODES::NONE: {
+      return;
+    }
+    case NETWORK_CROSSOVER_MODES::SINGLE_PT:
+    case NETWORK_CROSSOVER_MODES::TWO_PT:
+    case NETWORK_CROSSOVER_MODES::UNIFORM: {
+      break;
+    }
+    default: {
+      ExpLog() << "Unrecognized crossover mode (" << NETWORK_CROSSOVER_MODE << "). Exiting..." << std::endl;
+      exit(-1);
       break;
     }
-    case NETWORK_CROSSOVER_MODES::SINGLE_PT: {
+  }
+
+  switch (NETWORK_CROSSOVER_PAIRING) {
+    case NETWORK_CROSSOVER_PAIRINGS::CHAINED_PAIRS: {
+      // Each of the num_crosses chosen organisms (but the last) crosses with the next, serially.
       do_selection_sig.AddAction([this]() {
         network_pop_ids.Shuffle(*random);
         // const uint32_t num_crosses = random->GetRandBinomial((double)NETWORK_POP_SIZE, (double)PER_ORG_CROSSOVER);
         const size_t num_crosses = network_cross_binomial->PickRandom(*random);
         for (size_t i = 0; (int)i < (int)num_crosses-1; ++i) {
           emp_assert(i+1 < NETWORK_POP_SIZE, NETWORK_POP_SIZE, num_crosses);
-          network_mutator.Crossover1Pt(*random,
-                                      network_world->GetNextOrg(network_pop_ids.popIDs[i]).GetGenome(), 
-                                      network_world->GetNextOrg(network_pop_ids.popIDs[i+1]).GetGenome());
+          network_genome_t & genomeA = network_world->GetNextOrg(network_pop_ids.popIDs[i]).GetGenome();
+          network_genome_t & genomeB = network_world->GetNextOrg(network_pop_ids.popIDs[i+1]).GetGenome();
+          switch (NETWORK_CROSSOVER_MODE) {
+            case NETWORK_CROSSOVER_MODES::SINGLE_PT: network_mutator.Crossover1Pt(*random, genomeA, genomeB); break;
+            case NETWORK_CROSSOVER_MODES::TWO_PT: network_mutator.Crossover2Pt(*random, genomeA, genomeB); break;
+            case NETWORK_CROSSOVER_MODES::UNIFORM: network_mutator.CrossoverUniform(*random, genomeA, genomeB); break;
+          }
         }
       });
       break;
     }
-    case NETWORK_CROSSOVER_MODES::TWO_PT: {
+    case NETWORK_CROSSOVER_PAIRINGS::DISJOINT_PAIRS: {
+      // The num_crosses chosen organisms are paired off; pairs are planned, then crossed in parallel.
       do_selection_sig.AddAction([this]() {
         network_pop_ids.Shuffle(*random);
         const size_t num_crosses = network_cross_binomial->PickRandom(*random);
-        for (size_t i = 0; (int)i < (int)num_crosses-1; ++i) {
-          emp_assert(i+1 < NETWORK_POP_SIZE, NETWORK_POP_SIZE, num_crosses);
-          network_mutator.Crossover2Pt(*random,
-                                      network_world->GetNextOrg(network_pop_ids.popIDs[i]).GetGenome(), 
-                                      network_world->GetNextOrg(network_pop_ids.popIDs[i+1]).GetGenome());
-        }
+        network_batch_crossover.Plan(*random, network_pop_ids.popIDs, num_crosses, [this](size_t id) -> network_genome_t & {
+          return network_world->GetNextOrg(id).GetGenome();
+        });
+        network_batch_crossover.Run(reproduction_pool);
       });
       break;
     }
     default: {
-      std::cout << "Unrecognized crossover mode (" << NETWORK_CROSSOVER_MODE << "). Exiting..." << std::endl;
+      ExpLog() << "Unrecognized crossover pairing (" << NETWORK_CROSSOVER_PAIRING << "). Exiting..." << std::endl;
       exit(-1);
       break;
     }
@@ -942,7 +1193,7 @@ void SortingNetworkExperiment::SetupNetworkTesting() {
   
   switch (TEST_MODE) {
     case (size_t)TEST_MODES::COEVOLVE: {
-      std::cout << "Setting up network testing - CO-EVOLUTION MODE" << std::endl;
+      ExpLog() << "Setting up network testing - CO-EVOLUTION MODE" << std::endl;
       // Sorting tests coevolve with sorting networks.
       // - Evaluation already done. 
       // - Setup selection
@@ -951,7 +1202,7 @@ void SortingNetworkExperiment::SetupNetworkTesting() {
       break;
     }
     case (size_t)TEST_MODES::DRIFT: {
-      std::cout << "Setting up network testing - DRIFT MODE" << std::endl;
+      ExpLog() << "Setting up network testing - DRIFT MODE" << std::endl;
       do_selection_sig.AddAction([this]() {
         emp::RandomSelect(*test_world, TEST_POP_SIZE);
       });
@@ -959,14 +1210,14 @@ void SortingNetworkExperiment::SetupNetworkTesting() {
       break;
     }
     case (size_t)TEST_MODES::STATIC: {
-      std::cout << "Setting up network testing - STATIC MODE" << std::endl;
+      ExpLog() << "Setting up network testing - STATIC MODE" << std::endl;
       // Sorting tests are static over time.
       test_world->SetPopStruct_Mixed(false);
       // ... do nothing ...
       break;
     }
     case (size_t)TEST_MODES::RANDOM: {
-      std::cout << "Setting up network testing - RANDOM MODE" << std::endl;
+      ExpLog() << "Setting up network testing - RANDOM MODE" << std::endl;
       test_world->SetPopStruct_Mixed(false);
       // On world update, randomize test cases.
       do_update_sig.AddAction([this]() {
@@ -978,7 +1229,7 @@ void SortingNetworkExperiment::SetupNetworkTesting() {
       break;
     }
     default: {
-      std::cout << "Unrecognized TEST_MODE (" << TEST_MODE << "). Exiting..." << std::endl;
+      ExpLog() << "Unrecognized TEST_MODE (" << TEST_MODE << "). Exiting..." << std::endl;
       exit(-1);
     }
   }
@@ -994,6 +1245,14 @@ void SortingNetworkExperiment::SetupNetworkMutation() {
   network_mutator.PER_PAIR_INS = PER_PAIR_INS;
   network_mutator.PER_PAIR_DEL = PER_PAIR_DEL;
   network_mutator.PER_PAIR_SWAP = PER_PAIR_SWAP;
+  network_mutator.skip_sampling = MUTATION_SAMPLING_MODE == (size_t)MUTATION_SAMPLING_MODES::SKIP_SAMPLING;
+
+  // Batched crossover workers get copies of the (configured) network mutator.
+  switch (NETWORK_CROSSOVER_MODE) {
+    case NETWORK_CROSSOVER_MODES::SINGLE_PT: network_batch_crossover.Configure(BatchCrossover::SINGLE_PT, network_mutator, reproduction_pool.GetNumWorkers(), NETWORK_POP_SIZE); break;
+    case NETWORK_CROSSOVER_MODES::TWO_PT: network_batch_crossover.Configure(BatchCrossover::TWO_PT, network_mutator, reproduction_pool.GetNumWorkers(), NETWORK_POP_SIZE); break;
+    case NETWORK_CROSSOVER_MODES::UNIFORM: network_batch_crossover.Configure(BatchCrossover::UNIFORM, network_mutator, reproduction_pool.GetNumWorkers(), NETWORK_POP_SIZE); break;
+  }
 
   if (PER_ORG_MUTATION == 1.0) {
     network_world->SetMutFun([this](network_org_t & network, emp::Random & rnd) {
@@ -1015,14 +1274,14 @@ void SortingNetworkExperiment::SetupNetworkMutation() {
 }
 
 void SortingNetworkExperiment::SetupTestSelection() {
-  std::cout << "Setting up test selection!" << std::endl;
+  ExpLog() << "Setting up test selection!" << std::endl;
   // Configure test selection scheme (will match network selection mode).
   switch (SELECTION_MODE) {
     case (size_t)SELECTION_METHODS::COHORT_LEXICASE: {
       // Setup test fit funs
       // - 1 function for every cohort member
       if (DISCRIMINATORY_LEXICASE_TESTS) {
-        std::cout << "  Configuring tests to be DISCRIMINATORY" << std::endl;
+        ExpLog() << "  Configuring tests to be DISCRIMINATORY" << std::endl;
         for (size_t i = 0; i < COHORT_SIZE; ++i) {
           lexicase_test_fit_set.push_back([i, this](test_org_t & test) {
             if (test.GetPhenotype().test_results[i] == SORTS_PER_TEST) {
@@ -1058,7 +1317,7 @@ void SortingNetworkExperiment::SetupTestSelection() {
     case (size_t)SELECTION_METHODS::LEXICASE: {
       // For lexicase selection, one function for every network organism.
       if (DISCRIMINATORY_LEXICASE_TESTS) {
-        std::cout << "  Configuring tests to be DISCRIMINATORY" << std::endl;
+        ExpLog() << "  Configuring tests to be DISCRIMINATORY" << std::endl;
         for (size_t i = 0; i < NETWORK_POP_SIZE; ++i) {
           lexicase_test_fit_set.push_back([i, this](test_org_t & test) {
             if (test.GetPhenotype().test_results[i] == SORTS_PER_TEST) {
@@ -1090,20 +1349,21 @@ void SortingNetworkExperiment::SetupTestSelection() {
       break;
     }
     default: {
-      std::cout << "Unrecognized SELECTION_MODE (" << SELECTION_MODE << "). Exiting..." << std::endl;
+      ExpLog() << "Unrecognized SELECTION_MODE (" << SELECTION_MODE << "). Exiting..." << std::endl;
       exit(-1);
     }
   }
 }
 
 void SortingNetworkExperiment::SetupTestMutation() {
-  std::cout << "Setting up test mutation!" << std::endl;
+  ExpLog() << "Setting up test mutation!" << std::endl;
   test_mutator.bit_mode = true;
   test_mutator.MAX_VALUE = 1;
   test_mutator.MIN_VALUE = 0;
   test_mutator.PER_SITE_SUB = PER_SITE_SUB;
   test_mutator.PER_SEQ_INVERSION = PER_SEQ_INVERSION;
   test_mutator.PER_SEQ_RANDOMIZE = PER_SEQ_RANDOMIZE;
+  test_mutator.skip_sampling = MUTATION_SAMPLING_MODE == (size_t)MUTATION_SAMPLING_MODES::SKIP_SAMPLING;
   test_world->SetMutFun([this](test_org_t & test, emp::Random & rnd) {
     return test_mutator.Mutate(rnd, test.GetGenome());
   });
@@ -1113,15 +1373,47 @@ void SortingNetworkExperiment::SetupTestMutation() {
 }
 
 void SortingNetworkExperiment::Run() {
-  for (update = 0; update <= GENERATIONS; ++update) {
+  InstallCheckpointSignalHandlers();
+  for ( ; update <= GENERATIONS; ++update) {
     RunStep();
+    if (DoCheckpoint()) break;
   }
+  sol_screener.Wait();
+  WriteScreenedSolutions();
+  checkpoint_writer.Wait();
+  snapshot_writer.Wait();
+}
+
+void SortingNetworkExperiment::Resume(const SortingNetworkConfig & config, const std::string & checkpoint_fpath) {
+  std::istringstream in(LoadCheckpointFile(checkpoint_fpath));
+  const size_t resume_update = ReadCheckpointHeader(in, "SortingNetworkExperiment", data_files);
+  Setup(config);
+  ReadCheckpoint(in);
+  if (!in) {
+    ExpLog() << "Failed to read checkpoint (" << checkpoint_fpath << "). Exiting." << std::endl;
+    exit(-1);
+  }
+  data_files.Resume();
+  update = resume_update;
+  ExpLog() << "Resumed from checkpoint (" << checkpoint_fpath << ") at update " << update << std::endl;
 }
 
 void SortingNetworkExperiment::RunStep() {
-  do_evaluation_sig.Trigger();
-  do_selection_sig.Trigger();
-  do_update_sig.Trigger();
+  {
+    EXP_INSTRUMENT_PHASE(EVALUATION);
+    do_evaluation_sig.Trigger();
+  }
+  {
+    EXP_INSTRUMENT_PHASE(SELECTION);
+    do_selection_sig.Trigger();
+  }
+  {
+    EXP_INSTRUMENT_PHASE(UPDATE);
+    do_update_sig.Trigger();
+  }
+  #ifdef EXP_INSTRUMENT
+  if (timing_file != nullptr) timing_file->EndStep(update);
+  #endif
 }
 
 void SortingNetworkExperiment::InitConfigs(const SortingNetworkConfig & config) {
@@ -1149,7 +1441,10 @@ void SortingNetworkExperiment::InitConfigs(const SortingNetworkConfig & config)
   PER_PAIR_SWAP = config.PER_PAIR_SWAP();
   NETWORK_CROSSOVER_MODE = config.NETWORK_CROSSOVER_MODE();
   PER_ORG_CROSSOVER = config.PER_ORG_CROSSOVER();
+  NETWORK_CROSSOVER_PAIRING = config.NETWORK_CROSSOVER_PAIRING();
+  REPRODUCTION_THREADS = config.REPRODUCTION_THREADS();
   PER_ORG_MUTATION = config.PER_ORG_MUTATION();
+  MUTATION_SAMPLING_MODE = config.MUTATION_SAMPLING_MODE();
 
   SORT_SIZE = config.SORT_SIZE();
   SORTS_PER_TEST = config.SORTS_PER_TEST();
@@ -1160,174 +1455,403 @@ void SortingNetworkExperiment::InitConfigs(const SortingNetworkConfig & config)
 
   DATA_DIRECTORY = config.DATA_DIRECTORY();
   SNAPSHOT_INTERVAL = config.SNAPSHOT_INTERVAL();
+  SNAPSHOT_QUEUE_SIZE = config.SNAPSHOT_QUEUE_SIZE();
+  OUTPUT_FORMAT = config.OUTPUT_FORMAT();
   DOMINANT_STATS_INTERVAL = config.DOMINANT_STATS_INTERVAL();
   AGGREGATE_STATS_INTERVAL = config.AGGREGATE_STATS_INTERVAL();
   CORRECTNESS_SAMPLE_SIZE = config.CORRECTNESS_SAMPLE_SIZE();
   SOLUTION_SCREEN_INTERVAL = config.SOLUTION_SCREEN_INTERVAL();
+  SOLUTION_SCREEN_THREADS = config.SOLUTION_SCREEN_THREADS();
+  SOLUTION_SCREEN_QUEUE_SIZE = config.SOLUTION_SCREEN_QUEUE_SIZE();
+  SOLUTION_SCREEN_CACHE_SIZE = config.SOLUTION_SCREEN_CACHE_SIZE();
   COLLECT_TEST_PHYLOGENIES = config.COLLECT_TEST_PHYLOGENIES();
+  SYSTEMATICS_MODE = config.SYSTEMATICS_MODE();
+  SYSTEMATICS_KEYFRAME_INTERVAL = config.SYSTEMATICS_KEYFRAME_INTERVAL();
+  SYSTEMATICS_MAX_MB = config.SYSTEMATICS_MAX_MB();
+  CHECKPOINT_INTERVAL = config.CHECKPOINT_INTERVAL();
+  CHECKPOINT_FILE = config.CHECKPOINT_FILE();
 
 }
 
 void SortingNetworkExperiment::InitNetworkPop_Random() {
-  std::cout << "Randomly initializing sorting network population...";
+  ExpLog() << "Randomly initializing sorting network population...";
   // Inject random networks into network world up to population size.
   for (size_t i = 0; i < NETWORK_POP_SIZE; ++i) {
     network_world->Inject(network_genome_t(*random, SORT_SIZE, MIN_NETWORK_SIZE, MAX_NETWORK_SIZE), 1);
   }
-  std::cout << " Done." << std::endl;
+  ExpLog() << " Done." << std::endl;
 }
 
 void SortingNetworkExperiment::InitTestPop_Random() {
-  std::cout << "Random initializing sorting test population...";
+  ExpLog() << "Random initializing sorting test population...";
   for (size_t i = 0; i < TEST_POP_SIZE; ++i) {
     test_world->Inject(test_genome_t(*random, SORT_SIZE, SORTS_PER_TEST), 1);
   }
-  std::cout << " Done." << std::endl;
+  ExpLog() << " Done." << std::endl;
 }
 
+/// Capture the network population (and the correctness sample); the snapshot writer evaluates
+/// networks against the sample, formats, and writes the snapshot in the background.
 void SortingNetworkExperiment::SnapshotNetworks() {
-  std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(network_world->GetUpdate());
-  mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-  
-  emp::DataFile file(snapshot_dir + "/network_pop_" + emp::to_string((int)network_world->GetUpdate()) + ".csv");
-
-  // Add functions to data file
-  // - networkID
-  file.AddFun(get_networkID, "network_id", "Network ID");
-  // - Fitness
-  file.AddFun(get_network_fitness, "fitness", "");
-  // - pass total
-  file.AddFun(get_network_pass_total, "pass_total", "");
-  
-  file.AddFun(get_network_sample_correct, "sample_passes");
-  file.AddFun(get_network_possible_sample_correct, "sample_size");
-
-  // - network size
-  file.AddFun(get_network_size, "network_size");
-  // - num_antagonists
-  file.AddFun(get_network_antagonist_cnt, "num_antagonists");
-  // - tests per antagonist
-  file.AddFun(get_network_sorts_per_antagonist, "sorts_per_antagonist");
-  // - antagonist scores]
-  file.AddFun(get_network_passes_by_antagonist, "scores_by_antagonist");
-  // - network
-  file.AddFun(get_network, "network");
-
-  // Output file headers
-  file.PrintHeaderKeys();
-
-  // For each network in the population, dump the network and anything we want to know about it.
-  complete_test_set.SuffleTestIDs(*random);
+  struct NetworkImage {
+    size_t id;
+    double fitness;
+    network_org_t org;
+    emp::vector<size_t> test_results;   ///< Copied (org's phenotype views scores that the next evaluation overwrites).
+  };
+  const size_t snapshot_update = network_world->GetUpdate();
+  const std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(snapshot_update);
+  const size_t sorts_per_antagonist = SORTS_PER_TEST;
+  auto image = std::make_shared<emp::vector<NetworkImage>>();
+  image->reserve(network_world->GetSize());
   for (curIDs.networkID = 0; curIDs.networkID < network_world->GetSize(); ++curIDs.networkID) {
     if (!network_world->IsOccupied(curIDs.networkID)) continue;
-    file.Update();
+    network_org_t & network = network_world->GetOrg(curIDs.networkID);
+    image->emplace_back(NetworkImage{curIDs.networkID, get_network_fitness(), network, network.GetPhenotype().test_results.ToVector()});
   }
-  
+  // Draw the correctness sample here (uses the experiment's random number generator).
+  complete_test_set.SuffleTestIDs(*random);
+  auto sample = std::make_shared<emp::vector<SortingTest>>();
+  sample->reserve(CORRECTNESS_SAMPLE_SIZE);
+  for (size_t i = 0; i < CORRECTNESS_SAMPLE_SIZE; ++i) {
+    sample->emplace_back(complete_test_set.tests[complete_test_set.testIDs[i]]);
+  }
+
+  const bool columnar = OUTPUT_FORMAT == OUTPUT_FORMATS::COLUMNAR_OUTPUT;
+  snapshot_writer.Submit([image, sample, snapshot_dir, snapshot_update, sorts_per_antagonist, columnar]() {
+    SnapshotWriter::MakeDir(snapshot_dir);
+    const std::string fpath = snapshot_dir + "/network_pop_" + emp::to_string((int)snapshot_update);
+    if (columnar) {
+      ColumnarWriter file(fpath + ".col");
+      NetworkImage * row = nullptr;
+      size_t sample_passes = 0;
+      file.AddUInt([&row]() { return row->id; }, "network_id");
+      file.AddDouble([&row]() { return row->fitness; }, "fitness");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_passes; }, "pass_total");
+      file.AddUInt([&sample_passes]() { return sample_passes; }, "sample_passes");
+      file.AddUInt([&sample]() { return sample->size(); }, "sample_size");
+      file.AddUInt([&row]() { return row->org.GetSize(); }, "network_size");
+      file.AddUInt([&row]() { return row->test_results.size(); }, "num_antagonists");
+      file.AddUInt([sorts_per_antagonist]() { return sorts_per_antagonist; }, "sorts_per_antagonist");
+      file.AddUIntList([&row]() { return MakeColumnarList(row->test_results); }, "scores_by_antagonist");
+      file.AddUIntList([&row]() { return MakeNetworkList(row->org.GetGenome()); }, "network", "pairs");
+      for (NetworkImage & cur : *image) {
+        row = &cur;
+        sample_passes = 0;
+        for (const SortingTest & test : *sample) sample_passes += (size_t)test.Evaluate(cur.org.GetGenome());
+        file.Update();
+      }
+      return;
+    }
+    std::ofstream file(fpath + ".csv");
+    file << "network_id,fitness,pass_total,sample_passes,sample_size,network_size,num_antagonists,"
+         << "sorts_per_antagonist,scores_by_antagonist,network\n";
+    for (NetworkImage & row : *image) {
+      SortingNetworkOrg::Phenotype & phen = row.org.GetPhenotype();
+      size_t sample_passes = 0;
+      for (const SortingTest & test : *sample) sample_passes += (size_t)test.Evaluate(row.org.GetGenome());
+      file << row.id << "," << row.fitness << "," << phen.num_passes << ","
+           << sample_passes << "," << sample->size() << ","
+           << row.org.GetSize() << "," << row.test_results.size() << ","
+           << sorts_per_antagonist << ",\"[";
+      for (size_t i = 0; i < row.test_results.size(); ++i) file << (i ? "," : "") << row.test_results[i];
+      file << "]\",\"";
+      row.org.GetGenome().Print(file, ",");
+      file << "\"\n";
+    }
+  });
 }
 
+/// Capture the test population; the snapshot writer formats and writes it in the background.
 void SortingNetworkExperiment::SnapshotTests() {
-  std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(test_world->GetUpdate());
-  mkdir(snapshot_dir.c_str(), ACCESSPERMS);
-
-  emp::DataFile file(snapshot_dir + "/test_pop_" + emp::to_string((int)test_world->GetUpdate()) + ".csv");  
-
-  file.AddFun(get_testID, "test_id");
-  file.AddFun(get_test_fitness, "fitness");
-  file.AddFun(get_test_pass_total, "pass_total");
-  file.AddFun(get_test_fail_total, "fail_total");
-  file.AddFun(get_test_sorts_per_antagonist, "sorts_per_antagonist");
-  file.AddFun(get_test_passes_by_antagonist, "passes_by_antagonist");
-  file.AddFun(get_test_size, "test_size");
-  file.AddFun(get_test, "test");
-
-  // Output file headers
-  file.PrintHeaderKeys();
-
-  // For each test in the population, dump the test and anything we want to know about it.
+  struct TestImage {
+    size_t id;
+    double fitness;
+    test_org_t org;
+    emp::vector<size_t> test_results;   ///< Copied (org's phenotype views scores that the next evaluation overwrites).
+  };
+  const size_t snapshot_update = test_world->GetUpdate();
+  const std::string snapshot_dir = DATA_DIRECTORY + "pop_" + emp::to_string(snapshot_update);
+  auto image = std::make_shared<emp::vector<TestImage>>();
+  image->reserve(test_world->GetSize());
   for (curIDs.testID = 0; curIDs.testID < test_world->GetSize(); ++curIDs.testID) {
     if (!test_world->IsOccupied(curIDs.testID)) continue;
-    file.Update();
+    test_org_t & test = test_world->GetOrg(curIDs.testID);
+    image->emplace_back(TestImage{curIDs.testID, get_test_fitness(), test, test.GetPhenotype().test_results.ToVector()});
   }
+
+  const bool columnar = OUTPUT_FORMAT == OUTPUT_FORMATS::COLUMNAR_OUTPUT;
+  snapshot_writer.Submit([image, snapshot_dir, snapshot_update, columnar]() {
+    SnapshotWriter::MakeDir(snapshot_dir);
+    const std::string fpath = snapshot_dir + "/test_pop_" + emp::to_string((int)snapshot_update);
+    if (columnar) {
+      ColumnarWriter file(fpath + ".col");
+      TestImage * row = nullptr;
+      const size_t test_size = image->size() ? image->front().org.GetTestSize() : 1;
+      file.AddUInt([&row]() { return row->id; }, "test_id");
+      file.AddDouble([&row]() { return row->fitness; }, "fitness");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_passes; }, "pass_total");
+      file.AddUInt([&row]() { return row->org.GetPhenotype().num_fails; }, "fail_total");
+      file.AddUInt([&row]() { return row->org.GetNumTests(); }, "sorts_per_antagonist");
+      file.AddUIntList([&row]() { return MakeColumnarList(row->test_results); }, "passes_by_antagonist");
+      file.AddUInt([&row]() { return row->org.GetTestSize(); }, "test_size");
+      file.AddUIntList([&row]() {
+        emp::vector<uint64_t> vals;
+        for (const SortingTest & test : row->org.GetTestSet()) {
+          for (size_t i = 0; i < test.GetSize(); ++i) vals.emplace_back((uint64_t)test[i]);
+        }
+        return vals;
+      }, "test", "groups:" + emp::to_string(test_size));
+      for (TestImage & cur : *image) { row = &cur; file.Update(); }
+      return;
+    }
+    std::ofstream file(fpath + ".csv");
+    file << "test_id,fitness,pass_total,fail_total,sorts_per_antagonist,passes_by_antagonist,test_size,test\n";
+    for (TestImage & row : *image) {
+      SortingTestOrg::Phenotype & phen = row.org.GetPhenotype();
+      file << row.id << "," << row.fitness << "," << phen.num_passes << "," << phen.num_fails << ","
+           << row.org.GetNumTests() << ",\"[";
+      for (size_t i = 0; i < row.test_results.size(); ++i) file << (i ? "," : "") << row.test_results[i];
+      file << "]\"," << row.org.GetTestSize() << ",\"";
+      row.org.PrintMin(file);
+      file << "\"\n";
+    }
+  });
 }
 
 size_t SortingNetworkExperiment::EvaluateNetworkOrg(const SortingNetworkOrg & network,
                                                     const SortingTestOrg & test) const {
   size_t passes = 0;
-  for (size_t i = 0; i < test.GetNumTests(); ++i) {
-    passes += (size_t)(test.GetGenome().test_set[i].Evaluate(network.GetGenome()));
+  const emp::vector<SortingTest> & tests = test.GetTestSet();
+  for (size_t i = 0; i < tests.size(); ++i) {
+    passes += (size_t)(tests[i].Evaluate(network.GetGenome()));
   }
   return passes;                                                    
 }
 
+/// Duplicates of a test the network has already been evaluated against (this generation) reuse its
+/// result.
+size_t SortingNetworkExperiment::EvaluateNetworkOrgOnTest(const SortingNetworkOrg & network, size_t testID) {
+  return network_test_results.Get(test_index.GetUniqueID(testID), [this, &network, testID]() {
+    test_eval_cnt += test_world->GetOrg(testID).GetNumTests();
+    return EvaluateNetworkOrg(network, test_world->GetOrg(testID));
+  });
+}
+
+/// Serialize experiment state. Only valid between generations (after RunStep): phenotypes are reset
+/// on placement and cohorts are re-randomized each evaluation, so neither is saved.
+/// Background solution screening finishes queued candidates first, then its screened genome hashes
+/// and unwritten solutions are saved.
+void SortingNetworkExperiment::WriteCheckpoint(std::ostream & out) {
+  CheckpointWrite(out, (uint64_t)smallest_known_sol_size);
+  CheckpointWrite(out, network_pop_ids.popIDs);
+  // Complete test set is kept in fail-fast order.
+  CheckpointWrite(out, (uint64_t)complete_test_set.GetSize());
+  for (size_t i = 0; i < complete_test_set.GetSize(); ++i) {
+    CheckpointWrite(out, complete_test_set.tests[i].GetTest());
+  }
+  CheckpointWrite(out, complete_test_set.fail_counts);
+  // Worlds
+  CheckpointWrite(out, (uint64_t)network_world->GetUpdate());
+  CheckpointWriteWorld(out, *network_world);
+  CheckpointWriteScreener(out, sol_screener, [](std::ostream & out, const SolutionCandidate & candidate) {
+    CheckpointWrite(out, (uint64_t)candidate.update);
+    CheckpointWrite(out, (uint64_t)candidate.networkID);
+    CheckpointWrite(out, candidate.fitness);
+    CheckpointWrite(out, (uint64_t)candidate.pass_total);
+    CheckpointWrite(out, (uint64_t)candidate.antagonist_cnt);
+    CheckpointIO<network_genome_t>::Write(out, candidate.genome);
+  });
+  CheckpointWrite(out, (uint64_t)test_world->GetUpdate());
+  CheckpointWriteWorld(out, *test_world);
+  if (COLLECT_TEST_PHYLOGENIES) {
+    CheckpointWriteSystematics(out, *test_genotypic_systematics);
+    test_sys_compactor.WriteCheckpoint(out);
+  }
+  // Random number generator goes last.
+  CheckpointWrite(out, *random);
+}
+
+void SortingNetworkExperiment::ReadCheckpoint(std::istream & in) {
+  uint64_t val = 0;
+  CheckpointRead(in, val); smallest_known_sol_size = (size_t)val;
+  CheckpointRead(in, network_pop_ids.popIDs);
+  CheckpointRead(in, val);
+  if (val != complete_test_set.GetSize()) {
+    ExpLog() << "Checkpoint complete test set size (" << val << ") does not match configuration. Exiting." << std::endl;
+    exit(-1);
+  }
+  for (size_t i = 0; i < complete_test_set.GetSize(); ++i) {
+    CheckpointRead(in, complete_test_set.tests[i].GetTest());
+  }
+  CheckpointRead(in, complete_test_set.fail_counts);
+  // Worlds
+  CheckpointRead(in, val);
+  CheckpointReadWorld(in, *network_world);
+  SetWorldUpdate(*network_world, (size_t)val);
+  CheckpointReadScreener(in, sol_screener, [this](std::istream & in) {
+    SolutionCandidate candidate{0, 0, 0.0, 0, 0, network_world->GetGenomeAt(0)};
+    uint64_t val = 0;
+    CheckpointRead(in, val); candidate.update = (size_t)val;
+    CheckpointRead(in, val); candidate.networkID = (size_t)val;
+    CheckpointRead(in, candidate.fitness);
+    CheckpointRead(in, val); candidate.pass_total = (size_t)val;
+    CheckpointRead(in, val); candidate.antagonist_cnt = (size_t)val;
+    CheckpointIO<network_genome_t>::Read(in, candidate.genome);
+    return candidate;
+  });
+  CheckpointRead(in, val);
+  CheckpointReadWorld(in, *test_world);
+  SetWorldUpdate(*test_world, (size_t)val);
+  if (COLLECT_TEST_PHYLOGENIES) {
+    CheckpointReadSystematics(in, *test_genotypic_systematics);
+    test_sys_compactor.ReadCheckpoint(in);
+  }
+  // Random number generator goes last.
+  CheckpointRead(in, *random);
+}
+
+bool SortingNetworkExperiment::DoCheckpoint() {
+  const int sig = TakeCheckpointSignal();
+  const bool scheduled = CHECKPOINT_INTERVAL && update && (update % CHECKPOINT_INTERVAL == 0);
+  if (!sig && !scheduled) return false;
+  const std::string checkpoint_fpath = DATA_DIRECTORY + CHECKPOINT_FILE;
+  ExpLog() << "Checkpointing at update " << update << " (" << checkpoint_fpath << ")" << std::endl;
+  // Serialize state now (so next generation can proceed); write it out in the background.
+  std::ostringstream out;
+  WriteCheckpointHeader(out, "SortingNetworkExperiment", update + 1, data_files);
+  WriteCheckpoint(out);
+  checkpoint_writer.Write(checkpoint_fpath, out.str());
+  if (sig == SIGTERM) {
+    checkpoint_writer.Wait();
+    ExpLog() << "SIGTERM received; stopping after checkpoint." << std::endl;
+    return true;
+  }
+  return false;
+}
+
 void SortingNetworkExperiment::SetupSolutionsFile() {
-  sol_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/solutions.csv");
+  const bool columnar = OUTPUT_FORMAT == OUTPUT_FORMATS::COLUMNAR_OUTPUT;
+  if (columnar) {
+    sol_col_file = emp::NewPtr<ColumnarWriter>(DATA_DIRECTORY + "/solutions.col", 1);
+  } else {
+    sol_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/solutions.csv");
+  }
 
   do_sol_screen_sig.AddAction([this]() {
     // - For each potential solution -> is_correct? -> if so, sol_file.update
-    complete_test_set.swap_id = 0;
     for (curIDs.networkID = 0; curIDs.networkID < network_world->GetSize(); ++curIDs.networkID) {
       // Is network a candidate for solution-checking?
       network_org_t & network = network_world->GetOrg(curIDs.networkID);
-      if (network.GetPhenotype().num_passes == MAX_PASSES) {
-        bool correct = complete_test_set.Correct(network_world->GetOrg(curIDs.networkID).GetGenome());
-        if (correct) sol_file->Update();
-      }
+      if (network.GetPhenotype().num_passes == MAX_PASSES) SubmitSolutionCandidate(curIDs.networkID);
     }
-
+    WriteScreenedSolutions();
   });
   
-  std::function<size_t(void)> get_update = [this]() { return network_world->GetUpdate(); };
-  
-  std::function<double(void)> get_evaluations = [this]() { // --bookmark--
+  auto calc_evaluations = [this](size_t u) -> double { // --bookmark--
     if (SELECTION_MODE == SELECTION_METHODS::COHORT_LEXICASE) {
       // evals = update * (test cohort size * program cohort size * num cohorts)
-      return network_world->GetUpdate() * COHORT_SIZE * COHORT_SIZE * network_cohorts.GetNumCohorts();
+      return u * COHORT_SIZE * COHORT_SIZE * network_cohorts.GetNumCohorts();
     } else {
-      return network_world->GetUpdate() * network_world->GetSize() * test_world->GetSize();
+      return u * network_world->GetSize() * test_world->GetSize();
     }
   };
 
+  // Column values come from the candidate captured when the solution was first seen.
+  std::function<size_t(void)> get_update = [this]() { return cur_solution->update; };
+  std::function<double(void)> get_evaluations = [this, calc_evaluations]() { return calc_evaluations(cur_solution->update); };
+  std::function<size_t(void)> get_sol_networkID = [this]() { return cur_solution->networkID; };
+  std::function<double(void)> get_sol_fitness = [this]() { return cur_solution->fitness; };
+  std::function<size_t(void)> get_sol_pass_total = [this]() { return cur_solution->pass_total; };
+  std::function<size_t(void)> get_sol_size = [this]() { return cur_solution->genome.GetSize(); };
+  std::function<size_t(void)> get_sol_antagonist_cnt = [this]() { return cur_solution->antagonist_cnt; };
+  std::function<std::string(void)> get_sol_network = [this]() {
+    std::ostringstream stream;
+    stream << "\"";
+    cur_solution->genome.Print(stream, ",");
+    stream << "\"";
+    return stream.str();
+  };
+  std::function<emp::vector<uint64_t>(void)> get_sol_network_list = [this]() { return MakeNetworkList(cur_solution->genome); };
 
-  sol_file->AddFun(get_update, "update");
-  sol_file->AddFun(get_evaluations, "evaluations");
+  // Each worker verifies against its own copy of the complete test set (Correct reorders tests).
+  // With no workers, queued candidates are verified when drained (see WriteScreenedSolutions).
+  sol_screener.Configure(SOLUTION_SCREEN_THREADS, SOLUTION_SCREEN_QUEUE_SIZE, SOLUTION_SCREEN_CACHE_SIZE, [this]() {
+    std::shared_ptr<CompleteTestSet> tests = std::make_shared<CompleteTestSet>(complete_test_set);
+    return [tests](const SolutionCandidate & candidate) { return tests->Correct(candidate.genome); };
+  });
 
-  sol_file->AddFun(get_networkID, "network_id", "Network ID");
-  
-  sol_file->AddFun(get_network_fitness, "fitness");
-  sol_file->AddFun(get_network_pass_total, "pass_total");
-  sol_file->AddFun(get_network_size, "network_size");
-  sol_file->AddFun(get_network_antagonist_cnt, "num_antagonists");
-  sol_file->AddFun(get_network_sorts_per_antagonist, "sorts_per_antagonist");
-  sol_file->AddFun(get_network, "network");
+  // Solution and small solution files share columns (works for emp::DataFile and ColumnarWriter).
+  auto add_solution_columns = [&, this](auto & file) {
+    file.AddFun(get_update, "update");
+    file.AddFun(get_evaluations, "evaluations");
+    file.AddFun(get_sol_networkID, "network_id", "Network ID");
+    file.AddFun(get_sol_fitness, "fitness");
+    file.AddFun(get_sol_pass_total, "pass_total");
+    file.AddFun(get_sol_size, "network_size");
+    file.AddFun(get_sol_antagonist_cnt, "num_antagonists");
+    file.AddFun(get_network_sorts_per_antagonist, "sorts_per_antagonist");
+  };
   
-  sol_file->PrintHeaderKeys();
+  if (columnar) {
+    add_solution_columns(*sol_col_file);
+    sol_col_file->AddUIntList(get_sol_network_list, "network", "pairs");
+    sol_col_file->PrintHeaderKeys();
+    data_files.Add(*sol_col_file);
+  } else {
+    add_solution_columns(*sol_file);
+    sol_file->AddFun(get_sol_network, "network");
+    sol_file->PrintHeaderKeys();
+    data_files.Add(*sol_file, DATA_DIRECTORY + "/solutions.csv");
+  }
 
   // Setup small sol file (will only have 1 solution per size found)
-  small_sol_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/small_solutions.csv");
-
-  do_small_sol_screen_sig.AddAction([this](size_t id) {
-    curIDs.networkID = id;
-    network_org_t & network = network_world->GetOrg(id);
-    if (network.GetPhenotype().num_passes == MAX_PASSES && network.GetSize() < smallest_known_sol_size) {
-      bool correct = complete_test_set.Correct(network.GetGenome());
-      if (correct) {
-        smallest_known_sol_size = network.GetSize();
-        small_sol_file->Update();
-      }
-    }
-  });
+  if (columnar) {
+    small_sol_col_file = emp::NewPtr<ColumnarWriter>(DATA_DIRECTORY + "/small_solutions.col", 1);
+  } else {
+    small_sol_file = emp::NewPtr<emp::DataFile>(DATA_DIRECTORY + "/small_solutions.csv");
+  }
 
-  small_sol_file->AddFun(get_update, "update");
-  small_sol_file->AddFun(get_evaluations, "evaluations");
-  small_sol_file->AddFun(get_networkID, "network_id", "Network ID");
-  small_sol_file->AddFun(get_network_fitness, "fitness");
-  small_sol_file->AddFun(get_network_pass_total, "pass_total");
-  small_sol_file->AddFun(get_network_size, "network_size");
-  small_sol_file->AddFun(get_network_antagonist_cnt, "num_antagonists");
-  small_sol_file->AddFun(get_network_sorts_per_antagonist, "sorts_per_antagonist");
-  small_sol_file->AddFun(get_network, "network");
-  small_sol_file->PrintHeaderKeys();
+  if (columnar) {
+    add_solution_columns(*small_sol_col_file);
+    small_sol_col_file->AddUIntList(get_sol_network_list, "network", "pairs");
+    small_sol_col_file->PrintHeaderKeys();
+    data_files.Add(*small_sol_col_file);
+  } else {
+    add_solution_columns(*small_sol_file);
+    small_sol_file->AddFun(get_sol_network, "network");
+    small_sol_file->PrintHeaderKeys();
+    data_files.Add(*small_sol_file, DATA_DIRECTORY + "/small_solutions.csv");
+  }
+
+}
+
+void SortingNetworkExperiment::SubmitSolutionCandidate(size_t nID) {
+  network_org_t & network = network_world->GetOrg(nID);
+  const uint64_t hash = HashNetwork(network.GetGenome());
+  sol_screener.Submit(hash, {network_world->GetUpdate(), nID, network_world->CalcFitnessID(nID), network.GetPhenotype().num_passes,
+                             network.GetPhenotype().test_results.size(), network.GetGenome()});
+}
 
+/// Every confirmed solution goes to the solutions file; solutions smaller than the smallest known
+/// solution (in the order they were first seen) also go to the small solutions file.
+void SortingNetworkExperiment::WriteScreenedSolutions() {
+  emp::vector<SolutionCandidate> solutions(sol_screener.Drain());
+  if (solutions.empty()) return;
+  std::stable_sort(solutions.begin(), solutions.end(), [](const SolutionCandidate & a, const SolutionCandidate & b) {
+    return a.update < b.update;
+  });
+  for (const SolutionCandidate & solution : solutions) {
+    cur_solution = &solution;
+    if (sol_col_file != nullptr) sol_col_file->Update();
+    else sol_file->Update();
+    if (solution.genome.GetSize() < smallest_known_sol_size) {
+      smallest_known_sol_size = solution.genome.GetSize();
+      if (small_sol_col_file != nullptr) small_sol_col_file->Update();
+      else small_sol_file->Update();
+    }
+  }
+  cur_solution = nullptr;
 }
 
 #endif
\ No newline at end of file
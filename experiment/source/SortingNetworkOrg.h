@@ -5,18 +5,21 @@
 #include "base/vector.h"
 #include "tools/Random.h"
 
+#include "ScoreMatrix.h"
 #include "SortingNetwork.h"
 
 class SortingNetworkOrg {
 public:
   
   struct Phenotype {
-    emp::vector<size_t> test_results; ///< Correspond to passes per-test org evaluated against!
+    ScoreView<size_t> test_results; ///< Correspond to passes per-test org evaluated against! (Row of the experiment's score matrix.)
     size_t num_passes;
 
-    void Reset(size_t s=0) { 
-      test_results.clear(); 
-      test_results.resize(s, 0); 
+    Phenotype() : test_results(), num_passes(0) { ; }
+
+    /// Bind to this evaluation's scores (unbound by default).
+    void Reset(const ScoreView<size_t> & results=ScoreView<size_t>()) { 
+      test_results = results; 
       num_passes = 0;
     }
   };
@@ -2,6 +2,7 @@
 #define SORTING_TEST_H
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 
 #include "base/array.h"
@@ -9,10 +10,154 @@
 #include "tools/Random.h"
 
 #include "SortingNetwork.h"
+#include "Instrumentation.h"
+
+#ifdef EXP_COMPACT_GENOMES
+
+/// Binary sorting test, bit-packed (bit i holds the value at site i; see EXP_COMPACT_GENOMES in
+/// SortingNetwork.h). Same interface as the default SortingTest, except that sites are accessed
+/// through SiteRef proxies.
+class SortingTest {
+public:
+  using test_t = uint64_t;
+  static constexpr size_t MAX_TEST_SIZE = 64;
+
+  /// Reference to one site (reads/writes the site's bit as an int).
+  class SiteRef {
+  protected:
+    test_t & bits;
+    size_t pos;
+  public:
+    SiteRef(test_t & _bits, size_t _pos) : bits(_bits), pos(_pos) { ; }
+    operator int() const { return (int)((bits >> pos) & 1); }
+    SiteRef & operator=(int val) {
+      emp_assert(val == 0 || val == 1, val);
+      bits = (bits & ~((test_t)1 << pos)) | ((test_t)(val != 0) << pos);
+      return *this;
+    }
+    SiteRef & operator=(const SiteRef & in) { return *this = (int)in; }
+  };
+
+protected:
+  test_t test;
+  uint32_t size;
+
+public:
+  SortingTest()
+    : test(0), size(0) { ; }
+  
+  SortingTest(emp::Random & rnd, size_t test_size, int min_val=0, int max_val=1)
+    : test(0), size((uint32_t)test_size) { RandomizeTest(rnd, test_size, min_val, max_val); }
+
+  SortingTest(size_t test_size) : test(0), size((uint32_t)test_size) { emp_assert(test_size <= MAX_TEST_SIZE); }
+
+  SortingTest(SortingTest &&) = default;
+  SortingTest(const SortingTest &) = default;
+
+  SortingTest & operator=(const SortingTest &) = default;
+  SortingTest & operator=(SortingTest &&) = default;
+
+  bool operator==(const SortingTest & in) const { return in.test == test && in.size == size; }
+  bool operator!=(const SortingTest & in) const { return !(in == *this); }
+  /// Same order as comparing site values lexicographically.
+  bool operator<(const SortingTest & in) const {
+    const test_t diff = test ^ in.test;
+    const size_t min_size = std::min(size, in.size);
+    const test_t first_diff = diff & (~diff + 1);
+    if (!diff || (min_size < MAX_TEST_SIZE && (first_diff >> min_size))) return size < in.size;
+    return !(test & first_diff);
+  }
+
+  SiteRef operator[](size_t id) {
+    emp_assert(id < size);
+    return SiteRef(test, id);
+  }
+
+  int operator[](size_t id) const {
+    emp_assert(id < size);
+    return (int)((test >> id) & 1);
+  }
+  
+  size_t GetSize() const { return size; }
+  test_t & GetTest() { return test; }
+
+  /// Bytes used by this test (for memory accounting).
+  size_t GetBytes() const { return sizeof(SortingTest); }
+
+  void SwapSites(size_t a, size_t b) {
+    const int val_a = (*this)[a];
+    (*this)[a] = (int)(*this)[b];
+    (*this)[b] = val_a;
+  }
+
+  void RandomizeTest(emp::Random & rnd, size_t test_size, int min_val=0, int max_val=1);
+  void RandomizeTest(emp::Random & rnd, int min_val=0, int max_val=1);
+
+  bool Evaluate(const SortingNetwork & network) const;
+
+  bool Validate(size_t test_size, int min_val, int max_val) const;
+
+  void Print(std::ostream & out=std::cout) const;
+
+};
+
+void SortingTest::RandomizeTest(emp::Random & rnd, size_t test_size, int min_val, int max_val) {
+  emp_assert(test_size <= MAX_TEST_SIZE);
+  size = (uint32_t)test_size;
+  RandomizeTest(rnd, min_val, max_val);
+}
+
+void SortingTest::RandomizeTest(emp::Random & rnd, int min_val, int max_val) {
+  // One draw per site (same random number stream as the default SortingTest).
+  test = 0;
+  for (size_t i = 0; i < size; ++i) (*this)[i] = rnd.GetInt(min_val, max_val+1);
+}
+
+bool SortingTest::Evaluate(const SortingNetwork & network) const {
+  emp_assert(network.Validate(size));
+  EXP_INSTRUMENT_COUNT(TESTS_EVALUATED, 1);
+  EXP_INSTRUMENT_COUNT(COMPARATOR_OPS, network.GetSize());
+  test_t bits = test;
+  const SortingNetwork::network_t & ops = network.GetNetwork();
+  for (size_t ni = 0; ni < ops.size(); ++ni) {
+    // Compare-exchange on bits: swap iff [head] is 1 and [tail] is 0.
+    const size_t i = ops[ni][0];
+    const size_t j = ops[ni][1];
+    const size_t head = std::min(i, j);
+    const size_t tail = std::max(i, j);
+    const test_t swap = (bits >> head) & ~(bits >> tail) & 1;
+    bits ^= (swap << head) | (swap << tail);
+  }
+  // Sorted iff no 1 is followed by a 0.
+  if (size < 2) return true;
+  const test_t inner = ((test_t)-1) >> (MAX_TEST_SIZE - (size - 1)); // Sites [0, size-1)
+  return !(bits & ~(bits >> 1) & inner);
+}
+
+bool SortingTest::Validate(size_t test_size, int min_val, int max_val) const {
+  if (size != test_size) return false;
+  for (size_t i = 0; i < size; ++i) {
+    const int val = (*this)[i];
+    if (val < min_val || val > max_val) return false;
+  }
+  return true;
+}
+
+void SortingTest::Print(std::ostream & out) const {
+  out << "[";
+  for (size_t i = 0; i < size; ++i) {
+    if (i) out << ",";
+    out << (*this)[i];
+  }
+  out << "]";
+}
+
+#else
 
 class SortingTest {
 public:
   using test_t = emp::vector<int>;
+  static constexpr size_t MAX_TEST_SIZE = (size_t)-1;
 
 protected:
   test_t test;
@@ -49,12 +194,17 @@ public:
   size_t GetSize() const { return test.size(); }
   test_t & GetTest() { return test; }
 
+  /// Bytes used by this test (for memory accounting).
+  size_t GetBytes() const { return sizeof(SortingTest) + test.size() * sizeof(int); }
+
+  void SwapSites(size_t a, size_t b) { std::swap(test[a], test[b]); }
+
   void RandomizeTest(emp::Random & rnd, size_t test_size, int min_val=0, int max_val=1);
   void RandomizeTest(emp::Random & rnd, int min_val=0, int max_val=1);
 
   bool Evaluate(const SortingNetwork & network) const;
 
-  bool Validate(size_t test_size, int min_val, int max_val);
+  bool Validate(size_t test_size, int min_val, int max_val) const;
 
   void Print(std::ostream & out=std::cout) const;
 
@@ -71,13 +221,16 @@ void SortingTest::RandomizeTest(emp::Random & rnd, int min_val, int max_val) {
 
 bool SortingTest::Evaluate(const SortingNetwork & network) const {
   emp_assert(network.Validate(test.size()));
+  EXP_INSTRUMENT_COUNT(TESTS_EVALUATED, 1);
+  EXP_INSTRUMENT_COUNT(COMPARATOR_OPS, network.GetSize());
   // Make copy of test to be sorted.
   test_t eval_test(test);
   // Evaluate the sorting network.
-  for (size_t ni = 0; ni < network.GetSize(); ++ni) {
+  const SortingNetwork::network_t & ops = network.GetNetwork();
+  for (size_t ni = 0; ni < ops.size(); ++ni) {
     // if [j] < [i] => swap([i],[j])
-    const size_t i = network[ni][0];
-    const size_t j = network[ni][1];
+    const size_t i = ops[ni][0];
+    const size_t j = ops[ni][1];
     
     size_t head;
     size_t tail;
@@ -92,7 +245,7 @@ bool SortingTest::Evaluate(const SortingNetwork & network) const {
   return std::is_sorted(std::begin(eval_test), std::end(eval_test));
 }
 
-bool SortingTest::Validate(size_t test_size, int min_val, int max_val) {
+bool SortingTest::Validate(size_t test_size, int min_val, int max_val) const {
   if (test.size() != test_size) return false; 
   for (size_t i = 0; i < test.size(); ++i) {
     if (test[i] < min_val || test[i] > max_val) return false;
@@ -109,6 +262,8 @@ void SortingTest::Print(std::ostream & out) const {
   out << "]";
 }
 
+#endif
+
 
 
 
@@ -1,22 +1,24 @@
 #ifndef SORTING_TEST_ORG_H
 #define SORTING_TEST_ORG_H
 
+#include "CopyOnWrite.h"
+#include "ScoreMatrix.h"
 #include "SortingTest.h"
 
 class SortingTestOrg {
 public:
 
   struct Genome {
-    emp::vector<SortingTest> test_set;
+    CopyOnWrite<emp::vector<SortingTest>> test_set;   ///< Shared between copies until one of them is edited.
     size_t test_size;
 
     Genome(size_t test_size, size_t num_tests=1) 
-      : test_set(num_tests, test_size), test_size(test_size) { ; }
+      : test_set(emp::vector<SortingTest>(num_tests, test_size)), test_size(test_size) { ; }
 
     Genome(emp::Random & rnd, size_t test_size, size_t num_tests=1)
-      : test_set(num_tests, test_size), test_size(test_size) 
+      : test_set(emp::vector<SortingTest>(num_tests, test_size)), test_size(test_size) 
     {
-        for (size_t i = 0; i < test_set.size(); ++i) test_set[i].RandomizeTest(rnd);
+        Randomize(rnd);
     }
 
     Genome(Genome &&) = default;
@@ -30,14 +32,16 @@ public:
     bool operator<(const Genome & in) const { return test_set < in.test_set; }
 
     void Randomize(emp::Random & rnd) {
-      for (size_t i = 0; i < test_set.size(); ++i) {
-        test_set[i].RandomizeTest(rnd);
+      emp::vector<SortingTest> & tests = test_set.Edit();
+      for (size_t i = 0; i < tests.size(); ++i) {
+        tests[i].RandomizeTest(rnd);
       }
     }
 
-    bool Validate(int min_val, int max_val) {
-      for (size_t tID = 0; tID < test_set.size(); ++tID) {
-        if (!test_set[tID].Validate(test_size, min_val, max_val)) return false;
+    bool Validate(int min_val, int max_val) const {
+      const emp::vector<SortingTest> & tests = test_set.Get();
+      for (size_t tID = 0; tID < tests.size(); ++tID) {
+        if (!tests[tID].Validate(test_size, min_val, max_val)) return false;
       }
       return true;
     }
@@ -45,13 +49,15 @@ public:
   };
 
   struct Phenotype {
-    emp::vector<size_t> test_results; ///< Correspond to per-organism passes, not per-test passes!
+    ScoreView<size_t> test_results; ///< Correspond to per-organism passes, not per-test passes! (Column of the experiment's score matrix.)
     size_t num_passes;
     size_t num_fails;
 
-    void Reset(size_t s=0) { 
-      test_results.clear(); 
-      test_results.resize(s, 0); 
+    Phenotype() : test_results(), num_passes(0), num_fails(0) { ; }
+
+    /// Bind to this evaluation's scores (unbound by default).
+    void Reset(const ScoreView<size_t> & results=ScoreView<size_t>()) { 
+      test_results = results; 
       num_passes = 0;
       num_fails = 0;
     }
@@ -77,9 +83,9 @@ public:
   
   SortingTestOrg(const genome_t & _g) : genome(_g), phenotype() { ; }
 
-  size_t GetNumTests() const { return genome.test_set.size(); }
+  size_t GetNumTests() const { return genome.test_set.Get().size(); }
   size_t GetTestSize() const { return genome.test_size; }
-  emp::vector<SortingTest> & GetTestSet() { return genome.test_set; }
+  const emp::vector<SortingTest> & GetTestSet() const { return genome.test_set.Get(); }
 
   genome_t & GetGenome() { return genome; }
   const genome_t & GetGenome() const { return genome; }
@@ -95,7 +101,7 @@ void SortingTestOrg::Print(std::ostream & out) const {
   out << "TestOrg(seqsize=" << GetTestSize() << "," << "numtests=" << GetNumTests() << "):\n";
   for (size_t i = 0; i < GetNumTests(); ++i) {
     out << "  Test[" << i << "]: "; 
-    genome.test_set[i].Print();
+    GetTestSet()[i].Print();
     out << "\n";
   }
 }
@@ -104,7 +110,7 @@ void SortingTestOrg::PrintMin(std::ostream & out) const {
   out << "[";
   for (size_t i = 0; i < GetNumTests(); ++i) {
     if (i) out << ",";
-    genome.test_set[i].Print(out);
+    GetTestSet()[i].Print(out);
   }
   out << "]";
 }
@@ -0,0 +1,46 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/// Immutable, reference-counted string handle. Copying a handle is O(1) (no string copy).
+using str_handle_t = std::shared_ptr<const std::string>;
+
+/// Make a new (non-interned) string handle.
+inline str_handle_t MakeStrHandle(const std::string & str) { return std::make_shared<const std::string>(str); }
+inline str_handle_t MakeStrHandle(std::string && str) { return std::make_shared<const std::string>(std::move(str)); }
+
+/// Interning pool for string handles.
+/// - Equal strings interned through the same pool share a single handle, so equality
+///   between interned handles is a pointer comparison.
+/// - Pool holds a reference to every interned string; use Prune to drop strings that
+///   are no longer referenced anywhere else.
+class StringPool {
+protected:
+  std::unordered_map<std::string, str_handle_t> pool;
+
+public:
+  size_t GetSize() const { return pool.size(); }
+
+  str_handle_t Intern(const std::string & str) {
+    auto it = pool.find(str);
+    if (it != pool.end()) return it->second;
+    str_handle_t handle(MakeStrHandle(str));
+    pool.emplace(str, handle);
+    return handle;
+  }
+
+  /// Drop all interned strings only referenced by this pool.
+  void Prune() {
+    for (auto it = pool.begin(); it != pool.end(); ) {
+      if (it->second.use_count() == 1) it = pool.erase(it);
+      else ++it;
+    }
+  }
+
+  void Clear() { pool.clear(); }
+};
+
+#endif
@@ -0,0 +1,330 @@
+#ifndef SYSTEMATICS_CHECKPOINT_H
+#define SYSTEMATICS_CHECKPOINT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "base/assert.h"
+#include "base/Ptr.h"
+#include "base/vector.h"
+#include "Evolve/Systematics.h"
+
+#include "Checkpoint.h"
+#include "CompactSystematics.h"
+
+/// Checkpointing for emp::Systematics (see Checkpoint.h): a resumed run continues the same
+/// phylogeny (taxon IDs, parents, counts, and times) instead of starting over from new roots.
+/// - Active and ancestor taxa are saved, along with the taxon at every world position. Outside taxa
+///   (only kept with store_all) are not.
+/// - emp::Systematics and emp::Taxon do not expose setters for their state, so restoring reaches
+///   their members the same way SetWorldUpdate does.
+/// - Taxon info is saved through CheckpointTaxonInfoIO, for every taxon at once (so that stored
+///   genomes shared between taxa stay shared; see the CompactGenome specialization).
+
+constexpr uint64_t CHECKPOINT_NO_TAXON = (uint64_t)-1;  ///< Saved in place of a missing taxon.
+constexpr uint64_t CHECKPOINT_NO_NODE = (uint64_t)-1;   ///< Saved in place of a dropped genome.
+
+/// Serialization hook for taxon info (defaults to CheckpointIO).
+template<typename INFO_T>
+struct CheckpointTaxonInfoIO {
+  static void Write(std::ostream & out, const emp::vector<const INFO_T *> & infos) {
+    for (const INFO_T * info : infos) CheckpointIO<INFO_T>::Write(out, *info);
+  }
+  /// Read count infos (into copies of info_template).
+  static emp::vector<INFO_T> Read(std::istream & in, size_t count, const INFO_T & info_template) {
+    emp::vector<INFO_T> infos(count, info_template);
+    for (INFO_T & info : infos) CheckpointIO<INFO_T>::Read(in, info);
+    return infos;
+  }
+};
+
+/// Compact genomes are saved as their stored nodes (keyframes and diffs, bases first), so a resumed
+/// run stores exactly what the original run did.
+template<typename GENOME_T>
+struct CheckpointTaxonInfoIO<CompactGenome<GENOME_T>> {
+  using info_t = CompactGenome<GENOME_T>;
+  using node_t = typename info_t::Node;
+  using node_ptr_t = typename info_t::node_ptr_t;
+  using traits_t = typename info_t::traits_t;
+
+  /// Keyframe genome that node is decoded from.
+  static const GENOME_T & GetKeyframe(const node_t & node) {
+    const node_t * cur = &node;
+    while (!cur->full) cur = cur->base.get();
+    return *cur->full;
+  }
+
+  static void Write(std::ostream & out, const emp::vector<const info_t *> & infos) {
+    // Number nodes, bases before the diffs built on them.
+    std::unordered_map<const node_t *, uint64_t> node_ids;
+    emp::vector<const node_t *> nodes;
+    emp::vector<const node_t *> path;
+    for (const info_t * info : infos) {
+      path.clear();
+      for (const node_t * cur = info->GetNode().get(); cur != nullptr && !node_ids.count(cur); cur = cur->base.get()) {
+        path.emplace_back(cur);
+      }
+      for (size_t i = path.size(); i-- > 0; ) {
+        node_ids[path[i]] = nodes.size();
+        nodes.emplace_back(path[i]);
+      }
+    }
+    CheckpointWrite(out, (uint64_t)nodes.size());
+    for (const node_t * node : nodes) {
+      CheckpointWrite(out, (uint8_t)(bool)node->full);
+      if (node->full) {
+        CheckpointIO<GENOME_T>::Write(out, *node->full);
+      } else {
+        CheckpointWrite(out, node_ids[node->base.get()]);
+        CheckpointWrite(out, (uint64_t)node->prefix);
+        CheckpointWrite(out, (uint64_t)node->suffix);
+        // Diff elements are saved as a genome (a copy of the diff's keyframe holding just them).
+        GENOME_T middle(GetKeyframe(*node));
+        traits_t::SetSeq(middle, typename info_t::seq_t(node->middle));
+        CheckpointIO<GENOME_T>::Write(out, middle);
+      }
+      CheckpointWrite(out, (uint64_t)node->chain);
+      CheckpointWrite(out, (uint64_t)node->bytes);
+      CheckpointWrite(out, (uint8_t)node->settled);
+      CheckpointWrite(out, (uint8_t)node->dropped);
+    }
+    for (const info_t * info : infos) {
+      CheckpointWrite(out, info->GetHash());
+      CheckpointWrite(out, info->HasGenome() ? node_ids[info->GetNode().get()] : CHECKPOINT_NO_NODE);
+    }
+  }
+
+  /// Read count infos (keyframes are read into copies of info_template's genome).
+  static emp::vector<info_t> Read(std::istream & in, size_t count, const info_t & info_template) {
+    emp_assert(info_template.HasGenome());
+    const GENOME_T genome_template(info_template.GetGenome());
+    uint64_t num_nodes = 0;
+    CheckpointRead(in, num_nodes);
+    emp::vector<node_ptr_t> nodes;
+    for (size_t i = 0; i < num_nodes && in; ++i) {
+      std::shared_ptr<node_t> node = std::make_shared<node_t>();
+      uint8_t flag = 0;
+      uint64_t val = 0;
+      CheckpointRead(in, flag);
+      if (flag) {
+        GENOME_T genome(genome_template);
+        CheckpointIO<GENOME_T>::Read(in, genome);
+        node->full = std::make_shared<const GENOME_T>(std::move(genome));
+      } else {
+        CheckpointRead(in, val);
+        if (val >= nodes.size()) break;
+        node->base = nodes[val];
+        CheckpointRead(in, val); node->prefix = (size_t)val;
+        CheckpointRead(in, val); node->suffix = (size_t)val;
+        GENOME_T middle(GetKeyframe(*node->base));
+        CheckpointIO<GENOME_T>::Read(in, middle);
+        node->middle = traits_t::GetSeq(middle);
+      }
+      CheckpointRead(in, val); node->chain = (size_t)val;
+      CheckpointRead(in, val); node->bytes = (size_t)val;
+      CheckpointRead(in, flag); node->settled = (bool)flag;
+      CheckpointRead(in, flag); node->dropped = (bool)flag;
+      nodes.emplace_back(node);
+    }
+    emp::vector<info_t> infos;
+    if (nodes.size() != num_nodes) {
+      in.setstate(std::ios::failbit);
+      return infos;
+    }
+    for (size_t i = 0; i < count && in; ++i) {
+      uint64_t hash = 0, node_id = 0;
+      CheckpointRead(in, hash);
+      CheckpointRead(in, node_id);
+      if (node_id != CHECKPOINT_NO_NODE && node_id >= nodes.size()) {
+        in.setstate(std::ios::failbit);
+        break;
+      }
+      infos.emplace_back(hash, (node_id == CHECKPOINT_NO_NODE) ? node_ptr_t() : nodes[node_id]);
+    }
+    return infos;
+  }
+};
+
+/// emp::Systematics members restored from checkpoints.
+template<typename SYSTEMATICS_T>
+struct SystematicsCheckpointAccess : public SYSTEMATICS_T {
+  static auto ActiveTaxa() { return &SystematicsCheckpointAccess::active_taxa; }
+  static auto AncestorTaxa() { return &SystematicsCheckpointAccess::ancestor_taxa; }
+  static auto TaxonLocations() { return &SystematicsCheckpointAccess::taxon_locations; }
+  static auto NextTaxonLocations() { return &SystematicsCheckpointAccess::next_taxon_locations; }
+  static auto NextParent() { return &SystematicsCheckpointAccess::next_parent; }
+  static auto MostRecent() { return &SystematicsCheckpointAccess::most_recent; }
+  static auto MRCA() { return &SystematicsCheckpointAccess::mrca; }
+  static auto NextID() { return &SystematicsCheckpointAccess::next_id; }
+  static auto OrgCount() { return &SystematicsCheckpointAccess::org_count; }
+  static auto TotalDepth() { return &SystematicsCheckpointAccess::total_depth; }
+  static auto NumRoots() { return &SystematicsCheckpointAccess::num_roots; }
+  static auto MaxDepth() { return &SystematicsCheckpointAccess::max_depth; }
+  static auto CurrUpdate() { return &SystematicsCheckpointAccess::curr_update; }
+};
+
+/// emp::Taxon counters restored from checkpoints.
+template<typename TAXON_T>
+struct TaxonCheckpointAccess : public TAXON_T {
+  static auto NumOrgs() { return &TaxonCheckpointAccess::num_orgs; }
+  static auto TotOrgs() { return &TaxonCheckpointAccess::tot_orgs; }
+  static auto NumOffspring() { return &TaxonCheckpointAccess::num_offspring; }
+  static auto TotalOffspring() { return &TaxonCheckpointAccess::total_offspring; }
+};
+
+/// Save a systematics manager's phylogeny.
+template<typename SYSTEMATICS_T>
+void CheckpointWriteSystematics(std::ostream & out, SYSTEMATICS_T & sys) {
+  using taxon_t = typename SYSTEMATICS_T::taxon_t;
+  using info_t = typename std::decay<decltype(std::declval<taxon_t>().GetInfo())>::type;
+  using access_t = SystematicsCheckpointAccess<SYSTEMATICS_T>;
+  // Taxa in ID order (parents before their offspring).
+  emp::vector<emp::Ptr<taxon_t>> taxa;
+  for (emp::Ptr<taxon_t> t : sys.GetActive()) taxa.emplace_back(t);
+  for (emp::Ptr<taxon_t> t : sys.GetAncestors()) taxa.emplace_back(t);
+  std::sort(taxa.begin(), taxa.end(), [](emp::Ptr<taxon_t> a, emp::Ptr<taxon_t> b) { return a->GetID() < b->GetID(); });
+  CheckpointWrite(out, sys.*(access_t::NextID()));
+  CheckpointWrite(out, sys.*(access_t::OrgCount()));
+  CheckpointWrite(out, sys.*(access_t::TotalDepth()));
+  CheckpointWrite(out, sys.*(access_t::NumRoots()));
+  CheckpointWrite(out, sys.*(access_t::MaxDepth()));
+  CheckpointWrite(out, sys.*(access_t::CurrUpdate()));
+  CheckpointWrite(out, (uint64_t)taxa.size());
+  emp::vector<const info_t *> infos;
+  for (emp::Ptr<taxon_t> t : taxa) {
+    CheckpointWrite(out, (uint64_t)t->GetID());
+    CheckpointWrite(out, (t->GetParent() != nullptr) ? (uint64_t)t->GetParent()->GetID() : CHECKPOINT_NO_TAXON);
+    CheckpointWrite(out, (uint8_t)sys.GetActive().count(t));
+    CheckpointWrite(out, (uint64_t)t->GetNumOrgs());
+    CheckpointWrite(out, (uint64_t)t->GetTotOrgs());
+    CheckpointWrite(out, (uint64_t)t->GetNumOff());
+    CheckpointWrite(out, (uint64_t)t->GetTotalOffspring());
+    CheckpointWrite(out, (double)t->GetOriginationTime());
+    CheckpointWrite(out, (double)t->GetDestructionTime());
+    infos.emplace_back(&t->GetInfo());
+  }
+  CheckpointTaxonInfoIO<info_t>::Write(out, infos);
+  const auto & locations = sys.*(access_t::TaxonLocations());
+  CheckpointWrite(out, (uint64_t)locations.size());
+  for (const auto & t : locations) CheckpointWrite(out, (t != nullptr) ? (uint64_t)t->GetID() : CHECKPOINT_NO_TAXON);
+}
+
+/// Replace a systematics manager's phylogeny with one saved by CheckpointWriteSystematics. Call
+/// after the world it tracks has been restored (CheckpointReadWorld injects organisms as new roots,
+/// which are replaced here). Leaves the systematics manager untouched if the checkpoint is invalid
+/// (check in's state).
+template<typename SYSTEMATICS_T>
+void CheckpointReadSystematics(std::istream & in, SYSTEMATICS_T & sys) {
+  using taxon_t = typename SYSTEMATICS_T::taxon_t;
+  using info_t = typename std::decay<decltype(std::declval<taxon_t>().GetInfo())>::type;
+  using access_t = SystematicsCheckpointAccess<SYSTEMATICS_T>;
+  using taxon_access_t = TaxonCheckpointAccess<taxon_t>;
+  struct TaxonRecord {
+    uint64_t id;
+    uint64_t parent_id;
+    uint8_t active;
+    uint64_t num_orgs;
+    uint64_t tot_orgs;
+    uint64_t num_offspring;
+    uint64_t total_offspring;
+    double origination_time;
+    double destruction_time;
+  };
+  emp_assert(sys.GetActive().size(), "Restore the world before its systematics.");
+  const info_t info_template((*sys.GetActive().begin())->GetInfo());
+  auto next_id = sys.*(access_t::NextID());
+  auto org_count = sys.*(access_t::OrgCount());
+  auto total_depth = sys.*(access_t::TotalDepth());
+  auto num_roots = sys.*(access_t::NumRoots());
+  auto max_depth = sys.*(access_t::MaxDepth());
+  auto curr_update = sys.*(access_t::CurrUpdate());
+  CheckpointRead(in, next_id);
+  CheckpointRead(in, org_count);
+  CheckpointRead(in, total_depth);
+  CheckpointRead(in, num_roots);
+  CheckpointRead(in, max_depth);
+  CheckpointRead(in, curr_update);
+  uint64_t num_taxa = 0;
+  CheckpointRead(in, num_taxa);
+  emp::vector<TaxonRecord> records;
+  std::unordered_map<uint64_t, size_t> record_ids;  // Taxon ID -> record.
+  for (size_t i = 0; i < num_taxa && in; ++i) {
+    TaxonRecord r;
+    CheckpointRead(in, r.id);
+    CheckpointRead(in, r.parent_id);
+    CheckpointRead(in, r.active);
+    CheckpointRead(in, r.num_orgs);
+    CheckpointRead(in, r.tot_orgs);
+    CheckpointRead(in, r.num_offspring);
+    CheckpointRead(in, r.total_offspring);
+    CheckpointRead(in, r.origination_time);
+    CheckpointRead(in, r.destruction_time);
+    // Parents must come first.
+    if (r.parent_id != CHECKPOINT_NO_TAXON && !record_ids.count(r.parent_id)) in.setstate(std::ios::failbit);
+    record_ids[r.id] = records.size();
+    records.emplace_back(r);
+  }
+  if (!in) return;
+  emp::vector<info_t> infos(CheckpointTaxonInfoIO<info_t>::Read(in, records.size(), info_template));
+  emp::vector<uint64_t> location_ids;
+  CheckpointRead(in, location_ids);
+  for (uint64_t id : location_ids) {
+    if (id != CHECKPOINT_NO_TAXON && !record_ids.count(id)) in.setstate(std::ios::failbit);
+  }
+  if (!in || infos.size() != records.size()) {
+    in.setstate(std::ios::failbit);
+    return;
+  }
+  // Replace current taxa.
+  auto & active_taxa = sys.*(access_t::ActiveTaxa());
+  auto & ancestor_taxa = sys.*(access_t::AncestorTaxa());
+  for (emp::Ptr<taxon_t> t : active_taxa) t.Delete();
+  for (emp::Ptr<taxon_t> t : ancestor_taxa) t.Delete();
+  active_taxa.clear();
+  ancestor_taxa.clear();
+  emp::vector<emp::Ptr<taxon_t>> taxa;
+  taxa.reserve(records.size());
+  for (size_t i = 0; i < records.size(); ++i) {
+    const TaxonRecord & r = records[i];
+    emp::Ptr<taxon_t> parent = (r.parent_id != CHECKPOINT_NO_TAXON) ? taxa[record_ids[r.parent_id]] : nullptr;
+    emp::Ptr<taxon_t> t = emp::NewPtr<taxon_t>((size_t)r.id, infos[i], parent);
+    if (parent != nullptr) parent->AddOffspring(t);
+    taxa.emplace_back(t);
+    if (r.active) active_taxa.insert(t);
+    else ancestor_taxa.insert(t);
+  }
+  // Counters last (AddOffspring updates offspring counts along the way).
+  for (size_t i = 0; i < records.size(); ++i) {
+    const TaxonRecord & r = records[i];
+    taxon_t & t = *taxa[i];
+    t.*(taxon_access_t::NumOrgs()) = (size_t)r.num_orgs;
+    t.*(taxon_access_t::TotOrgs()) = (size_t)r.tot_orgs;
+    t.*(taxon_access_t::NumOffspring()) = (size_t)r.num_offspring;
+    t.*(taxon_access_t::TotalOffspring()) = (size_t)r.total_offspring;
+    t.SetOriginationTime(r.origination_time);
+    t.SetDestructionTime(r.destruction_time);
+  }
+  auto & locations = sys.*(access_t::TaxonLocations());
+  locations.clear();
+  for (uint64_t id : location_ids) {
+    if (id == CHECKPOINT_NO_TAXON) locations.emplace_back(nullptr);
+    else locations.emplace_back(taxa[record_ids[id]]);
+  }
+  (sys.*(access_t::NextTaxonLocations())).clear();
+  sys.*(access_t::NextParent()) = nullptr;
+  sys.*(access_t::MostRecent()) = nullptr;
+  sys.*(access_t::MRCA()) = nullptr;  // Recalculated on demand.
+  sys.*(access_t::NextID()) = next_id;
+  sys.*(access_t::OrgCount()) = org_count;
+  sys.*(access_t::TotalDepth()) = total_depth;
+  sys.*(access_t::NumRoots()) = num_roots;
+  sys.*(access_t::MaxDepth()) = max_depth;
+  sys.*(access_t::CurrUpdate()) = curr_update;
+}
+
+#endif
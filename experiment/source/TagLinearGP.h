@@ -12,7 +12,10 @@
 #include "tools/Random.h"
 #include "tools/string_utils.h"
 
+#include "CopyOnWrite.h"
+#include "InlineVector.h"
 #include "TagLinearGP_InstLib.h"
+#include "StringPool.h"
 #include "Utilities.h"
 
 namespace TagLGP {
@@ -59,7 +62,9 @@ namespace TagLGP {
     using inst_lib_t = InstLib<hardware_t>;
     using inst_prop_t = typename inst_lib_t::InstProperty;
     using inst_seq_t = emp::vector<Instruction>;
-    using args_t = emp::vector<tag_t>;
+
+    static constexpr size_t MAX_ARG_CNT = 3;  ///< Maximum number of argument tags per instruction.
+    using args_t = InlineVector<tag_t, MAX_ARG_CNT>;  ///< Stored inline (a program is one contiguous block).
 
     using program_t = Program;
 
@@ -174,7 +179,7 @@ namespace TagLGP {
 
         union {
           double num;
-          std::string str;
+          str_handle_t str;   ///< Strings are immutable, shared handles (copies are O(1)).
         };
 
         void CopyUnion(const MemoryValue & in) {
@@ -184,7 +189,7 @@ namespace TagLGP {
               break;
             }
             case MemoryType::STR: {
-              new (&str) std::string(in.str);
+              new (&str) str_handle_t(in.str);
               break;
             }
             default:
@@ -209,8 +214,7 @@ namespace TagLGP {
         }
 
         MemoryValue & operator=(const MemoryValue & in) {
-          using std::string;
-          if (type == MemoryType::STR && in.type != MemoryType::STR) str.~string();
+          if (type == MemoryType::STR && in.type != MemoryType::STR) str.~str_handle_t();
           if (type == MemoryType::STR && in.type == MemoryType::STR) {
             str = in.str;
           } else {
@@ -221,18 +225,22 @@ namespace TagLGP {
         }
 
         MemoryValue & operator=(const std::string & in) {
+          return (*this = MakeStrHandle(in));
+        }
+
+        MemoryValue & operator=(const str_handle_t & in) {
+          emp_assert(in != nullptr);
           if (type == MemoryType::STR) {
             str = in;
           } else {
-            new (&str) std::string(in);
+            new (&str) str_handle_t(in);
           }
           type = MemoryType::STR;
           return *this;
         }
 
         MemoryValue & operator=(double in) {
-          using std::string;
-          if (type == MemoryType::STR) str.~string();
+          if (type == MemoryType::STR) str.~str_handle_t();
           num = in;
           type = MemoryType::NUM;
           return *this;
@@ -241,7 +249,7 @@ namespace TagLGP {
         bool operator==(const MemoryValue & in) const {
           if (in.type == type) {
             switch (type) {
-              case MemoryType::STR: return str == in.str;
+              case MemoryType::STR: return (str == in.str) || (*str == *in.str); // Shared/interned handles compare in O(1).
               case MemoryType::NUM: return num == in.num;
             }
           }
@@ -254,22 +262,31 @@ namespace TagLGP {
 
         // If the union holds a non built-in type, we need to destroy it.
         ~MemoryValue() { 
-          using std::string;
-          if (type == MemoryType::STR) str.~string(); 
+          if (type == MemoryType::STR) str.~str_handle_t(); 
         }
 
         const std::string & GetDefaultStr() const { return default_str; }
         double GetDefaultNum() const { return default_num; }
         
-        std::string & GetStr() { 
+        const std::string & GetStr() const { 
           if (type == MemoryType::STR) {
-            return str;
+            return *str;
           } else {
             emp_assert(false, "Requesting string from non-string memory value.");
             return default_str;
           }
         }
 
+        /// Get shared handle to string value (no copy).
+        str_handle_t GetStrHandle() const {
+          if (type == MemoryType::STR) {
+            return str;
+          } else {
+            emp_assert(false, "Requesting string from non-string memory value.");
+            return MakeStrHandle(default_str);
+          }
+        }
+
         double GetNum() const {
           if (type == MemoryType::NUM) {
             return num;
@@ -288,7 +305,7 @@ namespace TagLGP {
         void Print(std::ostream & os=std::cout) const {
           switch (type) {
             case MemoryType::NUM: os << num; break;
-            case MemoryType::STR: os << "\"" << str << "\""; break;
+            case MemoryType::STR: os << "\"" << *str << "\""; break;
             default: os << "UNKOWN TYPE"; break;
           }
         }
@@ -468,6 +485,23 @@ namespace TagLGP {
           memory[id].is_vector = true;
         }
 
+        /// Set memory[id] = string handle (O(1); string is shared, not copied).
+        void Set(size_t id, const str_handle_t & str) {
+          emp_assert(id < memory.size());
+          memory[id].pos.resize(1);
+          memory[id].pos[0] = str;
+          memory[id].set = true;
+          memory[id].is_vector = false;
+        }
+
+        void Set(size_t id, const emp::vector<str_handle_t> & str_vec) {
+          emp_assert(id < memory.size());
+          memory[id].pos.resize(str_vec.size());
+          for (size_t i = 0; i < memory[id].pos.size(); ++i) memory[id].pos[i] = str_vec[i];
+          memory[id].set = true;
+          memory[id].is_vector = true;
+        }
+
         // TODO - Append, Resize - (case - to zero - unset, resize 1 default), Clear()
 
         void Print(std::ostream & os=std::cout) const {
@@ -513,9 +547,9 @@ namespace TagLGP {
     
     struct Instruction {
       size_t id;
-      emp::vector<tag_t> arg_tags;
+      args_t arg_tags;
 
-      Instruction(size_t _id=0, const emp::vector<tag_t> & _arg_tags=emp::vector<tag_t>())
+      Instruction(size_t _id=0, const args_t & _arg_tags=args_t())
         : id(_id), arg_tags(_arg_tags) { ; }
       
       Instruction(const Instruction &) = default;
@@ -535,7 +569,7 @@ namespace TagLGP {
 
       size_t GetNumArgs() const { return arg_tags.size(); }
 
-      emp::vector<tag_t> & GetArgTags() {
+      args_t & GetArgTags() {
         return arg_tags;
       }
 
@@ -544,7 +578,7 @@ namespace TagLGP {
         return arg_tags[i];
       }
 
-      void Set(size_t _id, const emp::vector<tag_t> & _args) {
+      void Set(size_t _id, const args_t & _args) {
         id = _id;
         arg_tags = _args;
       }
@@ -558,7 +592,7 @@ namespace TagLGP {
 
     struct Program {
       emp::Ptr<const inst_lib_t> inst_lib;  ///< Pointer to instruction library associated with this program.
-      inst_seq_t program;     ///< Programs are linear sequences of instructions.
+      CopyOnWrite<inst_seq_t> program;  ///< Programs are linear sequences of instructions (shared between copies until one of them is edited).
 
       Program(emp::Ptr<const inst_lib_t> _ilib, const inst_seq_t & _prog=inst_seq_t())
         : inst_lib(_ilib), program(_prog){ ; }
@@ -569,23 +603,26 @@ namespace TagLGP {
       bool operator!=(const Program & in) const { return !(*this == in); }
       bool operator<(const Program & other) const { return program < other.program; }
 
-      /// Allow program's instruction sequence to be indexed as if a vector.
-      Instruction & operator[](size_t id) { 
-        emp_assert(id < program.size());
-        return program[id]; 
+      /// Allow program's instruction sequence to be indexed as if a vector (read-only; see EditInst).
+      const Instruction & operator[](size_t id) const {
+        emp_assert(id < GetSize());
+        return program.Get()[id];
       }
 
-      /// Allow program's instruction sequence to be indexed as if a vector.
-      const Instruction & operator[](size_t id) const {
-        emp_assert(id < program.size());
-        return program[id];
+      /// Writable instruction (copies the instruction sequence first if it's shared).
+      Instruction & EditInst(size_t id) {
+        emp_assert(id < GetSize());
+        return program.Edit()[id];
       }
 
+      /// Get program's instruction sequence.
+      const inst_seq_t & GetInstSeq() const { return program.Get(); }
+
       // Clear program's instruction sequence.
-      void Clear() { program.clear(); }
+      void Clear() { program.Replace().clear(); }
 
       /// Get program size.
-      size_t GetSize() const { return program.size(); }
+      size_t GetSize() const { return program.Get().size(); }
 
       /// Get a pointer to const instruction library.
       emp::Ptr<const inst_lib_t> GetInstLibPtr() const { return inst_lib; }
@@ -597,11 +634,11 @@ namespace TagLGP {
       bool ValidPosition(size_t pos) const { return pos < GetSize(); }
 
       /// Set program's instruction sequence to the one given.
-      void SetProgram(const inst_seq_t & p) { program = p; }
+      void SetProgram(const inst_seq_t & p) { program.Replace() = p; }
 
       /// Push new instruction to program by instruction ID.
       void PushInst(size_t id, const args_t & args) {
-        program.emplace_back(id, args);
+        program.Edit().emplace_back(id, args);
       }
 
       /// Push new instruction to program by instruction name.
@@ -612,13 +649,12 @@ namespace TagLGP {
 
       /// Push given instruction onto program.
       void PushInst(const inst_t & inst) {
-        program.emplace_back(inst);
+        program.Edit().emplace_back(inst);
       }
 
       /// Overwrite instruction in sequence (@ position pos).
       void SetInst(size_t pos, size_t id, const args_t & args) {
-        emp_assert(pos < GetSize());
-        program[pos].Set(id, args);
+        EditInst(pos).Set(id, args);
       }
 
       /// Overwrite instruction in sequence (@ position pos).
@@ -628,7 +664,7 @@ namespace TagLGP {
 
       /// Overwrite instruction in sequence (@ position pos).
       void SetInst(size_t pos, const inst_t & inst) {
-        program[pos] = inst;
+        EditInst(pos) = inst;
       }
 
       void PrintInst(const inst_t & inst, std::ostream & os=std::cout) const {
@@ -644,8 +680,9 @@ namespace TagLGP {
 
       /// Plain-print program.
       void Print(std::ostream & os=std::cout) const {
-        for (size_t i = 0; i < program.size(); ++i) {
-          const inst_t & inst = program[i];
+        const inst_seq_t & seq = program.Get();
+        for (size_t i = 0; i < seq.size(); ++i) {
+          const inst_t & inst = seq[i];
           PrintInst(inst, os);
           os << "\n";
         }
@@ -655,9 +692,10 @@ namespace TagLGP {
       /// "[InstName(1111,1111,1111),InstName(1111,1111,1111),...]"
       void PrintCSVEntry(std::ostream & os=std::cout) const {
         os << "\"[";
-        for (size_t i = 0; i < program.size(); ++i) {
+        const inst_seq_t & seq = program.Get();
+        for (size_t i = 0; i < seq.size(); ++i) {
           if (i) os << ",";
-          const inst_t & inst = program[i];
+          const inst_t & inst = seq[i];
           PrintInst(inst, os);
         }
         os << "]\"";
@@ -686,6 +724,8 @@ namespace TagLGP {
 
     emp::vector<CallState> call_stack;
 
+    StringPool str_pool; ///< Interned strings (e.g., single characters) shared across memory.
+
     size_t max_call_depth;
     double min_tag_specificity;
 
@@ -796,6 +836,7 @@ namespace TagLGP {
         mem_tags(mem_size),
         global_mem(mem_size, default_mem_val),
         call_stack(),
+        str_pool(),
         max_call_depth(DEFAULT_MAX_CALL_DEPTH),
         min_tag_specificity(DEFAULT_MIN_TAG_SPECIFICITY),
         is_executing(false)
@@ -821,6 +862,7 @@ namespace TagLGP {
         mem_tags(in.mem_tags),
         global_mem(in.global_mem),
         call_stack(in.call_stack),
+        str_pool(in.str_pool),
         max_call_depth(in.max_call_depth),
         min_tag_specificity(in.min_tag_specificity),
         is_executing(in.is_executing)
@@ -871,6 +913,7 @@ namespace TagLGP {
       ResetHardware();
       modules.clear();
       program.Clear();
+      str_pool.Prune();
     }
 
     /// Reset only hardware, not program.
@@ -891,7 +934,7 @@ namespace TagLGP {
       // Scan program for module definitions.
       std::unordered_set<size_t> dangling_instructions;
       for (size_t pos = 0; pos < program.GetSize(); ++pos) {
-        inst_t & inst = program[pos];
+        const inst_t & inst = program[pos];
         // Is this a module definition?
         if (ilib.HasProperty(inst.id, inst_prop_t::MODULE)) {
           if (modules.size()) { modules.back().end = pos; } 
@@ -1093,6 +1136,12 @@ namespace TagLGP {
 
     size_t GetModuleCnt() const { return modules.size(); }
 
+    /// Get this hardware's interned string pool.
+    StringPool & GetStringPool() { return str_pool; }
+
+    /// Get interned handle for given string (equal strings share a handle).
+    str_handle_t InternStr(const std::string & str) { return str_pool.Intern(str); }
+
     /// Get global memory vector.
     memory_t & GetGlobalMem() { return global_mem; }
     const memory_t & GetGlobalMem() const { return global_mem; }
@@ -2131,9 +2180,9 @@ namespace TagLGP {
       if (!hw.IsValidMemPos(posB)) return; // Do nothing
       //  mem[C] = mem[A] + mem[B]
       const std::string & A = wmem.AccessVal(posA).GetStr();
-      emp::vector<std::string> vec;
+      emp::vector<str_handle_t> vec;
       for (size_t i = 0; i < A.size(); ++i) {
-        vec.emplace_back(A[i]);
+        vec.emplace_back(hw.InternStr(std::string(1, A[i]))); // Single characters are interned (no allocation per char).
       }
       wmem.Set(posB, vec);
     } // todo - test
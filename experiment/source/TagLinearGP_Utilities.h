@@ -37,10 +37,11 @@ namespace TagLGP {
     // using inst_lib_t = InstLib<TagLinearGP_TW<TAG_WIDTH>, MAX_ARG_CNT>;
     using hardware_t = TagLinearGP_TW<TAG_WIDTH>;
     using inst_t = typename hardware_t::inst_t;
-    using tag_t = typename hardware_t::tag_t;
+    using args_t = typename hardware_t::args_t;
+    static_assert(MAX_ARG_CNT <= hardware_t::MAX_ARG_CNT, "Instruction library takes more arguments than instructions can hold.");
 
     // Generate tag arguments.
-    emp::vector<tag_t> tags;
+    args_t tags;
     for (size_t i = 0; i < MAX_ARG_CNT; ++i) {
       tags.emplace_back(rnd, 0.5);
     }
@@ -7,8 +7,12 @@
 
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <set>
 #include <algorithm>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "base/array.h"
 #include "base/vector.h"
@@ -18,6 +22,79 @@
 
 #include "parser.hpp"
 
+/// Parsed test case files, shared between TestCaseSets (e.g., by the replicates of a batch run) so
+/// that each file is only parsed once.
+/// - Off by default: files are only shared while a TestCaseFileCache::Scope exists, and every
+///   cached file is released when the last scope ends.
+/// - Sets copy cached test cases (test case sets are mutable per run).
+class TestCaseFileCache {
+protected:
+    static std::mutex & GetMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+    static size_t & GetNumScopes() {
+        static size_t num_scopes = 0;
+        return num_scopes;
+    }
+    static emp::vector<std::function<void()>> & GetClearFuns() {
+        static emp::vector<std::function<void()>> clear_funs;
+        return clear_funs;
+    }
+
+    /// Cached files of one test case type (call with the mutex held).
+    template <typename TEST_CASE_T>
+    static std::unordered_map<std::string, emp::vector<TEST_CASE_T>> & GetFiles() {
+        static std::unordered_map<std::string, emp::vector<TEST_CASE_T>> files;
+        static bool registered = false;
+        if (!registered) {
+            GetClearFuns().emplace_back([]() { GetFiles<TEST_CASE_T>().clear(); });
+            registered = true;
+        }
+        return files;
+    }
+
+public:
+    /// Share parsed test case files while this exists.
+    class Scope {
+    public:
+        Scope() {
+            std::lock_guard<std::mutex> lock(GetMutex());
+            ++GetNumScopes();
+        }
+        ~Scope() {
+            std::lock_guard<std::mutex> lock(GetMutex());
+            if (--GetNumScopes()) return;
+            for (const auto & clear : GetClearFuns()) clear();
+        }
+        Scope(const Scope &) = delete;
+        Scope & operator=(const Scope &) = delete;
+    };
+
+    /// Append test cases for filename to test_cases: cached ones if sharing, otherwise parsed with
+    /// load (and cached if sharing). load returns false if the file could not be read (nothing is
+    /// cached).
+    template <typename TEST_CASE_T>
+    static void Load(const std::string & filename, emp::vector<TEST_CASE_T> & test_cases,
+                     const std::function<bool(emp::vector<TEST_CASE_T> &)> & load) {
+        std::unique_lock<std::mutex> lock(GetMutex());
+        if (!GetNumScopes()) {
+            lock.unlock();
+            emp::vector<TEST_CASE_T> loaded;
+            if (load(loaded)) test_cases.insert(test_cases.end(), loaded.begin(), loaded.end());
+            return;
+        }
+        auto & files = GetFiles<TEST_CASE_T>();
+        auto it = files.find(filename);
+        if (it == files.end()) {
+            emp::vector<TEST_CASE_T> loaded;
+            if (!load(loaded)) return;
+            it = files.emplace(filename, std::move(loaded)).first;
+        }
+        test_cases.insert(test_cases.end(), it->second.begin(), it->second.end());
+    }
+};
+
 template <typename INPUT_TYPE, typename OUTPUT_TYPE>
 class TestCaseSet {
 protected:
@@ -33,6 +110,11 @@ protected:
     fun_load_test_case_from_line_str_t fun_load_test_case_from_line_str;
     fun_load_test_case_from_line_vec_t fun_load_test_case_from_line_vec;
 
+    /// Append test cases for filename, parsed with load (or shared; see TestCaseFileCache).
+    void LoadCached(const std::string & filename, const std::function<bool(emp::vector<test_case_t> &)> & load) {
+        TestCaseFileCache::Load(filename, test_cases, load);
+    }
+
 public:
     // TestCaseSet(const load_test_case_fun_t & load_fun, const std::string & filename) {
     //     fun_load_test_case = load_fun;
@@ -89,34 +171,40 @@ public:
     
     /// NOTE - in future, deprecate this way of reading things in.
     void LoadTestCases(std::string filename) {
-        std::ifstream infile(filename);
-        std::string line;
-        if (!infile.is_open()) {
-            std::cout << "ERROR: " << filename << " did not open correctly." << std::endl;
-            return;
-        }
-        // Ignore header
-        getline(infile, line);
-        while (getline(infile, line)) {
-            test_cases.emplace_back(fun_load_test_case_from_line_str(line));
-        }
-        infile.close();
+        LoadCached(filename, [this, &filename](emp::vector<test_case_t> & loaded) {
+            std::ifstream infile(filename);
+            std::string line;
+            if (!infile.is_open()) {
+                std::cout << "ERROR: " << filename << " did not open correctly." << std::endl;
+                return false;
+            }
+            // Ignore header
+            getline(infile, line);
+            while (getline(infile, line)) {
+                loaded.emplace_back(fun_load_test_case_from_line_str(line));
+            }
+            infile.close();
+            return true;
+        });
     }
 
     /// NOTE - in future, move forward with this way of reading test case input!
     void LoadTestCasesWithCSVReader(std::string filename) {
-        std::ifstream infile(filename);
-        aria::csv::CsvParser parser(infile);
-        
-        bool header = true;
-        for (auto & row : parser) {
-            if (header) { header = false; continue; } // Skip over header row
-            emp::vector<std::string> fields;
-            for (auto & field : row) {
-                fields.emplace_back(field);
+        LoadCached(filename, [this, &filename](emp::vector<test_case_t> & loaded) {
+            std::ifstream infile(filename);
+            aria::csv::CsvParser parser(infile);
+            
+            bool header = true;
+            for (auto & row : parser) {
+                if (header) { header = false; continue; } // Skip over header row
+                emp::vector<std::string> fields;
+                for (auto & field : row) {
+                    fields.emplace_back(field);
+                }
+                loaded.emplace_back(fun_load_test_case_from_line_vec(fields));
             }
-            test_cases.emplace_back(fun_load_test_case_from_line_vec(fields));
-        }
+            return true;
+        });
     }
 
     bool EvaluateOnTest(size_t testID, const output_t & out) {
@@ -0,0 +1,158 @@
+#ifndef TEST_CASE_STREAM_H
+#define TEST_CASE_STREAM_H
+
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+#include "parser.hpp"
+
+#include "Instrumentation.h"
+
+/// Streams test cases from a file in fixed-size chunks (instead of loading the entire
+/// file like TestCaseSet). A reader thread parses the next chunk while the consumer
+/// works through the current one (double buffering), so peak memory is bounded by
+/// the chunk size, regardless of the number of test cases in the file.
+/// - Uses the same line loading functions as TestCaseSet.
+/// - Each call to Begin restarts the stream from the top of the file.
+template <typename INPUT_TYPE, typename OUTPUT_TYPE>
+class TestCaseStream {
+public:
+    using input_t = INPUT_TYPE;
+    using output_t = OUTPUT_TYPE;
+    using test_case_t = std::pair<input_t, output_t>;
+    using chunk_t = emp::vector<test_case_t>;
+
+    using fun_load_test_case_from_line_str_t = std::function<test_case_t(const std::string &)>;
+    using fun_load_test_case_from_line_vec_t = std::function<test_case_t(const emp::vector<std::string> &)>;
+
+protected:
+    std::string filename;
+    size_t chunk_size;
+    bool use_csv_reader;  ///< Parse with aria::csv (line vec loader) or getline (line str loader)?
+
+    fun_load_test_case_from_line_str_t fun_load_test_case_from_line_str;
+    fun_load_test_case_from_line_vec_t fun_load_test_case_from_line_vec;
+
+    std::thread reader;
+    std::mutex mtx;
+    std::condition_variable cv;
+
+    chunk_t ready_chunk;  ///< Chunk handed off from reader, waiting for consumer.
+    bool chunk_ready;     ///< Is ready_chunk waiting to be consumed?
+    bool reader_done;     ///< Has reader reached the end of the file?
+    bool stop_requested;  ///< Has consumer asked reader to stop early?
+
+    /// Hand a full chunk off to the consumer. Return false if consumer requested a stop.
+    bool HandOff(chunk_t & chunk) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return !chunk_ready || stop_requested; });
+        if (stop_requested) return false;
+        std::swap(ready_chunk, chunk); // Reader gets back the buffer the consumer is done with.
+        chunk.clear();
+        chunk_ready = true;
+        cv.notify_all();
+        return true;
+    }
+
+    void ReadFile() {
+        std::ifstream infile(filename);
+        chunk_t chunk;
+        chunk.reserve(chunk_size);
+        bool go = infile.is_open();
+        if (go && use_csv_reader) {
+            aria::csv::CsvParser parser(infile);
+            bool header = true;
+            for (auto & row : parser) {
+                if (header) { header = false; continue; } // Skip over header row
+                emp::vector<std::string> fields;
+                for (auto & field : row) fields.emplace_back(field);
+                chunk.emplace_back(fun_load_test_case_from_line_vec(fields));
+                if (chunk.size() >= chunk_size && !(go = HandOff(chunk))) break;
+            }
+        } else if (go) {
+            std::string line;
+            getline(infile, line); // Ignore header
+            while (getline(infile, line)) {
+                chunk.emplace_back(fun_load_test_case_from_line_str(line));
+                if (chunk.size() >= chunk_size && !(go = HandOff(chunk))) break;
+            }
+        }
+        if (go && chunk.size()) HandOff(chunk);
+        std::unique_lock<std::mutex> lock(mtx);
+        reader_done = true;
+        cv.notify_all();
+    }
+
+public:
+    TestCaseStream(size_t _chunk_size=1024)
+      : filename(), chunk_size(_chunk_size), use_csv_reader(false),
+        chunk_ready(false), reader_done(true), stop_requested(false)
+    {
+        fun_load_test_case_from_line_str = [](const std::string &) -> test_case_t { return {input_t(), output_t()}; };
+        fun_load_test_case_from_line_vec = [](const emp::vector<std::string> &) -> test_case_t { return {input_t(), output_t()}; };
+    }
+
+    TestCaseStream(const TestCaseStream &) = delete;
+    TestCaseStream & operator=(const TestCaseStream &) = delete;
+
+    ~TestCaseStream() { End(); }
+
+    size_t GetChunkSize() const { return chunk_size; }
+    const std::string & GetFilename() const { return filename; }
+
+    void SetLoadFun(const fun_load_test_case_from_line_str_t & load_fun) { fun_load_test_case_from_line_str = load_fun; use_csv_reader = false; }
+    void SetLoadFun(const fun_load_test_case_from_line_vec_t & load_fun) { fun_load_test_case_from_line_vec = load_fun; use_csv_reader = true; }
+
+    /// Configure stream to read from given file. Return false if file cannot be opened.
+    bool Open(const std::string & _filename, size_t _chunk_size) {
+        End();
+        emp_assert(_chunk_size > 0);
+        filename = _filename;
+        chunk_size = _chunk_size;
+        std::ifstream infile(filename);
+        return infile.is_open();
+    }
+
+    /// (Re)start streaming from the top of the file.
+    void Begin() {
+        End();
+        chunk_ready = false;
+        reader_done = false;
+        stop_requested = false;
+        ready_chunk.clear();
+        reader = std::thread(InstrumentThread([this]() { ReadFile(); }));
+    }
+
+    /// Swap the next chunk of test cases into chunk. Return false once the stream is exhausted.
+    bool NextChunk(chunk_t & chunk) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return chunk_ready || reader_done; });
+        if (!chunk_ready) return false;
+        std::swap(chunk, ready_chunk);
+        chunk_ready = false;
+        cv.notify_all();
+        return true;
+    }
+
+    /// Stop streaming (e.g., early on the first failed test case); safe to call at any time.
+    void End() {
+        if (!reader.joinable()) return;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            stop_requested = true;
+        }
+        cv.notify_all();
+        reader.join();
+    }
+};
+
+#endif
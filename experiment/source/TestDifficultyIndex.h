@@ -0,0 +1,141 @@
+#ifndef TEST_DIFFICULTY_INDEX_H
+#define TEST_DIFFICULTY_INDEX_H
+
+#include <algorithm>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+#include "Checkpoint.h"
+
+/// Running per-test-case difficulty statistics, indexed by test case ID.
+/// - Pass/eval counts are accumulated with RecordPass/RecordCounts and folded into
+///   running statistics with Update (typically once per generation). Update only visits cases
+///   with new counts, and case order is re-sorted lazily (on the next GetOrder).
+/// - pass rate: exponentially smoothed fraction of evaluations that passed.
+/// - discrimination: exponentially smoothed p*(1-p), maximized by cases that split the population.
+class TestDifficultyIndex {
+public:
+  enum CASE_ORDER_MODE { UNIFORM=0, DIFFICULTY, DISCRIMINATION };
+
+protected:
+  emp::vector<double> pass_rate;
+  emp::vector<double> discrimination;
+  emp::vector<size_t> cur_passes;
+  emp::vector<size_t> cur_evals;
+  emp::vector<size_t> pending;  ///< Case IDs with counts not yet folded in.
+  mutable emp::vector<size_t> order;  ///< Case IDs, most-often-failed first (once sorted).
+  mutable bool order_dirty;     ///< Have pass rates changed since order was sorted?
+  double smoothing;             ///< Weight given to newest observations (1.0 = no memory).
+  bool initialized;             ///< Have any observations been folded in yet?
+
+  void AddCounts(size_t id, size_t passes, size_t evals) {
+    emp_assert(id < cur_evals.size(), id, cur_evals.size());
+    if (!evals) return;
+    if (!cur_evals[id]) pending.emplace_back(id);
+    cur_passes[id] += passes;
+    cur_evals[id] += evals;
+  }
+
+public:
+  TestDifficultyIndex(size_t n=0, double _smoothing=1.0)
+    : order_dirty(false), smoothing(_smoothing), initialized(false) { Resize(n); }
+
+  size_t GetSize() const { return pass_rate.size(); }
+
+  void Resize(size_t n) {
+    pass_rate.clear(); pass_rate.resize(n, 1.0);
+    discrimination.clear(); discrimination.resize(n, 0.0);
+    cur_passes.clear(); cur_passes.resize(n, 0);
+    cur_evals.clear(); cur_evals.resize(n, 0);
+    pending.clear();
+    order.resize(n);
+    for (size_t i = 0; i < n; ++i) order[i] = i;
+    order_dirty = false;
+    initialized = false;
+  }
+
+  void SetSmoothing(double s) { emp_assert(s > 0 && s <= 1.0); smoothing = s; }
+  double GetSmoothing() const { return smoothing; }
+
+  double GetPassRate(size_t id) const { return pass_rate[id]; }
+  double GetDiscrimination(size_t id) const { return discrimination[id]; }
+
+  /// Case IDs ordered from most-often-failed to least-often-failed.
+  const emp::vector<size_t> & GetOrder() const {
+    if (order_dirty) {
+      // Stable sort keeps earlier (already hard) cases in front on ties.
+      std::stable_sort(order.begin(), order.end(),
+                       [this](size_t a, size_t b) { return pass_rate[a] < pass_rate[b]; });
+      order_dirty = false;
+    }
+    return order;
+  }
+
+  void RecordPass(size_t id, bool pass) { AddCounts(id, (size_t)pass, 1); }
+
+  void RecordCounts(size_t id, size_t passes, size_t evals) { AddCounts(id, passes, evals); }
+
+  /// Fold accumulated counts into running statistics (case order is re-sorted when next needed).
+  /// Cases with no new evaluations keep their previous statistics.
+  void Update() {
+    if (pending.empty()) return;
+    const double w = (initialized) ? smoothing : 1.0;
+    for (size_t id : pending) {
+      const double p = (double)cur_passes[id] / (double)cur_evals[id];
+      pass_rate[id] = (w * p) + ((1.0 - w) * pass_rate[id]);
+      discrimination[id] = (w * p * (1.0 - p)) + ((1.0 - w) * discrimination[id]);
+      cur_passes[id] = 0;
+      cur_evals[id] = 0;
+    }
+    pending.clear();
+    initialized = true;
+    order_dirty = true;
+  }
+
+  /// Per-case weights for biased lexicase case ordering (see emp::GetWeightedPermutation).
+  /// Every case keeps a small non-zero weight so that no case is ever excluded.
+  emp::vector<double> GetCaseWeights(size_t mode) const {
+    emp::vector<double> weights(pass_rate.size(), 1.0);
+    switch (mode) {
+      case CASE_ORDER_MODE::UNIFORM: break;
+      case CASE_ORDER_MODE::DIFFICULTY: {
+        for (size_t i = 0; i < weights.size(); ++i) weights[i] = (1.0 - pass_rate[i]) + 0.01;
+        break;
+      }
+      case CASE_ORDER_MODE::DISCRIMINATION: {
+        for (size_t i = 0; i < weights.size(); ++i) weights[i] = discrimination[i] + 0.01;
+        break;
+      }
+      default: emp_assert(false, "Unknown case order mode", mode);
+    }
+    return weights;
+  }
+
+  void WriteCheckpoint(std::ostream & out) const {
+    CheckpointWrite(out, pass_rate);
+    CheckpointWrite(out, discrimination);
+    CheckpointWrite(out, cur_passes);
+    CheckpointWrite(out, cur_evals);
+    CheckpointWrite(out, GetOrder());
+    CheckpointWrite(out, smoothing);
+    CheckpointWrite(out, initialized);
+  }
+
+  void ReadCheckpoint(std::istream & in) {
+    CheckpointRead(in, pass_rate);
+    CheckpointRead(in, discrimination);
+    CheckpointRead(in, cur_passes);
+    CheckpointRead(in, cur_evals);
+    CheckpointRead(in, order);
+    CheckpointRead(in, smoothing);
+    CheckpointRead(in, initialized);
+    order_dirty = false;
+    pending.clear();
+    for (size_t id = 0; id < cur_evals.size(); ++id) {
+      if (cur_evals[id]) pending.emplace_back(id);
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef UNIQUE_TEST_INDEX_H
+#define UNIQUE_TEST_INDEX_H
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "base/assert.h"
+#include "base/vector.h"
+
+/// Groups identical genomes in a test population (rebuilt every generation), so that each
+/// distinct test is evaluated once and its results are copied to every duplicate (see
+/// UniqueTestResults).
+/// - Slots are test world positions. Each slot maps to a unique test id (ids are numbered in
+///   order of first appearance), and each unique test remembers its first slot.
+/// - Genomes are grouped by a caller-supplied 64-bit hash, then compared with ==, so hash
+///   collisions never merge different tests.
+/// - Storage is reused across generations.
+template<typename GENOME_T>
+class UniqueTestIndex {
+public:
+  using genome_t = GENOME_T;
+
+protected:
+  static constexpr size_t NO_TEST = (size_t)-1;
+
+  emp::vector<size_t> unique_ids;        ///< Slot -> unique test id.
+  emp::vector<size_t> first_slots;       ///< Unique test id -> first slot holding it.
+  emp::vector<size_t> next_same_hash;    ///< Unique test id -> next unique test with the same hash.
+  std::unordered_map<uint64_t, size_t> by_hash;  ///< Hash -> first unique test with that hash.
+
+  size_t AddUnique(size_t slot) {
+    first_slots.emplace_back(slot);
+    next_same_hash.emplace_back((size_t)NO_TEST);
+    return first_slots.size() - 1;
+  }
+
+public:
+  UniqueTestIndex() : unique_ids(), first_slots(), next_same_hash(), by_hash() { ; }
+
+  /// Index num_slots genomes, found with get_genome (a size_t -> const genome_t & function), using
+  /// hash (a const genome_t & -> uint64_t function).
+  template<typename GET_GENOME_T, typename HASH_T>
+  void Build(size_t num_slots, const GET_GENOME_T & get_genome, const HASH_T & hash) {
+    unique_ids.resize(num_slots);
+    first_slots.clear();
+    next_same_hash.clear();
+    by_hash.clear();
+    by_hash.reserve(num_slots);
+    for (size_t slot = 0; slot < num_slots; ++slot) {
+      const genome_t & genome = get_genome(slot);
+      const auto found = by_hash.emplace(hash(genome), first_slots.size());
+      size_t uid = found.first->second;
+      if (found.second) {
+        AddUnique(slot);
+      } else {
+        // Look for an identical genome among unique tests with this hash.
+        size_t last = uid;
+        while (uid != NO_TEST && !(get_genome(first_slots[uid]) == genome)) {
+          last = uid;
+          uid = next_same_hash[uid];
+        }
+        if (uid == NO_TEST) next_same_hash[last] = uid = AddUnique(slot);
+      }
+      unique_ids[slot] = uid;
+    }
+  }
+
+  size_t GetNumSlots() const { return unique_ids.size(); }
+
+  /// Number of distinct tests (a diversity statistic).
+  size_t GetNumUnique() const { return first_slots.size(); }
+
+  size_t GetUniqueID(size_t slot) const {
+    emp_assert(slot < unique_ids.size(), slot, unique_ids.size());
+    return unique_ids[slot];
+  }
+
+  size_t GetFirstSlot(size_t uid) const {
+    emp_assert(uid < first_slots.size(), uid, first_slots.size());
+    return first_slots[uid];
+  }
+};
+
+/// Results of one antagonist (e.g., a sorter) against the unique tests of a UniqueTestIndex,
+/// computed the first time each unique test comes up. Begin before each antagonist; results are
+/// stamped with the antagonist, so nothing is cleared between them.
+template<typename RESULT_T>
+class UniqueTestResults {
+protected:
+  emp::vector<RESULT_T> results;
+  emp::vector<size_t> stamps;     ///< Antagonist that results[uid] belongs to.
+  size_t stamp;                   ///< Current antagonist.
+
+public:
+  UniqueTestResults() : results(), stamps(), stamp(0) { ; }
+
+  /// Start on a new antagonist, against num_unique unique tests.
+  void Begin(size_t num_unique) {
+    if (stamps.size() < num_unique) {
+      results.resize(num_unique);
+      stamps.resize(num_unique, 0);
+    }
+    ++stamp;
+  }
+
+  /// Result against unique test uid, evaluated with eval (a void -> RESULT_T function) unless
+  /// already evaluated for this antagonist.
+  template<typename EVAL_T>
+  RESULT_T Get(size_t uid, const EVAL_T & eval) {
+    emp_assert(uid < stamps.size(), uid, stamps.size());
+    if (stamps[uid] != stamp) {
+      results[uid] = eval();
+      stamps[uid] = stamp;
+    }
+    return results[uid];
+  }
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include <string>
 #include <functional>
 #include <algorithm>
+#include <cstdint>
 
 #include "base/errors.h"
 #include "hardware/EventDrivenGP.h"
@@ -102,4 +103,38 @@ std::string StrReplace(const std::string & s, const std::string & from, const st
   return ss.str();
 }
 
+/// Counter-based random number generator (SplitMix64 finalizer over key + counter).
+/// Each draw depends only on (key, counter) -- no state is carried between draws, so
+/// bulk fills have no loop-carried dependency and are easy for the compiler to vectorize.
+class CounterRandom {
+protected:
+  uint64_t key;
+
+public:
+  CounterRandom(uint64_t _key=0) : key(_key) { ; }
+
+  uint64_t GetKey() const { return key; }
+  void SetKey(uint64_t _key) { key = _key; }
+
+  /// Draw a fresh key from a stateful random number generator.
+  void Reseed(emp::Random & rnd) { key = (((uint64_t)rnd.GetUInt()) << 32) | (uint64_t)rnd.GetUInt(); }
+
+  static uint64_t Mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  uint64_t GetUInt64(uint64_t ctr) const { return Mix(key + (ctr + 1) * 0x9E3779B97F4A7C15ULL); }
+
+  /// Double in range [0, 1).
+  double GetDouble(uint64_t ctr) const { return (double)(GetUInt64(ctr) >> 11) * (1.0 / 9007199254740992.0); }
+
+  /// Double in range [min, max).
+  double GetDouble(uint64_t ctr, double min, double max) const { return min + GetDouble(ctr) * (max - min); }
+
+  /// Integer in range [min, max) (matches emp::Random::GetInt).
+  int GetInt(uint64_t ctr, int min, int max) const { return min + (int)(GetDouble(ctr) * (double)(max - min)); }
+};
+
 #endif
\ No newline at end of file
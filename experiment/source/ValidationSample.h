@@ -0,0 +1,99 @@
+#ifndef VALIDATION_SAMPLE_H
+#define VALIDATION_SAMPLE_H
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/assert.h"
+#include "base/vector.h"
+#include "tools/Random.h"
+
+/// Stratified random sample of a testing set (for estimating validation pass rates without
+/// running every test case).
+/// - The testing set is split into contiguous, equal-sized strata (testing set files tend to
+///   list hand-picked edge cases before randomly generated cases, so contiguous strata keep
+///   edge cases represented in every sample).
+/// - Samples are allocated to strata proportionally (at least one case per stratum).
+/// - Estimate gives the stratified pass-rate estimate and a normal-approximation confidence
+///   interval (with finite population correction).
+class ValidationSample {
+public:
+  struct Estimate {
+    double pass_rate;
+    double ci_low;
+    double ci_high;
+  };
+
+protected:
+  emp::vector<size_t> testIDs;        ///< Sampled test case IDs (sorted).
+  emp::vector<size_t> stratum_sizes;  ///< Number of test cases in each stratum.
+  emp::vector<size_t> sample_sizes;   ///< Number of sampled test cases in each stratum.
+  size_t total;                       ///< Size of the testing set.
+
+public:
+  ValidationSample() : testIDs(), stratum_sizes(), sample_sizes(), total(0) { ; }
+
+  /// IDs of sampled test cases (in testing set order; strata are contiguous in this vector).
+  const emp::vector<size_t> & GetTestIDs() const { return testIDs; }
+  size_t GetSize() const { return testIDs.size(); }
+  size_t GetNumStrata() const { return stratum_sizes.size(); }
+  bool IsFull() const { return testIDs.size() == total; }
+
+  /// Use every test case (no sampling).
+  void SetFull(size_t n) {
+    total = n;
+    testIDs.resize(n);
+    for (size_t i = 0; i < n; ++i) testIDs[i] = i;
+    stratum_sizes = {n};
+    sample_sizes = {n};
+  }
+
+  /// Draw a new sample of (about) n test cases out of a testing set of size N.
+  void Draw(emp::Random & rnd, size_t N, size_t n, size_t num_strata) {
+    num_strata = std::max<size_t>(1, std::min(num_strata, std::min(n, N)));
+    if (n >= N || !n) { SetFull(N); return; }
+    total = N;
+    testIDs.clear();
+    stratum_sizes.resize(num_strata);
+    sample_sizes.resize(num_strata);
+    for (size_t h = 0; h < num_strata; ++h) {
+      const size_t begin = (h * N) / num_strata;
+      const size_t end = ((h + 1) * N) / num_strata;
+      stratum_sizes[h] = end - begin;
+      const size_t share = (size_t)std::round((double)n * (double)stratum_sizes[h] / (double)N);
+      sample_sizes[h] = std::min(stratum_sizes[h], std::max<size_t>(1, share));
+      // Partial Fisher-Yates over the stratum's IDs.
+      emp::vector<size_t> ids(stratum_sizes[h]);
+      for (size_t i = 0; i < ids.size(); ++i) ids[i] = begin + i;
+      for (size_t i = 0; i < sample_sizes[h]; ++i) std::swap(ids[i], ids[i + rnd.GetUInt(ids.size() - i)]);
+      std::sort(ids.begin(), ids.begin() + sample_sizes[h]);
+      testIDs.insert(testIDs.end(), ids.begin(), ids.begin() + sample_sizes[h]);
+    }
+  }
+
+  /// Estimate the full testing set pass rate given pass/fail results on the sample
+  /// (passes[i] is the result on GetTestIDs()[i]). z=1.96 gives a 95% interval.
+  template<typename PASSES_T>
+  Estimate GetEstimate(const PASSES_T & passes, double z=1.96) const {
+    emp_assert(passes.size() == testIDs.size(), passes.size(), testIDs.size());
+    if (!total) return {0.0, 0.0, 0.0};
+    double est = 0.0;
+    double var = 0.0;
+    size_t pos = 0;
+    for (size_t h = 0; h < stratum_sizes.size(); ++h) {
+      const size_t n_h = sample_sizes[h];
+      const double N_h = (double)stratum_sizes[h];
+      size_t passes_h = 0;
+      for (size_t i = 0; i < n_h; ++i) passes_h += (size_t)passes[pos + i];
+      pos += n_h;
+      const double w = N_h / (double)total;
+      const double p = (double)passes_h / (double)n_h;
+      est += w * p;
+      if (n_h > 1) var += w * w * (1.0 - (double)n_h / N_h) * p * (1.0 - p) / (double)(n_h - 1);
+    }
+    const double half = z * std::sqrt(var);
+    return {est, std::max(0.0, est - half), std::min(1.0, est + half)};
+  }
+};
+
+#endif
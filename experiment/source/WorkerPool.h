@@ -0,0 +1,126 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "base/vector.h"
+
+#include "Instrumentation.h"
+
+/// Persistent worker threads for data-parallel loops within a generation (e.g., batched
+/// crossover). ParallelFor blocks until every index has been processed.
+/// - The calling thread works too (as worker 0), so a pool with 0 threads runs loops inline.
+/// - Indices are handed out in chunks from a shared counter; callers must not depend on which
+///   worker runs which index (results should depend only on the index).
+/// - Each call passes the loop body by pointer (no std::function), so loops don't allocate.
+/// - One ParallelFor at a time (the pool belongs to one experiment).
+class WorkerPool {
+protected:
+  using task_fun_t = void (*)(const void * body, size_t id, size_t worker_id);
+
+  emp::vector<std::thread> workers;
+  std::mutex mtx;
+  std::condition_variable start_cv;
+  std::condition_variable done_cv;
+  size_t job_cnt;       ///< Number of loops started (workers wait for this to change).
+  size_t busy;          ///< Number of workers still in the current loop.
+  bool stopping;
+
+  // Current loop.
+  task_fun_t task;
+  const void * body;
+  size_t loop_size;
+  size_t grain;
+  std::atomic<size_t> next_id;
+
+  template<typename FUN>
+  static void Invoke(const void * fun, size_t id, size_t worker_id) {
+    (*static_cast<const FUN *>(fun))(id, worker_id);
+  }
+
+  /// Process chunks of the current loop until there are none left.
+  void RunChunks(size_t worker_id) {
+    while (true) {
+      const size_t begin = next_id.fetch_add(grain, std::memory_order_relaxed);
+      if (begin >= loop_size) break;
+      const size_t end = std::min(begin + grain, loop_size);
+      for (size_t id = begin; id < end; ++id) task(body, id, worker_id);
+    }
+  }
+
+  void Work(size_t worker_id) {
+    size_t seen_cnt = 0;
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+      start_cv.wait(lock, [this, seen_cnt]() { return job_cnt != seen_cnt || stopping; });
+      if (stopping) break;
+      seen_cnt = job_cnt;
+      lock.unlock();
+      RunChunks(worker_id);
+      lock.lock();
+      if (!--busy) done_cv.notify_all();
+    }
+  }
+
+public:
+  WorkerPool()
+    : workers(), mtx(), start_cv(), done_cv(), job_cnt(0), busy(0), stopping(false),
+      task(nullptr), body(nullptr), loop_size(0), grain(1), next_id(0) { ; }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool & operator=(const WorkerPool &) = delete;
+
+  ~WorkerPool() { Stop(); }
+
+  /// Start num_threads background workers (replacing any current workers).
+  void Start(size_t num_threads) {
+    Stop();
+    for (size_t i = 0; i < num_threads; ++i) workers.emplace_back(InstrumentThread([this](size_t worker_id) { Work(worker_id); }), i + 1);
+  }
+
+  void Stop() {
+    if (workers.empty()) return;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stopping = true;
+    }
+    start_cv.notify_all();
+    for (std::thread & worker : workers) worker.join();
+    workers.clear();
+    stopping = false;
+  }
+
+  /// Number of workers a loop may run on (background workers plus the calling thread); worker ids
+  /// passed to loop bodies are less than this.
+  size_t GetNumWorkers() const { return workers.size() + 1; }
+
+  /// Call fun(id, worker_id) for every id in [0, n).
+  template<typename FUN>
+  void ParallelFor(size_t n, const FUN & fun) {
+    if (!n) return;
+    if (workers.empty() || n == 1) {
+      for (size_t id = 0; id < n; ++id) fun(id, 0);
+      return;
+    }
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      task = &Invoke<FUN>;
+      body = &fun;
+      loop_size = n;
+      grain = std::max<size_t>(1, n / (4 * GetNumWorkers()));
+      next_id.store(0, std::memory_order_relaxed);
+      busy = workers.size();
+      ++job_cnt;
+    }
+    start_cv.notify_all();
+    RunChunks(0);
+    std::unique_lock<std::mutex> lock(mtx);
+    done_cv.wait(lock, [this]() { return !busy; });
+  }
+};
+
+#endif
@@ -0,0 +1,346 @@
+// This is the main function for the NATIVE benchmark suite of this project.
+// - Micro benchmarks: TagLGP instruction throughput (per instruction), SortingTest::Evaluate
+//   (per network size), and lexicase selection (per population size x test case count).
+// - Macro benchmarks: full ProgramSynthesisExperiment::RunStep (per problem x evaluation mode) and
+//   SortingNetworkExperiment::RunStep (per selection mode).
+// - Results (and peak RSS) are written as JSON to OUTPUT_FILE so they can be compared across commits.
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+
+#include "base/vector.h"
+#include "config/ArgManager.h"
+#include "config/command_line.h"
+#include "tools/Random.h"
+#include "tools/string_utils.h"
+
+#include "../BenchConfig.h"
+#include "../ProgSynthExperiment.h"
+#include "../ProgSynthConfig.h"
+#include "../SortingNetwork.h"
+#include "../SortingNetworkExperiment.h"
+#include "../SortingNetworkConfig.h"
+#include "../SortingTest.h"
+#include "../Selection.h"
+
+#ifndef BENCH_GIT_REV
+#define BENCH_GIT_REV "unknown"
+#endif
+
+using bench_clock_t = std::chrono::steady_clock;
+
+/// Peak resident set size of this process (in kilobytes).
+size_t GetPeakRSS_KB() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (size_t)usage.ru_maxrss;
+}
+
+double SecondsSince(const bench_clock_t::time_point & start) {
+  return std::chrono::duration<double>(bench_clock_t::now() - start).count();
+}
+
+/// Split a comma-separated list of values.
+template<typename T>
+emp::vector<T> ParseList(const std::string & str) {
+  emp::vector<T> vals;
+  for (const std::string & field : emp::slice(str, ',')) {
+    if (field.size()) vals.emplace_back(emp::from_string<T>(field));
+  }
+  return vals;
+}
+
+/// Collects benchmark results and writes them out as JSON.
+class BenchResults {
+protected:
+  emp::vector<std::string> records;
+
+  static std::string Quote(const std::string & str) {
+    std::string out = "\"";
+    for (char c : str) {
+      if (c == '"' || c == '\\') out += '\\';
+      out += c;
+    }
+    return out + "\"";
+  }
+
+public:
+  /// Record a single benchmark result.
+  /// - params: extra (already JSON-formatted) fields, e.g. {"\"size\": 16"}.
+  /// - ops: number of units of work (evaluations, instructions, selections, ...) done in seconds.
+  void Add(const std::string & suite, const std::string & name, const emp::vector<std::string> & params,
+           const std::string & unit, size_t ops, double seconds) {
+    std::string rec = "    {\"suite\": " + Quote(suite) + ", \"name\": " + Quote(name);
+    for (const std::string & p : params) rec += ", " + p;
+    rec += ", \"unit\": " + Quote(unit);
+    rec += ", \"ops\": " + emp::to_string(ops);
+    rec += ", \"seconds\": " + emp::to_string(seconds);
+    rec += ", \"ops_per_sec\": " + emp::to_string((seconds > 0) ? (double)ops / seconds : 0.0);
+    rec += ", \"peak_rss_kb\": " + emp::to_string(GetPeakRSS_KB()) + "}";
+    records.emplace_back(rec);
+    std::cout << "[bench] " << suite << "/" << name << ": " << ops << " " << unit << " in " << seconds << "s" << std::endl;
+  }
+
+  void Write(std::ostream & out, int seed) const {
+    out << "{\n";
+    out << "  \"git_rev\": " << Quote(BENCH_GIT_REV) << ",\n";
+    out << "  \"seed\": " << seed << ",\n";
+    out << "  \"peak_rss_kb\": " << GetPeakRSS_KB() << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < records.size(); ++i) {
+      out << records[i] << ((i + 1 < records.size()) ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+  }
+};
+
+/// Run fun repeatedly (doubling the batch size) until at least min_time seconds have elapsed.
+/// fun(n) should do n units of work and return how many units were actually done.
+void TimeBatched(double min_time, const std::function<size_t(size_t)> & fun, size_t & ops, double & seconds) {
+  ops = 0;
+  seconds = 0;
+  size_t batch = 1;
+  while (seconds < min_time) {
+    const auto start = bench_clock_t::now();
+    ops += fun(batch);
+    seconds += SecondsSince(start);
+    batch *= 2;
+  }
+}
+
+/// Build a program synthesis configuration for benchmarking the given problem/evaluation mode.
+/// Selection modes are matched to the evaluation mode (as required by the experiment).
+ProgramSynthesisConfig MakeProgSynthConfig(const BenchConfig & bench_config, const std::string & problem, size_t eval_mode) {
+  ProgramSynthesisConfig config;
+  if (std::ifstream(bench_config.PROG_SYNTH_CONFIG()).good()) config.Read(bench_config.PROG_SYNTH_CONFIG());
+  config.SEED(bench_config.SEED());
+  config.PROBLEM(problem);
+  config.EVALUATION_MODE(eval_mode);
+  config.DATA_DIRECTORY(bench_config.BENCH_DATA_DIRECTORY());
+  // Keep periodic output out of the timed updates.
+  config.SNAPSHOT_INTERVAL((size_t)-1);
+  config.SUMMARY_STATS_INTERVAL((size_t)-1);
+  config.SOLUTION_SCREEN_INTERVAL((size_t)-1);
+  switch (eval_mode) {
+    case (size_t)EVALUATION_TYPE::COHORT: {
+      config.PROG_SELECTION_MODE((size_t)SELECTION_TYPE::COHORT_LEXICASE);
+      config.TEST_SELECTION_MODE((size_t)SELECTION_TYPE::COHORT_LEXICASE);
+      break;
+    }
+    case (size_t)EVALUATION_TYPE::FULL: {
+      config.PROG_SELECTION_MODE((size_t)SELECTION_TYPE::LEXICASE);
+      config.TEST_SELECTION_MODE((size_t)SELECTION_TYPE::LEXICASE);
+      break;
+    }
+    case (size_t)EVALUATION_TYPE::PROG_ONLY_COHORT: {
+      config.PROG_SELECTION_MODE((size_t)SELECTION_TYPE::PROG_ONLY_COHORT_LEXICASE);
+      config.TEST_SELECTION_MODE((size_t)SELECTION_TYPE::TOURNAMENT);
+      break;
+    }
+    case (size_t)EVALUATION_TYPE::TEST_DOWNSAMPLING: {
+      config.PROG_SELECTION_MODE((size_t)SELECTION_TYPE::TEST_DOWNSAMPLING_LEXICASE);
+      config.TEST_SELECTION_MODE((size_t)SELECTION_TYPE::TOURNAMENT);
+      break;
+    }
+    default: {
+      std::cout << "Unknown EVALUATION_MODE (" << eval_mode << "). Exiting." << std::endl;
+      exit(-1);
+    }
+  }
+  return config;
+}
+
+/// Build a sorting network configuration for benchmarking the given selection mode (cohort
+/// lexicase evaluates in cohorts; the other modes evaluate every network on every test).
+SortingNetworkConfig MakeSortingNetworkConfig(const BenchConfig & bench_config, size_t selection_mode) {
+  SortingNetworkConfig config;
+  if (std::ifstream(bench_config.SORTING_NETWORK_CONFIG()).good()) config.Read(bench_config.SORTING_NETWORK_CONFIG());
+  config.SEED(bench_config.SEED());
+  config.SELECTION_MODE(selection_mode);
+  config.DATA_DIRECTORY(bench_config.BENCH_DATA_DIRECTORY());
+  // Keep periodic output out of the timed updates.
+  config.SNAPSHOT_INTERVAL((size_t)-1);
+  config.DOMINANT_STATS_INTERVAL((size_t)-1);
+  config.AGGREGATE_STATS_INTERVAL((size_t)-1);
+  config.SOLUTION_SCREEN_INTERVAL((size_t)-1);
+  return config;
+}
+
+/// TagLGP instruction throughput: for each instruction in the experiment's instruction library,
+/// run a program made entirely of that instruction (with random arguments).
+void BenchTagLGPInstructions(const BenchConfig & bench_config, BenchResults & results) {
+  using hardware_t = ProgramSynthesisExperiment::hardware_t;
+  using program_t = typename hardware_t::program_t;
+
+  ProgramSynthesisExperiment e;
+  e.Setup(MakeProgSynthConfig(bench_config, "number-io", (size_t)EVALUATION_TYPE::COHORT));
+  emp::Random & rnd = e.GetRandom();
+  hardware_t & hw = e.GetEvalHardware();
+  auto & inst_lib = e.GetInstLib();
+
+  for (size_t inst_id = 0; inst_id < inst_lib.GetSize(); ++inst_id) {
+    program_t prog(&inst_lib);
+    for (size_t i = 0; i < bench_config.INST_PROG_LEN(); ++i) {
+      emp::vector<emp::BitSet<TAG_WIDTH>> args;
+      for (size_t a = 0; a < inst_lib.GetNumArgs(inst_id); ++a) args.emplace_back(GenRandTag<TAG_WIDTH>(rnd));
+      prog.PushInst(inst_id, args);
+    }
+    hw.Reset();
+    hw.SetProgram(prog);
+    size_t ops = 0;
+    double seconds = 0;
+    TimeBatched(bench_config.MIN_BENCH_TIME(), [&](size_t n) {
+      size_t cycles = 0;
+      for (size_t rep = 0; rep < n; ++rep) {
+        hw.ResetHardware();
+        hw.CallModule(e.GetCallTag(), e.GetMinTagSpecificity(), true, false);
+        for (size_t t = 0; t < bench_config.INST_PROG_LEN(); ++t) {
+          hw.SingleProcess();
+          ++cycles;
+          if (hw.GetCallStackSize() == 0) break;
+        }
+      }
+      return cycles;
+    }, ops, seconds);
+    results.Add("taglgp_inst", inst_lib.GetName(inst_id), {"\"prog_len\": " + emp::to_string(bench_config.INST_PROG_LEN())},
+                "instructions", ops, seconds);
+  }
+}
+
+/// SortingTest::Evaluate throughput for random networks of each configured size.
+void BenchSortingTestEvaluate(const BenchConfig & bench_config, BenchResults & results) {
+  emp::Random rnd(bench_config.SEED());
+  const size_t sort_size = bench_config.SORT_SIZE();
+  emp::vector<SortingTest> tests;
+  for (size_t i = 0; i < 256; ++i) tests.emplace_back(rnd, sort_size);
+  for (size_t net_size : ParseList<size_t>(bench_config.NETWORK_SIZES())) {
+    SortingNetwork network(rnd, sort_size, net_size);
+    size_t ops = 0;
+    double seconds = 0;
+    size_t passes = 0;
+    TimeBatched(bench_config.MIN_BENCH_TIME(), [&](size_t n) {
+      for (size_t rep = 0; rep < n; ++rep) passes += (size_t)tests[rep % tests.size()].Evaluate(network);
+      return n;
+    }, ops, seconds);
+    results.Add("sorting_test_evaluate", "network_size_" + emp::to_string(net_size),
+                {"\"sort_size\": " + emp::to_string(sort_size), "\"network_size\": " + emp::to_string(net_size), "\"passes\": " + emp::to_string(passes)},
+                "evaluations", ops, seconds);
+  }
+}
+
+/// Lexicase selection throughput for each population size x test case count.
+/// Scores are random pass/fail values (as in program selection).
+void BenchLexicaseSelection(const BenchConfig & bench_config, BenchResults & results) {
+  for (size_t pop_size : ParseList<size_t>(bench_config.LEXICASE_POP_SIZES())) {
+    for (size_t case_cnt : ParseList<size_t>(bench_config.LEXICASE_CASE_COUNTS())) {
+      emp::Random rnd(bench_config.SEED());
+      emp::World<size_t> world(rnd, "Lexicase Benchmark World");
+      world.SetPopStruct_Mixed(true);
+      // Organisms are indices into score table.
+      emp::vector<emp::vector<double>> scores(pop_size, emp::vector<double>(case_cnt));
+      for (auto & row : scores) for (auto & score : row) score = (double)rnd.P(0.5);
+      for (size_t i = 0; i < pop_size; ++i) world.Inject(i);
+      emp::vector<std::function<double(size_t &)>> fit_funs;
+      for (size_t c = 0; c < case_cnt; ++c) {
+        fit_funs.emplace_back([&scores, c](size_t & org) { return scores[org][c]; });
+      }
+      size_t ops = 0;
+      double seconds = 0;
+      TimeBatched(bench_config.MIN_BENCH_TIME(), [&](size_t n) {
+        for (size_t rep = 0; rep < n; ++rep) {
+          emp::LexicaseSelect_NAIVE(world, fit_funs, pop_size);
+          world.Update();
+        }
+        return n * pop_size;
+      }, ops, seconds);
+      results.Add("lexicase_select", "pop_" + emp::to_string(pop_size) + "_cases_" + emp::to_string(case_cnt),
+                  {"\"pop_size\": " + emp::to_string(pop_size), "\"case_cnt\": " + emp::to_string(case_cnt)},
+                  "selections", ops, seconds);
+    }
+  }
+}
+
+/// Full program synthesis RunStep for each problem x evaluation mode.
+void BenchProgSynthRunStep(const BenchConfig & bench_config, BenchResults & results) {
+  for (const std::string & problem : ParseList<std::string>(bench_config.PROBLEMS())) {
+    for (size_t eval_mode : ParseList<size_t>(bench_config.EVALUATION_MODES())) {
+      ProgramSynthesisExperiment e;
+      e.Setup(MakeProgSynthConfig(bench_config, problem, eval_mode));
+      // Un-timed warm-up step (update 0 also takes initial snapshots).
+      e.RunStep();
+      const size_t evals_before = e.GetTestEvalCount();
+      const auto start = bench_clock_t::now();
+      for (size_t step = 1; step <= bench_config.RUN_STEPS(); ++step) {
+        e.SetUpdate(step);
+        e.RunStep();
+      }
+      const double seconds = SecondsSince(start);
+      const size_t evals = e.GetTestEvalCount() - evals_before;
+      results.Add("prog_synth_runstep", problem + "_eval_mode_" + emp::to_string(eval_mode),
+                  {"\"problem\": \"" + problem + "\"", "\"evaluation_mode\": " + emp::to_string(eval_mode),
+                   "\"updates\": " + emp::to_string(bench_config.RUN_STEPS()),
+                   "\"updates_per_sec\": " + emp::to_string((seconds > 0) ? (double)bench_config.RUN_STEPS() / seconds : 0.0)},
+                  "test_evaluations", evals, seconds);
+    }
+  }
+}
+
+/// Full sorting network RunStep for each selection mode.
+void BenchSortingNetworkRunStep(const BenchConfig & bench_config, BenchResults & results) {
+  for (size_t selection_mode : ParseList<size_t>(bench_config.NETWORK_SELECTION_MODES())) {
+    SortingNetworkExperiment e;
+    e.Setup(MakeSortingNetworkConfig(bench_config, selection_mode));
+    // Un-timed warm-up step (update 0 also takes initial snapshots).
+    e.RunStep();
+    const size_t evals_before = e.GetTestEvalCount();
+    const auto start = bench_clock_t::now();
+    for (size_t step = 1; step <= bench_config.NETWORK_RUN_STEPS(); ++step) {
+      e.SetUpdate(step);
+      e.RunStep();
+    }
+    const double seconds = SecondsSince(start);
+    const size_t evals = e.GetTestEvalCount() - evals_before;
+    results.Add("sorting_network_runstep", "selection_mode_" + emp::to_string(selection_mode),
+                {"\"selection_mode\": " + emp::to_string(selection_mode),
+                 "\"updates\": " + emp::to_string(bench_config.NETWORK_RUN_STEPS()),
+                 "\"updates_per_sec\": " + emp::to_string((seconds > 0) ? (double)bench_config.NETWORK_RUN_STEPS() / seconds : 0.0)},
+                "test_evaluations", evals, seconds);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::string config_fname = "bench_configs.cfg";
+  BenchConfig config;
+  auto args = emp::cl::ArgManager(argc, argv);
+  config.Read(config_fname);
+  if (args.ProcessConfigOptions(config, std::cout, config_fname, "BenchConfig-macros.h") == false) exit(0);
+  if (args.TestUnknown() == false) exit(0); // If there are leftover args, throw an error.
+
+  // Write to screen how the benchmarks are configured
+  std::cout << "==============================" << std::endl;
+  std::cout << "|    How am I configured?    |" << std::endl;
+  std::cout << "==============================" << std::endl;
+  config.Write(std::cout);
+  std::cout << "==============================\n" << std::endl;
+
+  BenchResults results;
+  BenchTagLGPInstructions(config, results);
+  BenchSortingTestEvaluate(config, results);
+  BenchLexicaseSelection(config, results);
+  BenchProgSynthRunStep(config, results);
+  BenchSortingNetworkRunStep(config, results);
+
+  std::ofstream out(config.OUTPUT_FILE());
+  if (!out.is_open()) {
+    std::cout << "Failed to open benchmark output file (" << config.OUTPUT_FILE() << "). Exiting." << std::endl;
+    exit(-1);
+  }
+  results.Write(out, config.SEED());
+  std::cout << "Wrote benchmark results to " << config.OUTPUT_FILE() << std::endl;
+}
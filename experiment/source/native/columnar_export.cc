@@ -0,0 +1,64 @@
+// Export columnar data files (.col; see ColumnarFile.h) as CSV.
+// Usage: columnar_export <file.col> [--schema] [column ...]
+// - Prints every column (or only the listed columns, in the order listed) to stdout as CSV,
+//   formatted the same way as the equivalent CSV output.
+// - --schema prints column names/types and file metadata instead.
+
+#include <iostream>
+#include <string>
+
+#include "base/vector.h"
+
+#include "../ColumnarFile.h"
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    std::cout << "Usage: " << argv[0] << " <file.col> [--schema] [column ...]" << std::endl;
+    return 1;
+  }
+  ColumnarReader reader;
+  if (!reader.Open(argv[1])) {
+    std::cerr << "Failed to open columnar data file (" << argv[1] << ")." << std::endl;
+    return 1;
+  }
+
+  bool schema = false;
+  emp::vector<size_t> cols;
+  for (int i = 2; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    if (arg == "--schema") { schema = true; continue; }
+    const size_t col = reader.GetColumnID(arg);
+    if (col == reader.GetNumColumns()) {
+      std::cerr << "Unknown column (" << arg << ")." << std::endl;
+      return 1;
+    }
+    cols.emplace_back(col);
+  }
+  if (cols.empty()) for (size_t col = 0; col < reader.GetNumColumns(); ++col) cols.emplace_back(col);
+
+  if (schema) {
+    const char * type_names[] = {"uint", "int", "double", "string", "uint_list", "program"};
+    for (size_t col = 0; col < reader.GetNumColumns(); ++col) {
+      std::cout << reader.GetName(col) << ": " << type_names[(size_t)reader.GetType(col)] << "\n";
+    }
+    for (const auto & entry : reader.GetMeta()) {
+      if (entry.first.find(".inst_names") != std::string::npos) continue; // Long; not useful to print.
+      std::cout << entry.first << " = " << entry.second << "\n";
+    }
+    return 0;
+  }
+
+  for (size_t i = 0; i < cols.size(); ++i) std::cout << (i ? "," : "") << reader.GetName(cols[i]);
+  std::cout << "\n";
+  while (reader.NextBlock()) {
+    for (size_t row = 0; row < reader.GetNumRows(); ++row) {
+      for (size_t i = 0; i < cols.size(); ++i) {
+        if (i) std::cout << ",";
+        reader.PrintCSVField(std::cout, cols[i], row);
+      }
+      std::cout << "\n";
+    }
+  }
+  return 0;
+}
@@ -14,6 +14,7 @@ int main(int argc, char* argv[])
 {
   std::string config_fname = "prog_synth_configs.cfg";
   ProgramSynthesisConfig config;
+  std::string resume_fpath = ExtractResumeArg(argc, argv); // Strip --resume <file> before ArgManager sees it.
   auto args = emp::cl::ArgManager(argc, argv);
   config.Read(config_fname);
   if (args.ProcessConfigOptions(config, std::cout, config_fname, "ProgSynthConfig-macros.h") == false) exit(0);
@@ -27,7 +28,8 @@ int main(int argc, char* argv[])
   std::cout << "==============================\n" << std::endl;
 
   ProgramSynthesisExperiment e;
-  e.Setup(config);
+  if (resume_fpath.size()) e.Resume(config, resume_fpath);
+  else e.Setup(config);
   e.Run();
 
 }
@@ -0,0 +1,63 @@
+// This is the batch main function for the NATIVE version of this project.
+// - Runs one replicate per seed (--seeds 1-100), --threads replicates at a time (see BatchRunner.h).
+// - Replicate outputs (and console logs) go to DATA_DIRECTORY/seed_<seed>/.
+// - --resume resumes each replicate from its checkpoint file (if it has one).
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "base/vector.h"
+#include "config/ArgManager.h"
+#include "config/command_line.h"
+
+#include "../BatchRunner.h"
+#include "../ProgSynthExperiment.h"
+#include "../ProgSynthConfig.h"
+
+int main(int argc, char* argv[])
+{
+  std::string config_fname = "prog_synth_configs.cfg";
+  ProgramSynthesisConfig config;
+  BatchArgs batch = ExtractBatchArgs(argc, argv); // Strip batch arguments before ArgManager sees them.
+  auto args = emp::cl::ArgManager(argc, argv);
+  config.Read(config_fname);
+  if (args.ProcessConfigOptions(config, std::cout, config_fname, "ProgSynthConfig-macros.h") == false) exit(0);
+  if (args.TestUnknown() == false) exit(0); // If there are leftover args, throw an error. 
+  if (batch.seeds.empty()) {
+    std::cout << "No seeds given (--seeds <first>-<last>). Exiting." << std::endl;
+    exit(-1);
+  }
+
+  // Write to screen how the experiment is configured
+  std::cout << "==============================" << std::endl;
+  std::cout << "|    How am I configured?    |" << std::endl;
+  std::cout << "==============================" << std::endl;
+  config.Write(std::cout);
+  std::cout << "==============================\n" << std::endl;
+  std::cout << "Running " << batch.seeds.size() << " replicates (" << batch.threads << " at a time)." << std::endl;
+
+  // Each replicate gets its own copy of the configuration (with its seed + data directory).
+  std::ostringstream config_str;
+  config.Write(config_str);
+  const std::string data_dir = config.DATA_DIRECTORY();
+  SnapshotWriter::MakeDir(data_dir);
+
+  RunBatch(batch, [&config_str, &data_dir, &batch](int seed) {
+    ProgramSynthesisConfig seed_config;
+    std::istringstream in(config_str.str());
+    seed_config.Read(in);
+    seed_config.SEED(seed);
+    seed_config.DATA_DIRECTORY(GetBatchSeedDir(data_dir, seed));
+    SnapshotWriter::MakeDir(seed_config.DATA_DIRECTORY());
+
+    std::ofstream log;
+    StartBatchLog(log, seed_config.DATA_DIRECTORY() + "log.txt");
+    const std::string checkpoint_fpath = seed_config.DATA_DIRECTORY() + seed_config.CHECKPOINT_FILE();
+    ProgramSynthesisExperiment e;
+    if (batch.resume && std::ifstream(checkpoint_fpath).good()) e.Resume(seed_config, checkpoint_fpath);
+    else e.Setup(seed_config);
+    e.Run();
+  });
+}
@@ -13,6 +13,7 @@ int main(int argc, char* argv[])
 {
   std::string config_fname = "sorting_network_configs.cfg";
   SortingNetworkConfig config;
+  std::string resume_fpath = ExtractResumeArg(argc, argv); // Strip --resume <file> before ArgManager sees it.
   auto args = emp::cl::ArgManager(argc, argv);
   config.Read(config_fname);
   if (args.ProcessConfigOptions(config, std::cout, config_fname, "SortingNetworkConfig-macros.h") == false) exit(0);
@@ -26,7 +27,8 @@ int main(int argc, char* argv[])
   std::cout << "==============================\n" << std::endl;
 
   SortingNetworkExperiment e;
-  e.Setup(config);
+  if (resume_fpath.size()) e.Resume(config, resume_fpath);
+  else e.Setup(config);
   e.Run();
 
 }
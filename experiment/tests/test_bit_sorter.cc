@@ -10,6 +10,8 @@
 
 #include "../source/Mutators.h"
 #include "../source/BitTestOrg.h"
+#include "../source/BitSorterTruthTable.h"
+#include "../source/UniqueTestIndex.h"
 
 TEST_CASE("BitSorter", "[bitsorters]") {
 
@@ -114,4 +116,66 @@ TEST_CASE("Mutators", "[bitsorters]") {
   bit_vec.Print(); std::cout << std::endl;
   std::cout << "Bit vec as uint: " << bit_vec.GetUInt(0) << std::endl;
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("BitSorterTruthTable", "[bitsorters]") {
+  emp::Random rnd(3);
+  BitSorterMutator sorter_mutator;
+  BitSorterTruthTable table;
+
+  // Known n=4 sorter.
+  emp::BitSorter sorter;
+  sorter.AddCompare(0,1);
+  sorter.AddCompare(2,3);
+  sorter.AddCompare(0,3);
+  sorter.AddCompare(1,2);
+  sorter.AddCompare(0,1);
+  sorter.AddCompare(2,3);
+  table.Build(sorter, 4);
+  REQUIRE(table.CountSortable() == 16);
+  REQUIRE(table.IsCorrect());
+
+  // Tables should agree with evaluating tests one at a time (small tables share a word; larger
+  // ones span blocks of words).
+  for (size_t num_bits : {2, 5, 6, 8, 11, 16}) {
+    sorter_mutator.SORT_SEQ_SIZE = num_bits;
+    for (size_t i = 0; i < 20; ++i) {
+      sorter = sorter_mutator.GenRandomBitSorter(rnd);
+      table.Build(sorter, num_bits);
+      REQUIRE(table.CountSortable() == sorter.CountSortable(num_bits));
+      REQUIRE(table.IsCorrect() == sorter.IsCorrect(num_bits));
+      for (uint32_t input = 0; input < (1u << num_bits); ++input) {
+        REQUIRE(table.TestSortable(input) == sorter.TestSortable(input));
+      }
+    }
+  }
+}
+
+TEST_CASE("UniqueTestIndex", "[bitsorters]") {
+  emp::vector<uint32_t> tests = {5, 3, 5, 12, 3, 3, 7};
+  UniqueTestIndex<uint32_t> index;
+  // Hash collisions (everything shares a hash) must not merge different tests.
+  index.Build(tests.size(), [&tests](size_t id) -> const uint32_t & { return tests[id]; },
+              [](const uint32_t &) { return (uint64_t)0; });
+  REQUIRE(index.GetNumUnique() == 4);
+  for (size_t i = 0; i < tests.size(); ++i) {
+    REQUIRE(tests[index.GetFirstSlot(index.GetUniqueID(i))] == tests[i]);
+  }
+  REQUIRE(index.GetUniqueID(0) == index.GetUniqueID(2));
+  REQUIRE(index.GetUniqueID(1) == index.GetUniqueID(5));
+  REQUIRE(index.GetUniqueID(0) != index.GetUniqueID(6));
+
+  // Each distinct test is evaluated once per sorter.
+  emp::BitSorter sorter;
+  sorter.AddCompare(0,1);
+  UniqueTestResults<uint8_t> results;
+  for (size_t rep = 0; rep < 2; ++rep) {
+    size_t num_evals = 0;
+    results.Begin(index.GetNumUnique());
+    for (size_t i = 0; i < tests.size(); ++i) {
+      const bool can_sort = results.Get(index.GetUniqueID(i), [&]() { ++num_evals; return (uint8_t)sorter.TestSortable(tests[i]); });
+      REQUIRE(can_sort == sorter.TestSortable(tests[i]));
+    }
+    REQUIRE(num_evals == index.GetNumUnique());
+  }
+}
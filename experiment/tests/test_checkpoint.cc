@@ -0,0 +1,225 @@
+#define CATCH_CONFIG_MAIN
+#include "third-party/Catch/single_include/catch.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "base/Ptr.h"
+#include "base/vector.h"
+#include "tools/Random.h"
+#include "tools/string_utils.h"
+#include "Evolve/World.h"
+#include "Evolve/Systematics.h"
+
+#include "../source/Checkpoint.h"
+#include "../source/CompactSystematics.h"
+#include "../source/SystematicsCheckpoint.h"
+
+struct CheckpointTestOrg {
+  using genome_t = emp::vector<int>;
+  genome_t genome;
+  CheckpointTestOrg(const genome_t & _g) : genome(_g) { ; }
+  genome_t & GetGenome() { return genome; }
+  const genome_t & GetGenome() const { return genome; }
+};
+
+template<>
+struct CompactGenomeTraits<emp::vector<int>> {
+  using elem_t = int;
+  static const emp::vector<int> & GetSeq(const emp::vector<int> & genome) { return genome; }
+  static void SetSeq(emp::vector<int> & genome, emp::vector<int> && seq) { genome = std::move(seq); }
+  static void Hash(uint64_t & hash, int val) { CompactGenomeHash(hash, (uint64_t)val); }
+  static size_t GetBytes(int) { return sizeof(int); }
+};
+
+/// Small evolving population with compact and full-genome systematics, summarized every update.
+struct CheckpointTestRun {
+  using org_t = CheckpointTestOrg;
+  using genome_t = org_t::genome_t;
+  using compact_systematics_t = emp::Systematics<org_t, CompactGenome<genome_t>>;
+  using full_systematics_t = emp::Systematics<org_t, genome_t>;
+
+  static constexpr size_t POP_SIZE = 20;
+  static constexpr size_t GENOME_SIZE = 8;
+
+  emp::Random random;
+  emp::World<org_t> world;
+  emp::Ptr<compact_systematics_t> compact_sys;
+  emp::Ptr<full_systematics_t> full_sys;
+  SystematicsCompactor<org_t, genome_t> compactor;
+
+  CheckpointTestRun(const std::string & data_fpath, CheckpointDataFiles & data_files)
+    : random(1), world(random, "checkpoint test world"), compact_sys(nullptr), full_sys(nullptr),
+      compactor(4, 16 * 1024)  // Small cap: extinct ancestors lose their genomes.
+  {
+    world.SetPopStruct_Mixed(true);
+    compact_sys = emp::NewPtr<compact_systematics_t>([](const org_t & org) { return CompactGenome<genome_t>(org.GetGenome()); });
+    full_sys = emp::NewPtr<full_systematics_t>([](const org_t & org) { return org.GetGenome(); });
+    world.AddSystematics(compact_sys, "compact");
+    world.AddSystematics(full_sys, "full");
+    compact_sys->AddSnapshotFun([](const typename compact_systematics_t::taxon_t & t) {
+      return t.GetInfo().HasGenome() ? emp::to_string(t.GetInfo().GetGenome()) : std::string();
+    }, "genome", "Genome");
+    full_sys->AddSnapshotFun([](const typename full_systematics_t::taxon_t & t) {
+      return emp::to_string(t.GetInfo());
+    }, "genome", "Genome");
+    auto & file = world.SetupSystematicsFile("compact", data_fpath, false);
+    file.SetTimingRepeat(1);
+    file.AddPreFun([this]() { compactor.Compact(*compact_sys); });
+    AddCompactSystematicsStats(file, compactor);
+    file.PrintHeaderKeys();
+    data_files.Add(file, data_fpath);
+    for (size_t i = 0; i < POP_SIZE; ++i) world.Inject(genome_t(GENOME_SIZE, 0), 1);
+  }
+
+  void Run(size_t generations) {
+    for (size_t gen = 0; gen < generations; ++gen) {
+      for (size_t i = 0; i < world.GetSize(); ++i) {
+        const size_t parent = random.GetUInt(world.GetSize());
+        genome_t genome(world.GetGenomeAt(parent));
+        if (random.P(0.5)) genome[random.GetUInt(GENOME_SIZE)] = (int)random.GetUInt(4);
+        world.DoBirth(genome, parent);
+      }
+      world.Update();
+      compactor.Enforce(*compact_sys);
+    }
+  }
+
+  void WriteCheckpoint(std::ostream & out) {
+    CheckpointWrite(out, (uint64_t)world.GetUpdate());
+    CheckpointWriteWorld(out, world);
+    CheckpointWriteSystematics(out, *compact_sys);
+    compactor.WriteCheckpoint(out);
+    CheckpointWriteSystematics(out, *full_sys);
+    CheckpointWrite(out, random);
+  }
+
+  void ReadCheckpoint(std::istream & in) {
+    uint64_t update = 0;
+    CheckpointRead(in, update);
+    CheckpointReadWorld(in, world);
+    SetWorldUpdate(world, (size_t)update);
+    CheckpointReadSystematics(in, *compact_sys);
+    compactor.ReadCheckpoint(in);
+    CheckpointReadSystematics(in, *full_sys);
+    CheckpointRead(in, random);
+  }
+
+  /// Phylogeny snapshots (rows sorted; snapshot row order follows taxon addresses).
+  std::string Snapshot(const std::string & fpath) {
+    std::string snapshot;
+    for (size_t i = 0; i < 2; ++i) {
+      const std::string sys_fpath = fpath + emp::to_string(i);
+      if (i == 0) compact_sys->Snapshot(sys_fpath);
+      else full_sys->Snapshot(sys_fpath);
+      std::ifstream file(sys_fpath);
+      emp::vector<std::string> rows;
+      for (std::string row; std::getline(file, row); ) rows.emplace_back(row);
+      std::sort(rows.begin(), rows.end());
+      for (const std::string & row : rows) snapshot += row + "\n";
+    }
+    return snapshot;
+  }
+};
+
+std::string ReadCheckpointTestFile(const std::string & fpath) {
+  std::ifstream file(fpath, std::ios::binary);
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+TEST_CASE("Checkpoint resume", "[checkpoint]") {
+  const std::string data_fpath = "temp/checkpoint_sys.csv";
+  const std::string snapshot_fpath = "temp/checkpoint_phylogeny.csv";
+  std::string checkpoint;
+  std::string expected_snapshot;
+  // Uninterrupted run, checkpointed halfway.
+  {
+    CheckpointDataFiles data_files;
+    CheckpointTestRun run(data_fpath, data_files);
+    run.Run(25);
+    std::ostringstream out;
+    WriteCheckpointHeader(out, "CheckpointTest", 25, data_files);
+    run.WriteCheckpoint(out);
+    checkpoint = out.str();
+    run.Run(25);
+    data_files.Flush();
+    expected_snapshot = run.Snapshot(snapshot_fpath);
+  }
+  const std::string expected_data = ReadCheckpointTestFile(data_fpath);
+  REQUIRE(expected_data.size());
+
+  // Resumed run (from the data file as the uninterrupted run left it, past the checkpoint).
+  {
+    std::istringstream in(checkpoint);
+    CheckpointDataFiles data_files;
+    REQUIRE(ReadCheckpointHeader(in, "CheckpointTest", data_files) == 25);
+    CheckpointTestRun run(data_fpath, data_files);
+    run.ReadCheckpoint(in);
+    REQUIRE((bool)in);
+    data_files.Resume();
+    run.Run(25);
+    data_files.Flush();
+    REQUIRE(run.Snapshot(snapshot_fpath) == expected_snapshot);
+  }
+  REQUIRE(ReadCheckpointTestFile(data_fpath) == expected_data);
+}
+
+/// Memory used by compact systematics, as SystematicsCompactor estimates it.
+template<typename SYSTEMATICS_T, typename COMPACTOR_T>
+size_t CalcCompactSystematicsBytes(SYSTEMATICS_T & sys) {
+  size_t bytes = 0;
+  auto add = [&bytes](emp::Ptr<typename SYSTEMATICS_T::taxon_t> t) {
+    if (t->GetInfo().HasGenome()) bytes += t->GetInfo().GetNode()->bytes;
+    bytes += sizeof(typename SYSTEMATICS_T::taxon_t) + COMPACTOR_T::TAXON_OVERHEAD;
+  };
+  for (auto t : sys.GetActive()) add(t);
+  for (auto t : sys.GetAncestors()) add(t);
+  return bytes;
+}
+
+TEST_CASE("Compact systematics hard cap", "[checkpoint]") {
+  using org_t = CheckpointTestOrg;
+  using genome_t = org_t::genome_t;
+  using systematics_t = emp::Systematics<org_t, CompactGenome<genome_t>>;
+  using compactor_t = SystematicsCompactor<org_t, genome_t>;
+  constexpr size_t POP_SIZE = 50;
+  constexpr size_t GENOME_SIZE = 1024;
+  constexpr size_t MAX_BYTES = 96 * 1024;  // Less than the initial population's (distinct) genomes.
+  emp::Random random(2);
+  emp::World<org_t> world(random, "hard cap test world");
+  world.SetPopStruct_Mixed(true);
+  emp::Ptr<systematics_t> sys = emp::NewPtr<systematics_t>([](const org_t & org) { return CompactGenome<genome_t>(org.GetGenome()); });
+  world.AddSystematics(sys, "compact");
+  compactor_t compactor(4, MAX_BYTES);
+  for (size_t i = 0; i < POP_SIZE; ++i) {
+    genome_t genome(GENOME_SIZE);
+    for (int & val : genome) val = (int)random.GetUInt(1000);
+    world.Inject(genome, 1);
+  }
+  size_t max_dropped_active = 0;
+  for (size_t gen = 0; gen < 20; ++gen) {
+    for (size_t i = 0; i < world.GetSize(); ++i) {
+      const size_t parent = random.GetUInt(world.GetSize());
+      genome_t genome(world.GetGenomeAt(parent));
+      if (random.P(0.2)) genome[random.GetUInt(GENOME_SIZE)] = (int)random.GetUInt(1000);
+      world.DoBirth(genome, parent);
+    }
+    world.Update();
+    compactor.Enforce(*sys);
+    const size_t bytes = CalcCompactSystematicsBytes<systematics_t, compactor_t>(*sys);
+    REQUIRE(bytes <= MAX_BYTES);
+    max_dropped_active = std::max(max_dropped_active, compactor.GetStats().dropped_active);
+  }
+  // Past extinct ancestors, living taxa lost their genomes (while the initial lineages lasted).
+  REQUIRE(max_dropped_active > 0);
+  // Living taxa that kept their genomes still decode correctly.
+  for (size_t i = 0; i < world.GetSize(); ++i) {
+    const auto & info = sys->GetTaxonAt(i)->GetInfo();
+    if (info.HasGenome()) REQUIRE(info.GetGenome() == world.GetGenomeAt(i));
+  }
+}
@@ -5,7 +5,7 @@ For each run, grab smallest correct solution network. If run has none, report no
 
 '''
 
-import argparse, os, copy, errno, csv
+import argparse, os, copy, errno, csv, subprocess
 
 default_update = 10000
 
@@ -22,12 +22,23 @@ def mkdir_p(path):
             pass
         else: raise
 
+def read_solutions(run_sols, exporter):
+    """
+    Read solutions file lines. If run output is columnar (.col), export it as CSV with exporter.
+    """
+    col_sols = os.path.splitext(run_sols)[0] + ".col"
+    if not os.path.exists(run_sols) and os.path.exists(col_sols):
+        return subprocess.check_output([exporter, col_sols]).decode().strip().split("\n")
+    with open(run_sols, "r") as fp:
+        return fp.read().strip().split("\n")
+
 def main():
     parser = argparse.ArgumentParser(description="Data aggregation script.")
     parser.add_argument("data_directory", type=str, help="Target experiment directory.")
     parser.add_argument("dump_directory", type=str, help="Where to dump this?")
     parser.add_argument("-u", "--update", type=int, help="max update to look for solutions")
     parser.add_argument("-e", "--evaluations", type=int, help="max evaluation to look for solutions")
+    parser.add_argument("-x", "--exporter", type=str, default="columnar_export", help="columnar_export executable (for columnar output)")
 
     args = parser.parse_args()
 
@@ -60,8 +71,7 @@ def main():
             problem = run.strip("PROBLEM_").split("__")[0]
             
             file_content = None
-            with open(run_sols, "r") as fp:
-                file_content = fp.read().strip().split("\n")
+            file_content = read_solutions(run_sols, args.exporter)
 
             header = file_content[0].split(",")
             header_lu = {header[i].strip():i for i in range(0, len(header))}
@@ -124,8 +134,7 @@ def main():
             problem = run.strip("PROBLEM_").split("__")[0]
             
             file_content = None
-            with open(run_sols, "r") as fp:
-                file_content = fp.read().strip().split("\n")
+            file_content = read_solutions(run_sols, args.exporter)
 
             header = file_content[0].split(",")
             header_lu = {header[i].strip():i for i in range(0, len(header))}